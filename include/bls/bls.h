@@ -53,6 +53,11 @@ typedef struct {
 	mclBnG1 v;
 } blsSignature;
 
+// H(m) of a message m ; see blsMessagePrepare
+typedef struct {
+	mclBnG1 v;
+} blsMessage;
+
 /*
 	initialize this library
 	call this once before using the other functions
@@ -66,6 +71,44 @@ typedef struct {
 */
 BLS_DLL_API int blsInit(int curve, int compiledTimeVar);
 
+/*
+	same as mclBn_setMapToMode but also update the map-to mode covered by the verify cache
+	@note not thread safe
+*/
+BLS_DLL_API int blsSetMapToMode(int mode);
+
+/*
+	the MT functions split their work into threadN ranges
+	threadN = 0 means 1 by default, so the library starts no thread unless threadN > 1 is given
+	and then each range except for the first one runs on a new thread per call
+	blsSetThreadNum(n) starts a library-wide pool of n - 1 threads (n = 0 means the number of cores)
+	shared by all the MT functions ; the caller runs the ranges with the pool
+	and idle threads steal the ranges of the others
+	threadN = 0 of the MT functions means n after that
+	n = 1 makes the MT functions single-threaded
+	the batch and multi-point functions without MT (e.g. blsSignatureAggregate, blsPublicKeyShareBatch, blsSignatureRecover)
+	are the MT ones with threadN = 0, so they also use the pool or the executor
+	return 0 if success else -1 (no thread support)
+	@note not thread safe ; don't call it while using the MT functions
+*/
+BLS_DLL_API int blsSetThreadNum(mclSize n);
+// return the number of threads used by threadN = 0 of the MT functions (1 by default)
+BLS_DLL_API mclSize blsGetThreadNum(void);
+typedef void (*blsTaskFunc)(void *arg);
+/*
+	exec(self, task, arg) must call task(arg) once on any thread
+	an MT function waits for all the tasks given to exec
+*/
+typedef void (*blsExecutor)(void *self, blsTaskFunc task, void *arg);
+/*
+	run the MT functions on exec instead of the pool
+	threadN is the number of threads of exec including the caller (0 means 1)
+	exec = NULL stops using exec
+	return 0 if success else -1 (no thread support)
+	@note not thread safe ; don't call it while using the MT functions
+*/
+BLS_DLL_API int blsSetExecutor(blsExecutor exec, void *self, mclSize threadN);
+
 BLS_DLL_API void blsIdSetInt(blsId *id, int x);
 
 // return 0 if success
@@ -91,6 +134,33 @@ BLS_DLL_API mclSize blsIdDeserialize(blsId *id, const void *buf, mclSize bufSize
 BLS_DLL_API mclSize blsSecretKeyDeserialize(blsSecretKey *sec, const void *buf, mclSize bufSize);
 BLS_DLL_API mclSize blsPublicKeyDeserialize(blsPublicKey *pub, const void *buf, mclSize bufSize);
 BLS_DLL_API mclSize blsSignatureDeserialize(blsSignature *sig, const void *buf, mclSize bufSize);
+/*
+	uncompressed serialization ; affine x and y in the byte representation of Fp (or Fp2)
+	the size is blsGetG1ByteSize() * 2 for blsSignature and blsGetG1ByteSize() * 4 for blsPublicKey
+	the point at infinity is all zero
+	return written byte size if success else 0
+*/
+BLS_DLL_API mclSize blsPublicKeySerializeUncompressed(void *buf, mclSize maxBufSize, const blsPublicKey *pub);
+BLS_DLL_API mclSize blsSignatureSerializeUncompressed(void *buf, mclSize maxBufSize, const blsSignature *sig);
+/*
+	no square root is needed
+	trusted = 1 skips the check whether the point is on the curve (and has the correct order)
+	use trusted = 1 only for the data serialized by yourself
+	return read byte size if success else 0
+*/
+BLS_DLL_API mclSize blsPublicKeyDeserializeUncompressed(blsPublicKey *pub, const void *buf, mclSize bufSize, int trusted);
+BLS_DLL_API mclSize blsSignatureDeserializeUncompressed(blsSignature *sig, const void *buf, mclSize bufSize, int trusted);
+/*
+	deserialize n elements of elemSize bytes each from buf[0, n * elemSize)
+	okVec[i] = 1 if buf[i * elemSize, (i + 1) * elemSize) is read into pubVec[i] (or sigVec[i]) else 0
+	the order is checked if blsPublicKeyVerifyOrder (or blsSignatureVerifyOrder) is set
+	return the number of successful elements
+*/
+BLS_DLL_API mclSize blsPublicKeyDeserializeBatch(blsPublicKey *pubVec, int *okVec, const void *buf, mclSize elemSize, mclSize n);
+BLS_DLL_API mclSize blsSignatureDeserializeBatch(blsSignature *sigVec, int *okVec, const void *buf, mclSize elemSize, mclSize n);
+// the elements are split into threadN threads (0 means blsGetThreadNum())
+BLS_DLL_API mclSize blsPublicKeyDeserializeBatchMT(blsPublicKey *pubVec, int *okVec, const void *buf, mclSize elemSize, mclSize n, mclSize threadN);
+BLS_DLL_API mclSize blsSignatureDeserializeBatchMT(blsSignature *sigVec, int *okVec, const void *buf, mclSize elemSize, mclSize n, mclSize threadN);
 
 // return 1 if same else 0
 BLS_DLL_API int blsIdIsEqual(const blsId *lhs, const blsId *rhs);
@@ -101,10 +171,55 @@ BLS_DLL_API int blsSignatureIsEqual(const blsSignature *lhs, const blsSignature
 // return 0 if success
 BLS_DLL_API int blsSecretKeyShare(blsSecretKey *sec, const blsSecretKey* msk, mclSize k, const blsId *id);
 BLS_DLL_API int blsPublicKeyShare(blsPublicKey *pub, const blsPublicKey *mpk, mclSize k, const blsId *id);
+/*
+	secVec[i] = the share of msk[0, k) for idVec[i] for i in [0, n) ; same as blsSecretKeyShare for each id
+	secVec must not overlap msk
+	return 0 if success else -1
+*/
+BLS_DLL_API int blsSecretKeyShareBatch(blsSecretKey *secVec, const blsSecretKey *msk, mclSize k, const blsId *idVec, mclSize n);
+// the ids are split into threadN threads (0 means blsGetThreadNum())
+BLS_DLL_API int blsSecretKeyShareBatchMT(blsSecretKey *secVec, const blsSecretKey *msk, mclSize k, const blsId *idVec, mclSize n, mclSize threadN);
+/*
+	pubVec[i] = the share of mpk[0, k) for idVec[i] for i in [0, n) ; same as blsPublicKeyShare for each id
+	a large id is evaluated by a fixed-base table of mpk instead of k scalar multiplications
+	pubVec must not overlap mpk
+	return 0 if success else -1
+*/
+BLS_DLL_API int blsPublicKeyShareBatch(blsPublicKey *pubVec, const blsPublicKey *mpk, mclSize k, const blsId *idVec, mclSize n);
+// the table and the ids are split into threadN threads (0 means blsGetThreadNum())
+BLS_DLL_API int blsPublicKeyShareBatchMT(blsPublicKey *pubVec, const blsPublicKey *mpk, mclSize k, const blsId *idVec, mclSize n, mclSize threadN);
 
 BLS_DLL_API int blsSecretKeyRecover(blsSecretKey *sec, const blsSecretKey *secVec, const blsId *idVec, mclSize n);
 BLS_DLL_API int blsPublicKeyRecover(blsPublicKey *pub, const blsPublicKey *pubVec, const blsId *idVec, mclSize n);
 BLS_DLL_API int blsSignatureRecover(blsSignature *sig, const blsSignature *sigVec, const blsId *idVec, mclSize n);
+/*
+	multi-threaded version of blsPublicKeyRecover and blsSignatureRecover
+	@param threadN [in] the number of threads (0 means blsGetThreadNum())
+*/
+BLS_DLL_API int blsPublicKeyRecoverMT(blsPublicKey *pub, const blsPublicKey *pubVec, const blsId *idVec, mclSize n, mclSize threadN);
+BLS_DLL_API int blsSignatureRecoverMT(blsSignature *sig, const blsSignature *sigVec, const blsId *idVec, mclSize n, mclSize threadN);
+
+/*
+	Lagrange coefficients of idVec[0, k) for recovery by the same k share-holders
+	lambda_i = prod_{j != i} idVec[j] / (idVec[j] - idVec[i])
+*/
+typedef struct blsLagrangeBasis blsLagrangeBasis;
+/*
+	return a new blsLagrangeBasis if success else NULL
+	fail if k = 0 or idVec has zero or the same ids (k > 1)
+	@note call blsLagrangeBasisDestroy to free it
+*/
+BLS_DLL_API blsLagrangeBasis *blsLagrangeBasisCreate(const blsId *idVec, mclSize k);
+BLS_DLL_API void blsLagrangeBasisDestroy(blsLagrangeBasis *basis);
+// return k
+BLS_DLL_API mclSize blsLagrangeBasisGetSize(const blsLagrangeBasis *basis);
+/*
+	same as bls*Recover with the idVec of basis
+	secVec, pubVec and sigVec must have blsLagrangeBasisGetSize(basis) elements
+*/
+BLS_DLL_API void blsSecretKeyRecoverWithBasis(blsSecretKey *sec, const blsSecretKey *secVec, const blsLagrangeBasis *basis);
+BLS_DLL_API void blsPublicKeyRecoverWithBasis(blsPublicKey *pub, const blsPublicKey *pubVec, const blsLagrangeBasis *basis);
+BLS_DLL_API void blsSignatureRecoverWithBasis(blsSignature *sig, const blsSignature *sigVec, const blsLagrangeBasis *basis);
 
 // add
 BLS_DLL_API void blsSecretKeyAdd(blsSecretKey *sec, const blsSecretKey *rhs);
@@ -122,6 +237,15 @@ BLS_DLL_API void blsPublicKeyVerifyOrder(int doVerify);
 //	deserialize under VerifyOrder(true) = deserialize under VerifyOrder(false) + IsValidOrder
 BLS_DLL_API int blsSignatureIsValidOrder(const blsSignature *sig);
 BLS_DLL_API int blsPublicKeyIsValidOrder(const blsPublicKey *pub);
+/*
+	check the order of sigVec[0, n) (or pubVec[0, n)) together by random linear combinations
+	a point of a wrong order is missed with probability at most 2^-secBit (secBit = 0 means 128)
+	okVec[i] = 1 if the i-th point has the correct order else 0 ; the bad points are found by bisection
+	okVec may be NULL if only the result is needed
+	return 1 if all the points have the correct order else 0
+*/
+BLS_DLL_API int blsSignatureAreValidOrderBatch(int *okVec, const blsSignature *sigVec, mclSize n, mclSize secBit);
+BLS_DLL_API int blsPublicKeyAreValidOrderBatch(int *okVec, const blsPublicKey *pubVec, mclSize n, mclSize secBit);
 
 #ifndef BLS_MINIMUM_API
 
@@ -132,6 +256,13 @@ BLS_DLL_API int blsPublicKeyIsValidOrder(const blsPublicKey *pub);
 	NOTE : return false if h is zero or c1 or -c1 value for BN254. see hashTest() in test/bls_test.hpp
 */
 BLS_DLL_API int blsSignHash(blsSignature *sig, const blsSecretKey *sec, const void *h, mclSize size);
+/*
+	sign m with secVec[i] into sigVec[i] for i in [0, n) ; same as blsSign for each key
+	H(m) is computed once and its window table is shared by the keys
+	the keys are split into threadN threads (0 means blsGetThreadNum()) in the MT version
+*/
+BLS_DLL_API void blsSignMultiKey(blsSignature *sigVec, const blsSecretKey *secVec, mclSize n, const void *m, mclSize size);
+BLS_DLL_API void blsSignMultiKeyMT(blsSignature *sigVec, const blsSecretKey *secVec, mclSize n, const void *m, mclSize size, mclSize threadN);
 // return 1 if valid
 BLS_DLL_API int blsVerifyHash(const blsSignature *sig, const blsPublicKey *pub, const void *h, mclSize size);
 
@@ -142,6 +273,258 @@ BLS_DLL_API int blsVerifyHash(const blsSignature *sig, const blsPublicKey *pub,
 	@note do not check duplication of hVec
 */
 BLS_DLL_API int blsVerifyAggregatedHashes(const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n);
+/*
+	multi-threaded version of blsVerifyAggregatedHashes
+	the pairs are split into threadN ranges and the partial Miller loops are multiplied before finalExp
+	@param threadN [in] the number of threads (0 means blsGetThreadNum())
+	return the same value as blsVerifyAggregatedHashes
+*/
+BLS_DLL_API int blsVerifyAggregatedHashesMT(const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n, mclSize threadN);
+
+#ifndef MCL_DONT_USE_CSPRNG
+/*
+	verify sigVec[i] with pubVec[i] and msgVec[i * msgSize, (i + 1) * msgSize) for i in [0, n) at once
+	e(sum_i r_i sigVec[i], Q) = prod_i e(r_i H(m_i), pubVec[i]) for random r_i
+	n + 1 Miller loops and one final exponentiation instead of 2n and n
+	return 1 if all signatures are valid
+	@note the probability that an invalid batch is accepted is about 2^-63 for the points of order r,
+	so the order of sigVec and pubVec is checked by bls*AreValidOrderBatch if blsSignatureVerifyOrder(0)
+	or blsPublicKeyVerifyOrder(0) is set
+*/
+BLS_DLL_API int blsVerifyBatch(const blsSignature *sigVec, const blsPublicKey *pubVec, const void *msgVec, mclSize msgSize, mclSize n);
+#endif
+
+/*
+	out = sum_{i < n} sigVec[i] (resp. pubVec[i]) ; out = 0 if n = 0
+	the points are added by blsGetThreadNum() threads and out is normalized
+	so the result does not depend on the number of threads
+*/
+BLS_DLL_API void blsSignatureAggregate(blsSignature *out, const blsSignature *sigVec, mclSize n);
+BLS_DLL_API void blsPublicKeyAggregate(blsPublicKey *out, const blsPublicKey *pubVec, mclSize n);
+
+/*
+	verify sig of the same message m signed by pubVec[0, n)
+	e(sig, Q) = e(H(m), sum_i pubVec[i])
+	the public keys are added by blsGetThreadNum() threads
+	return 1 if valid
+	@note check the proof of possession of each public key in advance to prevent the rogue key attack
+*/
+BLS_DLL_API int blsFastAggregateVerify(const blsSignature *sig, const blsPublicKey *pubVec, mclSize n, const void *m, mclSize size);
+
+/*
+	public key with the precomputed coefficients of the Miller loop
+	use it to verify many signatures with the same public key
+*/
+typedef struct blsPublicKeyPrecomputed blsPublicKeyPrecomputed;
+/*
+	return a new blsPublicKeyPrecomputed of pub if success else NULL
+	@note call blsPublicKeyPrecomputedDestroy to free it
+*/
+BLS_DLL_API blsPublicKeyPrecomputed *blsPublicKeyPrecomputedCreate(const blsPublicKey *pub);
+BLS_DLL_API void blsPublicKeyPrecomputedDestroy(blsPublicKeyPrecomputed *ppub);
+// return 1 if valid ; same as blsVerify and blsVerifyHash
+BLS_DLL_API int blsVerifyPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const void *m, mclSize size);
+BLS_DLL_API int blsVerifyHashPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const void *h, mclSize size);
+
+/*
+	msg = normalized H(m)
+	use msg to sign or verify many times with the same message without hashing m again
+*/
+BLS_DLL_API void blsMessagePrepare(blsMessage *msg, const void *m, mclSize size);
+// same as blsSign with m of msg
+BLS_DLL_API void blsSignPrepared(blsSignature *sig, const blsSecretKey *sec, const blsMessage *msg);
+// return 1 if valid ; same as blsVerify and blsVerifyPrecomputed with m of msg
+BLS_DLL_API int blsVerifyPrepared(const blsSignature *sig, const blsPublicKey *pub, const blsMessage *msg);
+BLS_DLL_API int blsVerifyPreparedPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const blsMessage *msg);
+
+/*
+	incremental version of blsVerifyAggregatedHashes
+	each added pair (pub, H(m)) is folded into a running Miller-loop product,
+	so blsAggregateVerifierFinalize does only ML(aggSig, Q) and the final exponentiation
+	a verifier is not thread safe ; use one per thread and merge them
+	@note do not check duplication of the messages
+*/
+typedef struct blsAggregateVerifier blsAggregateVerifier;
+// return a new empty verifier if success else NULL ; call blsAggregateVerifierDestroy to free it
+BLS_DLL_API blsAggregateVerifier *blsAggregateVerifierCreate(void);
+BLS_DLL_API void blsAggregateVerifierDestroy(blsAggregateVerifier *v);
+// remove all the pairs
+BLS_DLL_API void blsAggregateVerifierClear(blsAggregateVerifier *v);
+// return the number of the added pairs
+BLS_DLL_API mclSize blsAggregateVerifierGetSize(const blsAggregateVerifier *v);
+// add (pub, H(m)) where H is the hash of blsSign
+BLS_DLL_API void blsAggregateVerifierAdd(blsAggregateVerifier *v, const blsPublicKey *pub, const void *m, mclSize size);
+/*
+	add (pub, h) where h is the hash of blsSignHash
+	return 0 if success else -1 (then blsAggregateVerifierFinalize returns 0)
+*/
+BLS_DLL_API int blsAggregateVerifierAddHash(blsAggregateVerifier *v, const blsPublicKey *pub, const void *h, mclSize size);
+BLS_DLL_API void blsAggregateVerifierAddPrepared(blsAggregateVerifier *v, const blsPublicKey *pub, const blsMessage *msg);
+// add all the pairs of rhs to v ; rhs keeps its pairs
+BLS_DLL_API void blsAggregateVerifierMerge(blsAggregateVerifier *v, blsAggregateVerifier *rhs);
+/*
+	return 1 if e(aggSig, Q) = prod_i e(H(m_i), pub_i) for the added pairs else 0
+	return 0 if no pair is added
+	v keeps its pairs and more pairs can be added
+*/
+BLS_DLL_API int blsAggregateVerifierFinalize(blsAggregateVerifier *v, const blsSignature *aggSig);
+
+/*
+	asynchronous verification queue
+	the submitted jobs (sig, pub, m) are verified by the worker threads in batches,
+	each batch is checked by one randomized multi-pairing like blsVerifyBatch
+	and each job of a failed batch is checked by itself
+	a batch is started when maxBatchN jobs are pending or the oldest job has waited for maxDelayUsec
+	the queue is thread safe
+*/
+typedef struct blsVerifyQueue blsVerifyQueue;
+/*
+	called by a worker thread with self given to blsVerifyQueueSubmit
+	ret = 1 if valid else 0
+	@note do not call blsVerifyQueueFlush and blsVerifyQueueDestroy in the callback
+*/
+typedef void (*blsVerifyCallback)(void *self, int ret);
+enum {
+	BLS_VERIFY_QUEUE_HIST_N = 16
+};
+typedef struct {
+	uint64_t submitN; // the number of the submitted jobs
+	uint64_t doneN; // the number of the finished jobs
+	uint64_t batchN; // the number of the batches
+	uint64_t fallbackN; // the number of the failed batches checked job by job
+	mclSize pending; // the number of the jobs in the queue
+	mclSize maxPending;
+	// [i] = the number of the batches of size in [2^i, 2^(i+1)) ; the last one includes the larger ones
+	uint64_t batchSizeHist[BLS_VERIFY_QUEUE_HIST_N];
+	// [i] = the number of the batches started when the queue had [2^i, 2^(i+1)) jobs
+	uint64_t depthHist[BLS_VERIFY_QUEUE_HIST_N];
+} blsVerifyQueueStat;
+/*
+	return a new queue with threadN workers (blsGetThreadNum() if threadN = 0) if success else NULL
+	maxBatchN = 0 means 64
+	return NULL if there is no thread support
+	@note call blsVerifyQueueDestroy to free it
+*/
+BLS_DLL_API blsVerifyQueue *blsVerifyQueueCreate(mclSize threadN, mclSize maxBatchN, mclSize maxDelayUsec);
+// verify all the pending jobs and free vq
+BLS_DLL_API void blsVerifyQueueDestroy(blsVerifyQueue *vq);
+/*
+	copy sig, pub and m and queue them ; cb(self, ret) is called later
+	return 0 if success else -1
+*/
+BLS_DLL_API int blsVerifyQueueSubmit(blsVerifyQueue *vq, const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size, blsVerifyCallback cb, void *self);
+// verify the pending jobs without waiting for maxDelayUsec and wait for all the callbacks
+BLS_DLL_API void blsVerifyQueueFlush(blsVerifyQueue *vq);
+BLS_DLL_API void blsVerifyQueueGetStat(blsVerifyQueue *vq, blsVerifyQueueStat *stat);
+
+/*
+	a context owns a generator Q of G2 other than the one of blsInit and its precomputed tables
+	contexts with different generators can be used concurrently
+	a context uses the curve of blsInit ; destroy it before calling blsInit with another curve
+*/
+typedef struct blsContext blsContext;
+/*
+	return a new blsContext if success else NULL
+	gen is the generator of G2 (the default generator of blsInit if NULL)
+	fail if gen is zero or does not have the correct order
+	@note call blsContextDestroy to free it
+*/
+BLS_DLL_API blsContext *blsContextCreate(const blsPublicKey *gen);
+BLS_DLL_API void blsContextDestroy(blsContext *ctx);
+BLS_DLL_API void blsContextGetGeneratorOfG2(const blsContext *ctx, blsPublicKey *pub);
+BLS_DLL_API void blsContextGetPublicKey(const blsContext *ctx, blsPublicKey *pub, const blsSecretKey *sec);
+BLS_DLL_API void blsContextSign(const blsContext *ctx, blsSignature *sig, const blsSecretKey *sec, const void *m, mclSize size);
+// return 1 if valid
+BLS_DLL_API int blsContextVerify(const blsContext *ctx, const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size);
+BLS_DLL_API int blsContextFastAggregateVerify(const blsContext *ctx, const blsSignature *sig, const blsPublicKey *pubVec, mclSize n, const void *m, mclSize size);
+BLS_DLL_API int blsContextVerifyAggregatedHashes(const blsContext *ctx, const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n);
+
+/*
+	process-wide LRU cache of deserialized public keys keyed by the serialized bytes
+	a cached public key is deserialized and order-checked only once
+	the cache is thread safe and cleared by blsInit with another curve
+*/
+typedef struct {
+	uint64_t hit;
+	uint64_t miss;
+	uint64_t eviction;
+	mclSize n; // the number of cached public keys
+	mclSize byteSize; // estimated memory usage
+} blsPublicKeyCacheStat;
+/*
+	same as blsPublicKeyDeserialize but use the cache
+	the order is always checked regardless of blsPublicKeyVerifyOrder
+	the cache is keyed by buf and the serialization mode of mclBn_setETHserialization
+	return read byte size if success else 0
+*/
+BLS_DLL_API mclSize blsPublicKeyDeserializeCached(blsPublicKey *pub, const void *buf, mclSize bufSize);
+/*
+	verify sig with the serialized public key pubBuf and m
+	the precomputed public key is also cached
+	return 1 if valid
+*/
+BLS_DLL_API int blsVerifyCached(const blsSignature *sig, const void *pubBuf, mclSize pubBufSize, const void *m, mclSize size);
+// set the memory budget of the cache (default 32MiB) ; 0 disables it
+BLS_DLL_API void blsPublicKeyCacheSetMaxByteSize(mclSize maxByteSize);
+BLS_DLL_API void blsPublicKeyCacheClear(void);
+BLS_DLL_API void blsPublicKeyCacheGetStat(blsPublicKeyCacheStat *stat);
+
+/*
+	process-wide cache of the valid inputs of blsVerify, blsVerifyHash and blsVerifyAggregatedHashes(MT)
+	an input is stored as the 128-bit keyed hash of the signature, public keys and message,
+	so the same input seen again (e.g. by gossip) is accepted without pairings
+	the hash also covers the map-to mode and the DST of mcl and does not depend on the serialization mode,
+	so an input verified before blsSetMapToMode is not accepted after it
+	the mode is read by blsInit, blsSetMapToMode and blsVerifyCacheSetMaxByteSize,
+	so call blsVerifyCacheSetMaxByteSize after changing the mode or the DST by mcl directly
+	invalid results are not recorded
+	lookups are lock-free and the cache is cleared by blsInit with another curve
+*/
+typedef struct {
+	uint64_t hit;
+	uint64_t miss;
+	mclSize n; // the number of cached inputs
+	mclSize byteSize; // memory usage
+} blsVerifyCacheStat;
+/*
+	set the memory budget of the cache (default 0 ; disabled) and clear it
+	the cache is disabled if there is no CSPRNG
+*/
+BLS_DLL_API void blsVerifyCacheSetMaxByteSize(mclSize maxByteSize);
+BLS_DLL_API void blsVerifyCacheClear(void);
+BLS_DLL_API void blsVerifyCacheGetStat(blsVerifyCacheStat *stat);
+
+/*
+	public key registry file
+	a header with the curve, the unit size and the checksum, the validated and normalized public keys
+	and optionally their blsPublicKeyPrecomputed (tens of KiB per key)
+	the records are in the memory representation of this library,
+	so the file is only readable by the library built with the same curve, MCLBN_COMPILED_TIME_VAR and byte order
+*/
+typedef struct blsPublicKeyRegistry blsPublicKeyRegistry;
+enum {
+	BLS_REGISTRY_PRECOMPUTED = 1, // write : write blsPublicKeyPrecomputed too
+	BLS_REGISTRY_VERIFY_CHECKSUM = 2, // open : verify the checksum of the records
+	BLS_REGISTRY_HUGE_PAGE = 4 // open : advise the kernel to use huge pages for the mapping
+};
+/*
+	write pubVec[0, n) to path
+	return 0 if success else -1 (a public key is not on the curve or does not have the correct order, or an I/O error)
+*/
+BLS_DLL_API int blsPublicKeyRegistryWrite(const char *path, const blsPublicKey *pubVec, mclSize n, int flags);
+/*
+	map path read-only ; the processes opening the same file share the physical pages
+	the public keys are not checked again ; use BLS_REGISTRY_VERIFY_CHECKSUM to detect a broken file
+	return NULL if path is not a registry for the current curve and build
+	@note call blsPublicKeyRegistryClose to unmap it
+*/
+BLS_DLL_API blsPublicKeyRegistry *blsPublicKeyRegistryOpen(const char *path, int flags);
+BLS_DLL_API void blsPublicKeyRegistryClose(blsPublicKeyRegistry *reg);
+BLS_DLL_API mclSize blsPublicKeyRegistryGetSize(const blsPublicKeyRegistry *reg);
+// return the array of the public keys in the mapped file ; valid until blsPublicKeyRegistryClose
+BLS_DLL_API const blsPublicKey *blsPublicKeyRegistryGetPublicKeys(const blsPublicKeyRegistry *reg);
+// return the i-th precomputed public key in the mapped file or NULL if it is not written
+BLS_DLL_API const blsPublicKeyPrecomputed *blsPublicKeyRegistryGetPrecomputed(const blsPublicKeyRegistry *reg, mclSize i);
 
 // sub
 BLS_DLL_API void blsSecretKeySub(blsSecretKey *sec, const blsSecretKey *rhs);
@@ -22,7 +22,10 @@ enum {
 	IoHex = 16, // hexadecimal number
 	IoPrefix = 128, // append '0b'(bin) or '0x'(hex)
 	IoSerialize = 512,
-	IoFixedByteSeq = IoSerialize // fixed byte representation
+	IoFixedByteSeq = IoSerialize, // fixed byte representation
+	// the following are only for PublicKey and Signature (not in mcl)
+	IoSerializeUncompressed = 1 << 16, // affine x and y ; see blsPublicKeySerializeUncompressed
+	IoSerializeUncompressedTrusted = IoSerializeUncompressed | (1 << 17) // setStr does not check the point
 };
 
 /*
@@ -48,6 +51,24 @@ inline void init(int curve = mclBn_CurveFp254BNb, int compiledTimeVar = MCLBN_CO
 	if (blsInit(curve, compiledTimeVar) != 0) throw std::invalid_argument("blsInit");
 }
 inline size_t getOpUnitSize() { return blsGetOpUnitSize(); }
+// see blsSetMapToMode
+inline void setMapToMode(int mode)
+{
+	if (blsSetMapToMode(mode) != 0) throw std::invalid_argument("blsSetMapToMode");
+}
+/*
+	the library-wide pool shared by the MT methods ; see blsSetThreadNum
+	@note not thread safe
+*/
+inline void setThreadNum(size_t n)
+{
+	if (blsSetThreadNum(n) != 0) throw std::runtime_error("blsSetThreadNum");
+}
+inline size_t getThreadNum() { return blsGetThreadNum(); }
+inline void setExecutor(blsExecutor exec, void *self, size_t threadN)
+{
+	if (blsSetExecutor(exec, self, threadN) != 0) throw std::runtime_error("blsSetExecutor");
+}
 
 inline void getCurveOrder(std::string& str)
 {
@@ -79,17 +100,27 @@ class SecretKey;
 class PublicKey;
 class Signature;
 class Id;
+class PreparedPublicKey;
+class PreparedMessage;
+class LagrangeBasis;
+class PublicKeyRegistry;
+class Context;
+class AggregateVerifier;
+class VerifyQueue;
 
 typedef std::vector<SecretKey> SecretKeyVec;
 typedef std::vector<PublicKey> PublicKeyVec;
 typedef std::vector<Signature> SignatureVec;
 typedef std::vector<Id> IdVec;
 
+void signAll(SignatureVec& sigVec, const SecretKeyVec& secVec, const void *m, size_t size, size_t threadN);
+
 class Id {
 	blsId self_;
 	friend class PublicKey;
 	friend class SecretKey;
 	friend class Signature;
+	friend class LagrangeBasis;
 public:
 	Id(unsigned int id = 0)
 	{
@@ -144,11 +175,47 @@ public:
 	}
 };
 
+/*
+	Lagrange coefficients of a fixed set of ids
+	use it to recover many values from the same share-holders
+*/
+class LagrangeBasis {
+	blsLagrangeBasis *self_;
+	friend class SecretKey;
+	friend class PublicKey;
+	friend class Signature;
+	LagrangeBasis(const LagrangeBasis&);
+	void operator=(const LagrangeBasis&);
+	const blsLagrangeBasis *get(size_t n) const
+	{
+		if (self_ == 0 || n != size()) throw std::invalid_argument("LagrangeBasis:bad size");
+		return self_;
+	}
+public:
+	LagrangeBasis() : self_(0) {}
+	explicit LagrangeBasis(const IdVec& idVec) : self_(0) { set(idVec); }
+	~LagrangeBasis() { blsLagrangeBasisDestroy(self_); }
+	void set(const IdVec& idVec)
+	{
+		set(idVec.data(), idVec.size());
+	}
+	void set(const Id *idVec, size_t k)
+	{
+		blsLagrangeBasis *p = blsLagrangeBasisCreate(&idVec->self_, k);
+		if (p == 0) throw std::runtime_error("blsLagrangeBasisCreate:zero or same id");
+		blsLagrangeBasisDestroy(self_);
+		self_ = p;
+	}
+	size_t size() const { return self_ ? blsLagrangeBasisGetSize(self_) : 0; }
+};
+
 /*
 	s ; secret key
 */
 class SecretKey {
 	blsSecretKey self_;
+	friend class Context;
+	friend void signAll(SignatureVec& sigVec, const SecretKeyVec& secVec, const void *m, size_t size, size_t threadN);
 public:
 	bool operator==(const SecretKey& rhs) const
 	{
@@ -180,6 +247,7 @@ public:
 		int ret = mclBnFr_setStr(&self_.v, str.c_str(), str.size(), ioMode);
 		if (ret != 0) throw std::runtime_error("mclBnFr_setStr");
 	}
+#ifndef MCL_DONT_USE_CSPRNG
 	/*
 		initialize secretKey with random number
 	*/
@@ -188,6 +256,7 @@ public:
 		int ret = blsSecretKeySetByCSPRNG(&self_);
 		if (ret != 0) throw std::runtime_error("blsSecretKeySetByCSPRNG");
 	}
+#endif
 	/*
 		set secretKey with p[0, .., keySize) and set id = 0
 		@note the value must be less than r
@@ -216,6 +285,7 @@ public:
 		sign(sig, m.c_str(), m.size());
 	}
 	// sign hashed value
+	void sign(Signature& sig, const PreparedMessage& msg) const;
 	void signHash(Signature& sig, const void *h, size_t size) const;
 	void signHash(Signature& sig, const std::string& h) const
 	{
@@ -226,6 +296,7 @@ public:
 		pop = prv.sign(pub)
 	*/
 	void getPop(Signature& pop) const;
+#ifndef MCL_DONT_USE_CSPRNG
 	/*
 		make [s_0, ..., s_{k-1}] to prepare k-out-of-n secret sharing
 	*/
@@ -238,6 +309,7 @@ public:
 			msk[i].init();
 		}
 	}
+#endif
 	/*
 		set a secret key for id > 0 from msk
 	*/
@@ -253,6 +325,15 @@ public:
 		if (secVec.size() != idVec.size()) throw std::invalid_argument("SecretKey::recover");
 		recover(secVec.data(), idVec.data(), idVec.size());
 	}
+	/*
+		recover secretKey from secVec by the precomputed basis
+	*/
+	void recoverWithBasis(const SecretKeyVec& secVec, const LagrangeBasis& basis)
+	{
+		// get checks the size before secVec[0] is taken
+		const blsLagrangeBasis *p = basis.get(secVec.size());
+		blsSecretKeyRecoverWithBasis(&self_, &secVec[0].self_, p);
+	}
 	/*
 		add secret key
 	*/
@@ -267,6 +348,22 @@ public:
 		int ret = blsSecretKeyShare(&self_, &msk->self_, k, &id.self_);
 		if (ret != 0) throw std::runtime_error("blsSecretKeyShare");
 	}
+	/*
+		secVec[i].set(msk, idVec[i]) for all i at once
+	*/
+	static void shareBatch(SecretKeyVec& secVec, const SecretKeyVec& msk, const IdVec& idVec)
+	{
+		shareBatchMT(secVec, msk, idVec, 0);
+	}
+	// threadN = 0 means getThreadNum()
+	static void shareBatchMT(SecretKeyVec& secVec, const SecretKeyVec& msk, const IdVec& idVec, size_t threadN = 0)
+	{
+		if (msk.empty()) throw std::invalid_argument("SecretKey::shareBatch");
+		secVec.resize(idVec.size());
+		if (idVec.empty()) return;
+		int ret = blsSecretKeyShareBatchMT(&secVec[0].self_, &msk[0].self_, msk.size(), &idVec[0].self_, idVec.size(), threadN);
+		if (ret != 0) throw std::runtime_error("blsSecretKeyShareBatchMT");
+	}
 	void recover(const SecretKey *secVec, const Id *idVec, size_t n)
 	{
 		int ret = blsSecretKeyRecover(&self_, &secVec->self_, &idVec->self_, n);
@@ -281,6 +378,11 @@ class PublicKey {
 	blsPublicKey self_;
 	friend class SecretKey;
 	friend class Signature;
+	friend class PreparedPublicKey;
+	friend class PublicKeyRegistry;
+	friend class Context;
+	friend class AggregateVerifier;
+	friend class VerifyQueue;
 public:
 	bool operator==(const PublicKey& rhs) const
 	{
@@ -312,15 +414,38 @@ public:
 	void getStr(std::string& str, int ioMode = 0) const
 	{
 		str.resize(1024);
-		size_t n = mclBnG2_getStr(&str[0], str.size(), &self_.v, ioMode);
+		size_t n;
+		if (ioMode & IoSerializeUncompressed) {
+			n = blsPublicKeySerializeUncompressed(&str[0], str.size(), &self_);
+		} else {
+			n = mclBnG2_getStr(&str[0], str.size(), &self_.v, ioMode);
+		}
 		if (n == 0) throw std::runtime_error("mclBnG2_getStr");
 		str.resize(n);
 	}
 	void setStr(const std::string& str, int ioMode = 0)
 	{
+		if (ioMode & IoSerializeUncompressed) {
+			const int trusted = (ioMode & IoSerializeUncompressedTrusted) == IoSerializeUncompressedTrusted;
+			size_t n = blsPublicKeyDeserializeUncompressed(&self_, str.c_str(), str.size(), trusted);
+			if (n == 0 || n != str.size()) throw std::runtime_error("blsPublicKeyDeserializeUncompressed");
+			return;
+		}
 		int ret = mclBnG2_setStr(&self_.v, str.c_str(), str.size(), ioMode);
 		if (ret != 0) throw std::runtime_error("mclBnG2_setStr");
 	}
+	/*
+		deserialize buf through the public key cache
+		see blsPublicKeyDeserializeCached
+	*/
+	void deserializeCached(const void *buf, size_t bufSize)
+	{
+		if (blsPublicKeyDeserializeCached(&self_, buf, bufSize) == 0) throw std::runtime_error("blsPublicKeyDeserializeCached");
+	}
+	void deserializeCached(const std::string& buf)
+	{
+		deserializeCached(buf.c_str(), buf.size());
+	}
 	/*
 		set public for id from mpk
 	*/
@@ -336,6 +461,17 @@ public:
 		if (pubVec.size() != idVec.size()) throw std::invalid_argument("PublicKey::recover");
 		recover(pubVec.data(), idVec.data(), idVec.size());
 	}
+	void recoverWithBasis(const PublicKeyVec& pubVec, const LagrangeBasis& basis)
+	{
+		// get checks the size before pubVec[0] is taken
+		const blsLagrangeBasis *p = basis.get(pubVec.size());
+		blsPublicKeyRecoverWithBasis(&self_, &pubVec[0].self_, p);
+	}
+	void recoverMT(const PublicKeyVec& pubVec, const IdVec& idVec, size_t threadN = 0)
+	{
+		if (pubVec.size() != idVec.size()) throw std::invalid_argument("PublicKey::recoverMT");
+		recoverMT(pubVec.data(), idVec.data(), idVec.size(), threadN);
+	}
 	/*
 		add public key
 	*/
@@ -343,6 +479,13 @@ public:
 	{
 		blsPublicKeyAdd(&self_, &rhs.self_);
 	}
+	/*
+		set the sum of pubVec[0, n)
+	*/
+	void aggregate(const PublicKey *pubVec, size_t n)
+	{
+		blsPublicKeyAggregate(&self_, n == 0 ? 0 : &pubVec[0].self_, n);
+	}
 
 	// the following methods are for C api
 	void set(const PublicKey *mpk, size_t k, const Id& id)
@@ -350,11 +493,79 @@ public:
 		int ret = blsPublicKeyShare(&self_, &mpk->self_, k, &id.self_);
 		if (ret != 0) throw std::runtime_error("blsPublicKeyShare");
 	}
+	/*
+		pubVec[i].set(mpk, idVec[i]) for all i at once
+	*/
+	static void shareBatch(PublicKeyVec& pubVec, const PublicKeyVec& mpk, const IdVec& idVec)
+	{
+		shareBatchMT(pubVec, mpk, idVec, 0);
+	}
+	// threadN = 0 means getThreadNum()
+	static void shareBatchMT(PublicKeyVec& pubVec, const PublicKeyVec& mpk, const IdVec& idVec, size_t threadN = 0)
+	{
+		if (mpk.empty()) throw std::invalid_argument("PublicKey::shareBatch");
+		pubVec.resize(idVec.size());
+		if (idVec.empty()) return;
+		int ret = blsPublicKeyShareBatchMT(&pubVec[0].self_, &mpk[0].self_, mpk.size(), &idVec[0].self_, idVec.size(), threadN);
+		if (ret != 0) throw std::runtime_error("blsPublicKeyShareBatchMT");
+	}
 	void recover(const PublicKey *pubVec, const Id *idVec, size_t n)
 	{
 		int ret = blsPublicKeyRecover(&self_, &pubVec->self_, &idVec->self_, n);
 		if (ret != 0) throw std::runtime_error("blsPublicKeyRecover");
 	}
+	// threadN = 0 means getThreadNum()
+	void recoverMT(const PublicKey *pubVec, const Id *idVec, size_t n, size_t threadN = 0)
+	{
+		int ret = blsPublicKeyRecoverMT(&self_, &pubVec->self_, &idVec->self_, n, threadN);
+		if (ret != 0) throw std::runtime_error("blsPublicKeyRecoverMT");
+	}
+};
+
+/*
+	public key with the precomputed coefficients for repeated verification
+*/
+class PreparedPublicKey {
+	blsPublicKeyPrecomputed *self_;
+	friend class Signature;
+	PreparedPublicKey(const PreparedPublicKey&);
+	void operator=(const PreparedPublicKey&);
+public:
+	PreparedPublicKey() : self_(0) {}
+	explicit PreparedPublicKey(const PublicKey& pub) : self_(0) { set(pub); }
+	~PreparedPublicKey() { blsPublicKeyPrecomputedDestroy(self_); }
+	void set(const PublicKey& pub)
+	{
+		blsPublicKeyPrecomputed *p = blsPublicKeyPrecomputedCreate(&pub.self_);
+		if (p == 0) throw std::runtime_error("blsPublicKeyPrecomputedCreate");
+		blsPublicKeyPrecomputedDestroy(self_);
+		self_ = p;
+	}
+	bool isPrepared() const { return self_ != 0; }
+};
+
+/*
+	H(m) of a message m
+	use it to sign or verify many times with the same message
+*/
+class PreparedMessage {
+	blsMessage self_;
+	friend class SecretKey;
+	friend class Signature;
+	friend class AggregateVerifier;
+public:
+	// zero until set is called
+	PreparedMessage() { mclBnG1_clear(&self_.v); }
+	PreparedMessage(const void *m, size_t size) { set(m, size); }
+	explicit PreparedMessage(const std::string& m) { set(m); }
+	void set(const void *m, size_t size)
+	{
+		blsMessagePrepare(&self_, m, size);
+	}
+	void set(const std::string& m)
+	{
+		set(m.c_str(), m.size());
+	}
 };
 
 /*
@@ -363,6 +574,10 @@ public:
 class Signature {
 	blsSignature self_;
 	friend class SecretKey;
+	friend class Context;
+	friend class AggregateVerifier;
+	friend class VerifyQueue;
+	friend void signAll(SignatureVec& sigVec, const SecretKeyVec& secVec, const void *m, size_t size, size_t threadN);
 public:
 	bool operator==(const Signature& rhs) const
 	{
@@ -394,12 +609,23 @@ public:
 	void getStr(std::string& str, int ioMode = 0) const
 	{
 		str.resize(1024);
-		size_t n = mclBnG1_getStr(&str[0], str.size(), &self_.v, ioMode);
+		size_t n;
+		if (ioMode & IoSerializeUncompressed) {
+			n = blsSignatureSerializeUncompressed(&str[0], str.size(), &self_);
+		} else {
+			n = mclBnG1_getStr(&str[0], str.size(), &self_.v, ioMode);
+		}
 		if (n == 0) throw std::runtime_error("mclBnG1_getStr");
 		str.resize(n);
 	}
 	void setStr(const std::string& str, int ioMode = 0)
 	{
+		if (ioMode & IoSerializeUncompressed) {
+			const int trusted = (ioMode & IoSerializeUncompressedTrusted) == IoSerializeUncompressedTrusted;
+			size_t n = blsSignatureDeserializeUncompressed(&self_, str.c_str(), str.size(), trusted);
+			if (n == 0 || n != str.size()) throw std::runtime_error("blsSignatureDeserializeUncompressed");
+			return;
+		}
 		int ret = mclBnG1_setStr(&self_.v, str.c_str(), str.size(), ioMode);
 		if (ret != 0) throw std::runtime_error("mclBnG1_setStr");
 	}
@@ -419,10 +645,69 @@ public:
 	{
 		return verifyHash(pub, h.c_str(), h.size());
 	}
+	bool verify(const PreparedPublicKey& ppub, const void *m, size_t size) const
+	{
+		if (ppub.self_ == 0) throw std::invalid_argument("Signature::verify:not prepared");
+		return blsVerifyPrecomputed(&self_, ppub.self_, m, size) == 1;
+	}
+	bool verify(const PreparedPublicKey& ppub, const std::string& m) const
+	{
+		return verify(ppub, m.c_str(), m.size());
+	}
+	bool verify(const PublicKey& pub, const PreparedMessage& msg) const
+	{
+		return blsVerifyPrepared(&self_, &pub.self_, &msg.self_) == 1;
+	}
+	bool verify(const PreparedPublicKey& ppub, const PreparedMessage& msg) const
+	{
+		if (ppub.self_ == 0) throw std::invalid_argument("Signature::verify:not prepared");
+		return blsVerifyPreparedPrecomputed(&self_, ppub.self_, &msg.self_) == 1;
+	}
+	bool verifyHash(const PreparedPublicKey& ppub, const void *h, size_t size) const
+	{
+		if (ppub.self_ == 0) throw std::invalid_argument("Signature::verifyHash:not prepared");
+		return blsVerifyHashPrecomputed(&self_, ppub.self_, h, size) == 1;
+	}
+	bool verifyHash(const PreparedPublicKey& ppub, const std::string& h) const
+	{
+		return verifyHash(ppub, h.c_str(), h.size());
+	}
+	/*
+		verify self of the same message m signed by pubVec[0, n)
+	*/
+	bool fastAggregateVerify(const PublicKey *pubVec, size_t n, const void *m, size_t size) const
+	{
+		return blsFastAggregateVerify(&self_, &pubVec[0].self_, n, m, size) == 1;
+	}
+	bool fastAggregateVerify(const PublicKeyVec& pubVec, const std::string& m) const
+	{
+		return fastAggregateVerify(pubVec.data(), pubVec.size(), m.c_str(), m.size());
+	}
+	/*
+		verify with the serialized public key pubBuf through the public key cache
+	*/
+	bool verifyCached(const std::string& pubBuf, const std::string& m) const
+	{
+		return blsVerifyCached(&self_, pubBuf.c_str(), pubBuf.size(), m.c_str(), m.size()) == 1;
+	}
 	bool verifyAggregatedHashes(const PublicKey *pubVec, const void *hVec, size_t sizeofHash, size_t n) const
 	{
 		return blsVerifyAggregatedHashes(&self_, &pubVec[0].self_, hVec, sizeofHash, n) == 1;
 	}
+	// threadN = 0 means getThreadNum()
+	bool verifyAggregatedHashesMT(const PublicKey *pubVec, const void *hVec, size_t sizeofHash, size_t n, size_t threadN = 0) const
+	{
+		return blsVerifyAggregatedHashesMT(&self_, &pubVec[0].self_, hVec, sizeofHash, n, threadN) == 1;
+	}
+#ifndef MCL_DONT_USE_CSPRNG
+	/*
+		verify sigVec[i] with pubVec[i] and msgVec[i * msgSize, (i + 1) * msgSize) for i in [0, n) at once
+	*/
+	static bool verifyBatch(const Signature *sigVec, const PublicKey *pubVec, const void *msgVec, size_t msgSize, size_t n)
+	{
+		return blsVerifyBatch(&sigVec[0].self_, &pubVec[0].self_, msgVec, msgSize, n) == 1;
+	}
+#endif
 	/*
 		verify self(pop) with pub
 	*/
@@ -440,6 +725,17 @@ public:
 		if (sigVec.size() != idVec.size()) throw std::invalid_argument("Signature::recover");
 		recover(sigVec.data(), idVec.data(), idVec.size());
 	}
+	void recoverWithBasis(const SignatureVec& sigVec, const LagrangeBasis& basis)
+	{
+		// get checks the size before sigVec[0] is taken
+		const blsLagrangeBasis *p = basis.get(sigVec.size());
+		blsSignatureRecoverWithBasis(&self_, &sigVec[0].self_, p);
+	}
+	void recoverMT(const SignatureVec& sigVec, const IdVec& idVec, size_t threadN = 0)
+	{
+		if (sigVec.size() != idVec.size()) throw std::invalid_argument("Signature::recoverMT");
+		recoverMT(sigVec.data(), idVec.data(), idVec.size(), threadN);
+	}
 	/*
 		add signature
 	*/
@@ -447,6 +743,13 @@ public:
 	{
 		blsSignatureAdd(&self_, &rhs.self_);
 	}
+	/*
+		set the sum of sigVec[0, n)
+	*/
+	void aggregate(const Signature *sigVec, size_t n)
+	{
+		blsSignatureAggregate(&self_, n == 0 ? 0 : &sigVec[0].self_, n);
+	}
 
 	// the following methods are for C api
 	void recover(const Signature* sigVec, const Id *idVec, size_t n)
@@ -454,6 +757,181 @@ public:
 		int ret = blsSignatureRecover(&self_, &sigVec->self_, &idVec->self_, n);
 		if (ret != 0) throw std::runtime_error("blsSignatureRecover:same id");
 	}
+	// threadN = 0 means getThreadNum()
+	void recoverMT(const Signature* sigVec, const Id *idVec, size_t n, size_t threadN = 0)
+	{
+		int ret = blsSignatureRecoverMT(&self_, &sigVec->self_, &idVec->self_, n, threadN);
+		if (ret != 0) throw std::runtime_error("blsSignatureRecoverMT:same id");
+	}
+};
+
+/*
+	the public key cache used by PublicKey::deserializeCached and Signature::verifyCached
+*/
+inline void setPublicKeyCacheMaxByteSize(size_t maxByteSize) { blsPublicKeyCacheSetMaxByteSize(maxByteSize); }
+inline void clearPublicKeyCache() { blsPublicKeyCacheClear(); }
+inline void getPublicKeyCacheStat(blsPublicKeyCacheStat& stat) { blsPublicKeyCacheGetStat(&stat); }
+/*
+	the cache of the valid inputs of Signature::verify, verifyHash and verifyAggregatedHashes
+*/
+inline void setVerifyCacheMaxByteSize(size_t maxByteSize) { blsVerifyCacheSetMaxByteSize(maxByteSize); }
+inline void clearVerifyCache() { blsVerifyCacheClear(); }
+inline void getVerifyCacheStat(blsVerifyCacheStat& stat) { blsVerifyCacheGetStat(&stat); }
+
+/*
+	read-only public key registry file mapped by blsPublicKeyRegistryOpen
+	the public keys are not copied and valid while this object lives
+*/
+class PublicKeyRegistry {
+	blsPublicKeyRegistry *self_;
+	PublicKeyRegistry(const PublicKeyRegistry&);
+	void operator=(const PublicKeyRegistry&);
+public:
+	explicit PublicKeyRegistry(const std::string& path, int flags = 0)
+		: self_(blsPublicKeyRegistryOpen(path.c_str(), flags))
+	{
+		if (self_ == 0) throw std::runtime_error("blsPublicKeyRegistryOpen");
+	}
+	~PublicKeyRegistry() { blsPublicKeyRegistryClose(self_); }
+	size_t size() const { return blsPublicKeyRegistryGetSize(self_); }
+	const PublicKey& operator[](size_t i) const
+	{
+		return reinterpret_cast<const PublicKey*>(blsPublicKeyRegistryGetPublicKeys(self_))[i];
+	}
+	// write pubVec to path ; see blsPublicKeyRegistryWrite
+	static void write(const std::string& path, const PublicKeyVec& pubVec, int flags = 0)
+	{
+		const blsPublicKey *p = pubVec.empty() ? 0 : &pubVec[0].self_;
+		if (blsPublicKeyRegistryWrite(path.c_str(), p, pubVec.size(), flags) != 0) throw std::runtime_error("blsPublicKeyRegistryWrite");
+	}
+};
+
+/*
+	generator Q of G2 and its precomputed tables ; see blsContextCreate
+*/
+class Context {
+	blsContext *self_;
+	Context(const Context&);
+	void operator=(const Context&);
+	void init(const blsPublicKey *gen)
+	{
+		self_ = blsContextCreate(gen);
+		if (self_ == 0) throw std::runtime_error("blsContextCreate");
+	}
+public:
+	// use the default generator of the curve
+	Context() { init(0); }
+	explicit Context(const PublicKey& gen) { init(&gen.self_); }
+	~Context() { blsContextDestroy(self_); }
+	void getGeneratorOfG2(PublicKey& pub) const
+	{
+		blsContextGetGeneratorOfG2(self_, &pub.self_);
+	}
+	void getPublicKey(PublicKey& pub, const SecretKey& sec) const
+	{
+		blsContextGetPublicKey(self_, &pub.self_, &sec.self_);
+	}
+	void sign(Signature& sig, const SecretKey& sec, const void *m, size_t size) const
+	{
+		blsContextSign(self_, &sig.self_, &sec.self_, m, size);
+	}
+	void sign(Signature& sig, const SecretKey& sec, const std::string& m) const
+	{
+		sign(sig, sec, m.c_str(), m.size());
+	}
+	bool verify(const Signature& sig, const PublicKey& pub, const void *m, size_t size) const
+	{
+		return blsContextVerify(self_, &sig.self_, &pub.self_, m, size) == 1;
+	}
+	bool verify(const Signature& sig, const PublicKey& pub, const std::string& m) const
+	{
+		return verify(sig, pub, m.c_str(), m.size());
+	}
+	bool fastAggregateVerify(const Signature& sig, const PublicKey *pubVec, size_t n, const void *m, size_t size) const
+	{
+		return blsContextFastAggregateVerify(self_, &sig.self_, &pubVec[0].self_, n, m, size) == 1;
+	}
+	bool fastAggregateVerify(const Signature& sig, const PublicKeyVec& pubVec, const std::string& m) const
+	{
+		return fastAggregateVerify(sig, pubVec.data(), pubVec.size(), m.c_str(), m.size());
+	}
+};
+
+/*
+	incremental aggregate verification ; see blsAggregateVerifierCreate
+	not thread safe ; use one per thread and merge them
+*/
+class AggregateVerifier {
+	blsAggregateVerifier *self_;
+	AggregateVerifier(const AggregateVerifier&);
+	void operator=(const AggregateVerifier&);
+public:
+	AggregateVerifier()
+		: self_(blsAggregateVerifierCreate())
+	{
+		if (self_ == 0) throw std::runtime_error("blsAggregateVerifierCreate");
+	}
+	~AggregateVerifier() { blsAggregateVerifierDestroy(self_); }
+	void clear() { blsAggregateVerifierClear(self_); }
+	size_t size() const { return blsAggregateVerifierGetSize(self_); }
+	void add(const PublicKey& pub, const void *m, size_t size)
+	{
+		blsAggregateVerifierAdd(self_, &pub.self_, m, size);
+	}
+	void add(const PublicKey& pub, const std::string& m)
+	{
+		add(pub, m.c_str(), m.size());
+	}
+	void add(const PublicKey& pub, const PreparedMessage& msg)
+	{
+		blsAggregateVerifierAddPrepared(self_, &pub.self_, &msg.self_);
+	}
+	void addHash(const PublicKey& pub, const void *h, size_t size)
+	{
+		if (blsAggregateVerifierAddHash(self_, &pub.self_, h, size) != 0) throw std::runtime_error("bad h");
+	}
+	void addHash(const PublicKey& pub, const std::string& h)
+	{
+		addHash(pub, h.c_str(), h.size());
+	}
+	// add all the pairs of rhs
+	void merge(AggregateVerifier& rhs)
+	{
+		blsAggregateVerifierMerge(self_, rhs.self_);
+	}
+	bool finalize(const Signature& aggSig)
+	{
+		return blsAggregateVerifierFinalize(self_, &aggSig.self_) == 1;
+	}
+};
+
+/*
+	asynchronous verification queue ; see blsVerifyQueueCreate
+	the destructor verifies all the pending jobs
+*/
+class VerifyQueue {
+	blsVerifyQueue *self_;
+	VerifyQueue(const VerifyQueue&);
+	void operator=(const VerifyQueue&);
+public:
+	// threadN = 0 means getThreadNum()
+	explicit VerifyQueue(size_t threadN = 0, size_t maxBatchN = 64, size_t maxDelayUsec = 1000)
+		: self_(blsVerifyQueueCreate(threadN, maxBatchN, maxDelayUsec))
+	{
+		if (self_ == 0) throw std::runtime_error("blsVerifyQueueCreate");
+	}
+	~VerifyQueue() { blsVerifyQueueDestroy(self_); }
+	// cb(self, ret) is called by a worker thread
+	void submit(const Signature& sig, const PublicKey& pub, const void *m, size_t size, blsVerifyCallback cb, void *self)
+	{
+		if (blsVerifyQueueSubmit(self_, &sig.self_, &pub.self_, m, size, cb, self) != 0) throw std::runtime_error("blsVerifyQueueSubmit");
+	}
+	void submit(const Signature& sig, const PublicKey& pub, const std::string& m, blsVerifyCallback cb, void *self)
+	{
+		submit(sig, pub, m.c_str(), m.size(), cb, self);
+	}
+	void flush() { blsVerifyQueueFlush(self_); }
+	void getStat(blsVerifyQueueStat& stat) { blsVerifyQueueGetStat(self_, &stat); }
 };
 
 /*
@@ -476,6 +954,10 @@ inline void SecretKey::sign(Signature& sig, const void *m, size_t size) const
 {
 	blsSign(&sig.self_, &self_, m, size);
 }
+inline void SecretKey::sign(Signature& sig, const PreparedMessage& msg) const
+{
+	blsSignPrepared(&sig.self_, &self_, &msg.self_);
+}
 inline void SecretKey::signHash(Signature& sig, const void *h, size_t size) const
 {
 	if (blsSignHash(&sig.self_, &self_, h, size) != 0) throw std::runtime_error("bad h");
@@ -489,6 +971,45 @@ inline void SecretKey::getPop(Signature& pop) const
 	sign(pop, m);
 }
 
+/*
+	out = sum of sigVec (resp. pubVec)
+*/
+inline void aggregate(Signature& out, const SignatureVec& sigVec)
+{
+	out.aggregate(sigVec.data(), sigVec.size());
+}
+inline void aggregate(PublicKey& out, const PublicKeyVec& pubVec)
+{
+	out.aggregate(pubVec.data(), pubVec.size());
+}
+
+/*
+	sign m with all secVec ; sigVec[i] = secVec[i].sign(m)
+	H(m) and its table are computed once
+	threadN = 0 means getThreadNum()
+*/
+inline void signAll(SignatureVec& sigVec, const SecretKeyVec& secVec, const void *m, size_t size, size_t threadN = 0)
+{
+	sigVec.resize(secVec.size());
+	if (secVec.empty()) return;
+	blsSignMultiKeyMT(&sigVec[0].self_, &secVec[0].self_, secVec.size(), m, size, threadN);
+}
+inline void signAll(SignatureVec& sigVec, const SecretKeyVec& secVec, const std::string& m, size_t threadN = 0)
+{
+	signAll(sigVec, secVec, m.c_str(), m.size(), threadN);
+}
+
+#ifndef MCL_DONT_USE_CSPRNG
+/*
+	verify sigVec[i] with pubVec[i] and msgVec[i * msgSize, (i + 1) * msgSize) at once
+*/
+inline bool verifyBatch(const SignatureVec& sigVec, const PublicKeyVec& pubVec, const void *msgVec, size_t msgSize)
+{
+	if (sigVec.size() != pubVec.size()) throw std::invalid_argument("verifyBatch");
+	return Signature::verifyBatch(sigVec.data(), pubVec.data(), msgVec, msgSize, sigVec.size());
+}
+#endif
+
 /*
 	make pop from msk and mpk
 */
@@ -83,13 +83,13 @@ int share(size_t n, size_t k)
 	load(sec, secFile);
 	bls::SecretKeyVec msk;
 	sec.getMasterSecretKey(msk, k);
-	bls::SecretKeyVec secVec(n);
+	bls::SecretKeyVec secVec;
 	bls::IdVec ids(n);
 	for (size_t i = 0; i < n; i++) {
 		int id = i + 1;
 		ids[i] = id;
-		secVec[i].set(msk, id);
 	}
+	bls::SecretKey::shareBatchMT(secVec, msk, ids);
 	for (size_t i = 0; i < n; i++) {
 		save(secFile, secVec[i], ids[i]);
 		bls::PublicKey pub;
@@ -4,6 +4,25 @@
 #include <bls/bls.h>
 
 #include "../mcl/src/bn_c_impl.hpp"
+#include <cybozu/xorshift.hpp>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <new>
+#include "bls_thread.hpp"
+#ifdef BLS_USE_STD_THREAD
+	#include <mutex>
+	#include <condition_variable>
+	#include <deque>
+	#include <chrono>
+	#include <algorithm>
+#endif
+#include "bls_poly.hpp"
+#include "bls_mmap.hpp"
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+	#include "bls_cache.hpp"
+	#define BLS_USE_CACHE
+#endif
 
 /*
 	BLS signature
@@ -16,49 +35,491 @@
 	verify ; e(sQ, H(m)) = e(Q, s H(m))
 */
 
-static G2 g_Q;
+static int g_curveType = -1; // the curve of blsInit
 const size_t maxQcoeffN = 128;
-static mcl::FixedArray<Fp6, maxQcoeffN> g_Qcoeff; // precomputed Q
-inline const G2& getQ() { return g_Q; }
-inline const mcl::FixedArray<Fp6, maxQcoeffN>& getQcoeff() { return g_Qcoeff; }
+/*
+	the number of pairs evaluated in one loop by MillerLoopVec
+	a larger value shares more squarings but needs more memory for precomputed Q
+*/
+static const size_t MillerLoopVecMaxN = 16;
+/*
+	getLagrangeCoeff uses the subproduct tree if k >= lagrangeTreeMinN
+	the naive O(k^2) loop is as fast as the tree up to about 4000 points by lagrangeTreeBenchTest
+*/
+static const size_t lagrangeTreeMinN = 4096;
+// mulVec uses the bucket method if n >= mulVecMinN
+static const size_t mulVecMinN = 32;
+// the minimum number of points added by a thread in sumPoints
+static const size_t sumMinTaskN = 256;
+// the number of ids evaluated together by blsSecretKeyShareBatch and the minimum number per thread
+static const size_t shareInterleaveN = 4;
+static const size_t shareMinTaskN = 64;
+// the minimum number of ids per thread in blsPublicKeyShareBatch
+static const size_t pubShareMinTaskN = 4;
+// blsSignMultiKey uses a window table of H(m) if n >= signTblMinN
+static const size_t signTblMinN = 4;
+static const size_t signMinTaskN = 16;
+// the minimum number of elements per thread in blsPublicKeyDeserializeBatch and blsSignatureDeserializeBatch
+static const size_t deserializeMinTaskN = 4;
+/*
+	the smallest prime factor of the cofactor of G1 (G2) of the current curve
+	1 means the cofactor is 1 and 2 is the worst case for an unknown curve
+*/
+static uint32_t g_G1CofactorMinPrime = 2;
+static uint32_t g_G2CofactorMinPrime = 2;
+// the security parameter of bls*AreValidOrderBatch if secBit = 0
+static const size_t orderBatchDefaultSecBit = 128;
+// the default memory budget of the public key cache
+static const size_t publicKeyCacheDefaultByteSize = 32 * 1024 * 1024;
 
-int blsInitNotThreadSafe(int curve, int compiledTimeVar)
+/*
+	y[i] = normalized x[i] for i in [0, n)
+	all the z are inverted by one inversion (Montgomery's trick)
+	y may be equal to x
+*/
+template<class G>
+void normalizeVec(G *y, const G *x, size_t n)
+{
+	typedef typename G::Fp F;
+	if (n == 0) return;
+	// tbl[i] = prod_{j <= i, x[j] != 0} x[j].z
+	std::vector<F> tbl(n);
+	F t = 1;
+	for (size_t i = 0; i < n; i++) {
+		if (!x[i].isZero()) F::mul(t, t, x[i].z);
+		tbl[i] = t;
+	}
+	F::inv(t, t);
+	const bool isJacobi = G::mode_ == mcl::ec::Jacobi;
+	for (size_t i = n; i-- > 0;) {
+		if (x[i].isZero()) {
+			y[i].clear();
+			continue;
+		}
+		// zinv = 1 / x[i].z and t = 1 / tbl[i - 1]
+		F zinv;
+		if (i > 0) {
+			F::mul(zinv, t, tbl[i - 1]);
+			F::mul(t, t, x[i].z);
+		} else {
+			zinv = t;
+		}
+		if (isJacobi) {
+			F zinv2;
+			F::sqr(zinv2, zinv);
+			F::mul(y[i].x, x[i].x, zinv2);
+			F::mul(zinv2, zinv2, zinv);
+			F::mul(y[i].y, x[i].y, zinv2);
+		} else {
+			F::mul(y[i].x, x[i].x, zinv);
+			F::mul(y[i].y, x[i].y, zinv);
+		}
+		y[i].z = 1;
+	}
+}
+
+// return the c bits of x[0, n) from the pos-th bit
+inline size_t getDigit(const mcl::fp::Unit *x, size_t n, size_t pos, size_t c)
 {
-	int ret = mclBn_init(curve, compiledTimeVar);
-	if (ret < 0) return ret;
-	bool b;
+	const size_t unitBitSize = sizeof(mcl::fp::Unit) * 8;
+	const size_t q = pos / unitBitSize;
+	const size_t r = pos % unitBitSize;
+	if (q >= n) return 0;
+	mcl::fp::Unit v = x[q] >> r;
+	if (r + c > unitBitSize && q + 1 < n) v |= x[q + 1] << (unitBitSize - r);
+	return size_t(v & ((mcl::fp::Unit(1) << c) - 1));
+}
+
+// return the bit length of x[0, n)
+inline size_t getBitLen(const mcl::fp::Unit *x, size_t n)
+{
+	const size_t unitBitSize = sizeof(mcl::fp::Unit) * 8;
+	for (size_t i = n; i > 0; i--) {
+		mcl::fp::Unit v = x[i - 1];
+		if (v == 0) continue;
+		size_t len = (i - 1) * unitBitSize;
+		while (v) {
+			len++;
+			v >>= 1;
+		}
+		return len;
+	}
+	return 0;
+}
+
+inline size_t getBitLen(const Fr& x)
+{
+	mcl::fp::Block b;
+	x.getBlock(b);
+	return getBitLen(b.p, b.n);
+}
+
+/*
+	fixed-base window table of P for the constant-time multiplication
+	tbl[i * ctTblHalfN + j] = (2j + 1) 2^(ctTblW i) P is normalized for i in [0, winN), j in [0, ctTblHalfN)
+*/
+static const size_t ctTblW = 4;
+static const size_t ctTblHalfN = size_t(1) << (ctTblW - 1);
+static const size_t maxCtTblWinN = (384 + 1 + ctTblW - 1) / ctTblW;
+// the number of windows for s + r < 2r
+inline size_t getCtTblWinN() { return (Fr::getBitSize() + 1 + ctTblW - 1) / ctTblW; }
+
+template<class G>
+void initCtTbl(G *tbl, const G& P, size_t winN)
+{
+	G T, P2, Pi = P;
+	for (size_t i = 0; i < winN; i++) {
+		T = Pi;
+		G::dbl(P2, Pi);
+		tbl[i * ctTblHalfN] = T;
+		for (size_t j = 1; j < ctTblHalfN; j++) {
+			T += P2;
+			tbl[i * ctTblHalfN + j] = T;
+		}
+		for (size_t j = 0; j < ctTblW; j++) {
+			G::dbl(Pi, Pi);
+		}
+	}
+	normalizeVec(tbl, tbl, winN * ctTblHalfN);
+}
+
+// return all one bits if x == y else 0 in constant time
+inline mcl::fp::Unit getEqualMask(size_t x, size_t y)
+{
+	const mcl::fp::Unit t = mcl::fp::Unit(x ^ y);
+	return mcl::fp::Unit(0) - ((~t & (t - 1)) >> (sizeof(mcl::fp::Unit) * 8 - 1));
+}
+
+// z = x if mask is all one bits ; mask is all one bits or 0
+template<class T>
+void cmovCT(T& z, const T& x, mcl::fp::Unit mask)
+{
+	const size_t n = sizeof(T) / sizeof(mcl::fp::Unit);
+	mcl::fp::Unit *pz = (mcl::fp::Unit*)&z;
+	const mcl::fp::Unit *px = (const mcl::fp::Unit*)&x;
+	for (size_t i = 0; i < n; i++) {
+		pz[i] = (pz[i] & ~mask) | (px[i] & mask);
+	}
+}
+
+/*
+	z = s P by tbl of initCtTbl in constant time
+	s is made odd by adding r if necessary
+	and recoded into the odd digits d_i in [-(2^w - 1), 2^w - 1] so that no digit is zero
+	d_i = 2 v_i + 1 - 2^w for i < winN - 1 and d_i = 2 v_i + 1 for the last i
+	where v_i is the w bits of s from the (w i + 1)-th bit
+*/
+template<class G>
+void mulCtTbl(G& z, const G *tbl, size_t winN, const Fr& s)
+{
+	typedef mcl::fp::Unit Unit;
+	mcl::fp::Block sb, rb;
+	s.getBlock(sb);
+	const Fr m1 = -1;
+	m1.getBlock(rb);
+	const size_t n = sb.n;
+	// t = s + r if s is even else s ; r = (r - 1) + 1
+	Unit t[mcl::fp::maxUnitSize + 1];
+	const Unit mask = (sb.p[0] & 1) - 1;
+	Unit c = mask & 1;
+	for (size_t i = 0; i < n; i++) {
+		const Unit x = sb.p[i];
+		const Unit y = x + (rb.p[i] & mask);
+		const Unit c1 = y < x;
+		t[i] = y + c;
+		c = c1 | (t[i] < y);
+	}
+	t[n] = c;
+	const Unit halfMask = ctTblHalfN - 1;
+	const size_t unitN = sizeof(G) / sizeof(Unit);
+	for (size_t i = 0; i < winN; i++) {
+		const Unit v = getDigit(t, n + 1, ctTblW * i + 1, ctTblW);
+		Unit negMask = 0;
+		if (i < winN - 1) {
+			negMask = (v >> (ctTblW - 1)) - 1;
+		}
+		const size_t idx = size_t((v & halfMask) ^ (negMask & halfMask));
+		// P = tbl[i * ctTblHalfN + idx]
+		G P;
+		Unit *pP = (Unit*)&P;
+		for (size_t j = 0; j < unitN; j++) {
+			pP[j] = 0;
+		}
+		const G *row = &tbl[i * ctTblHalfN];
+		for (size_t j = 0; j < ctTblHalfN; j++) {
+			cmovCT(P, row[j], getEqualMask(j, idx));
+		}
+		G negP;
+		G::neg(negP, P);
+		cmovCT(P, negP, negMask);
+		if (i == 0) {
+			z = P;
+		} else {
+			z += P;
+		}
+	}
+}
+
+/*
+	the generator Q of G2 and its precomputed tables
+	blsInit sets up the default context g_ctx
+*/
+struct blsContext {
+	G2 Q;
+	mcl::FixedArray<Fp6, maxQcoeffN> Qcoeff; // precomputed Q
+	mcl::FixedArray<G2, maxCtTblWinN * ctTblHalfN> QTbl; // fixed-base table of Q for blsGetPublicKey
+};
+
+static blsContext g_ctx;
+inline const G2& getQ() { return g_ctx.Q; }
+inline const mcl::FixedArray<Fp6, maxQcoeffN>& getQcoeff() { return g_ctx.Qcoeff; }
+
+// FNV-1a of 64-bit words
+class Fnv64 {
+	uint64_t h_;
+public:
+	Fnv64() : h_(0xcbf29ce484222325ULL) {}
+	void update(const void *buf, size_t n)
+	{
+		const uint8_t *p = (const uint8_t*)buf;
+		while (n > 0) {
+			uint64_t v = 0;
+			const size_t m = n < 8 ? n : 8;
+			memcpy(&v, p, m);
+			h_ = (h_ ^ v) * 0x100000001b3ULL;
+			p += m;
+			n -= m;
+		}
+	}
+	uint64_t get() const { return h_; }
+};
+
+/*
+	check the first entry 2^(wi) Q and the last entry (2^w - 1) 2^(wi) Q of each window i of ctx.QTbl
+	the other entries are not checked here but by the hash in loadStaticTbl
+*/
+static bool isValidQTbl(const blsContext& ctx)
+{
+	const size_t winN = getCtTblWinN();
+	G2 P = ctx.Q, T;
+	for (size_t i = 0; i < winN; i++) {
+		if (P != ctx.QTbl[i * ctTblHalfN]) return false;
+		T = P;
+		for (size_t j = 0; j < ctTblW; j++) {
+			G2::dbl(P, P);
+		}
+		G2::sub(T, P, T);
+		if (T != ctx.QTbl[i * ctTblHalfN + ctTblHalfN - 1]) return false;
+	}
+	return true;
+}
+
+/*
+	static tables of Q generated by gen_tbl (make gen_tbl)
+	qcoeff-<curve>.hpp : precomputed Miller-loop coefficients of Q
+	qtbl-<curve>.hpp : fixed-base table of Q whose first entry is Q and Fnv64 of the two tables
+	the values are 64-bit words of the Montgomery form with R = 2^(64 N),
+	which is also R of 32-bit units, so the tables are used for both unit sizes
+*/
+#ifndef BLS_DONT_USE_STATIC_TBL
+	#if MCL_SIZEOF_UNIT == 8 || MCL_SIZEOF_UNIT == 4
+		#define BLS_USE_STATIC_TBL_BN254
+		#ifdef __has_include
+			#if __has_include("./qcoeff-bls12_381.hpp") && __has_include("./qtbl-bls12_381.hpp")
+				#define BLS_USE_STATIC_TBL_BLS12_381
+			#endif
+			#if __has_include("./qcoeff-bn381_1.hpp") && __has_include("./qtbl-bn381_1.hpp")
+				#define BLS_USE_STATIC_TBL_BN381_1
+			#endif
+		#endif
+	#endif
+#endif
 
+// set the default generator of the curve to Q
+static bool initQ(G2& Q, int curve)
+{
+	bool b;
 	if (curve == MCL_BN254) {
 		const char *Qx_BN254 = "11ccb44e77ac2c5dc32a6009594dbe331ec85a61290d6bbac8cc7ebb2dceb128 f204a14bbdac4a05be9a25176de827f2e60085668becdd4fc5fa914c9ee0d9a";
 		const char *Qy_BN254 = "7c13d8487903ee3c1c5ea327a3a52b6cc74796b1760d5ba20ed802624ed19c8 8f9642bbaacb73d8c89492528f58932f2de9ac3e80c7b0e41f1a84f1c40182";
-		g_Q.x.setStr(&b, Qx_BN254, 16);
-		g_Q.y.setStr(&b, Qy_BN254, 16);
-		g_Q.z = 1;
+		Q.x.setStr(&b, Qx_BN254, 16);
+		if (!b) return false;
+		Q.y.setStr(&b, Qy_BN254, 16);
+		Q.z = 1;
 	} else {
-		mapToG2(&b, g_Q, 1);
+		mapToG2(&b, Q, 1);
 	}
-	if (!b) return -100;
-	if (curve == MCL_BN254) {
-		#include "./qcoeff-bn254.hpp"
-		g_Qcoeff.resize(BN::param.precomputedQcoeffSize);
-		assert(g_Qcoeff.size() == CYBOZU_NUM_OF_ARRAY(QcoeffTblBN254));
-		for (size_t i = 0; i < g_Qcoeff.size(); i++) {
-			Fp6& x6 = g_Qcoeff[i];
-			for (size_t j = 0; j < 6; j++) {
-				Fp& x = x6.getFp0()[j];
-				mcl::fp::Unit *p = const_cast<mcl::fp::Unit*>(x.getUnit());
-				for (size_t k = 0; k < 4; k++) {
-					p[k] = QcoeffTblBN254[i][j][k];
-				}
-			}
+	return b;
+}
+
+#if MCL_SIZEOF_UNIT == 8 || MCL_SIZEOF_UNIT == 4
+// set n 64-bit words p to x ; a word is split into two units if a unit is 32-bit
+static void setUnit(Fp& x, const uint64_t *p, size_t n)
+{
+	mcl::fp::Unit *q = const_cast<mcl::fp::Unit*>(x.getUnit());
+	for (size_t i = 0; i < n; i++) {
+#if MCL_SIZEOF_UNIT == 8
+		q[i] = p[i];
+#else
+		q[i * 2] = mcl::fp::Unit(p[i]);
+		q[i * 2 + 1] = mcl::fp::Unit(p[i] >> 32);
+#endif
+	}
+}
+
+/*
+	load ctx.Q, ctx.Qcoeff and ctx.QTbl from the static tables
+	hash is Fnv64 of QTbl and Qcoeff written by gen_tbl, which binds Qcoeff to Q = QTbl[0]
+	and rejects a Qcoeff of another run or a broken file
+	return true if they are consistent with the current curve
+*/
+template<size_t N>
+static bool loadStaticTbl(blsContext& ctx, const uint64_t (*Qcoeff)[6][N], size_t QcoeffN, const uint64_t (*QTbl)[4][N], size_t QTblN, uint64_t hash)
+{
+	// mclBn_getOpUnitSize is the number of 64-bit words for any unit size
+	if (mclBn_getOpUnitSize() != int(N) || !Fp::getOp().isMont) return false;
+	ctx.Qcoeff.resize(BN::param.precomputedQcoeffSize);
+	if (ctx.Qcoeff.size() != QcoeffN || ctx.QTbl.size() != QTblN) return false;
+	Fnv64 h;
+	h.update(QTbl, sizeof(QTbl[0]) * QTblN);
+	h.update(Qcoeff, sizeof(Qcoeff[0]) * QcoeffN);
+	if (h.get() != hash) return false;
+	for (size_t i = 0; i < QcoeffN; i++) {
+		Fp *x6 = ctx.Qcoeff[i].getFp0();
+		for (size_t j = 0; j < 6; j++) {
+			setUnit(x6[j], Qcoeff[i][j], N);
+		}
+	}
+	for (size_t i = 0; i < QTblN; i++) {
+		G2& P = ctx.QTbl[i];
+		Fp *tbl[] = { &P.x.a, &P.x.b, &P.y.a, &P.y.b };
+		for (size_t j = 0; j < 4; j++) {
+			setUnit(*tbl[j], QTbl[i][j], N);
+		}
+		P.z = 1;
+	}
+	ctx.Q = ctx.QTbl[0];
+	return isValidQTbl(ctx);
+}
+#endif
+
+// return false if there is no static table for the curve
+static bool loadStaticTbl(blsContext& ctx, int curve)
+{
+	switch (curve) {
+#ifdef BLS_USE_STATIC_TBL_BN254
+	case MCL_BN254:
+		{
+			#include "./qcoeff-bn254.hpp"
+			#include "./qtbl-bn254.hpp"
+			return loadStaticTbl(ctx, QcoeffTblBN254, CYBOZU_NUM_OF_ARRAY(QcoeffTblBN254), QTblBN254, CYBOZU_NUM_OF_ARRAY(QTblBN254), QTblHashBN254);
+		}
+#endif
+#ifdef BLS_USE_STATIC_TBL_BLS12_381
+	case MCL_BLS12_381:
+		{
+			#include "./qcoeff-bls12_381.hpp"
+			#include "./qtbl-bls12_381.hpp"
+			return loadStaticTbl(ctx, QcoeffTblBLS12_381, CYBOZU_NUM_OF_ARRAY(QcoeffTblBLS12_381), QTblBLS12_381, CYBOZU_NUM_OF_ARRAY(QTblBLS12_381), QTblHashBLS12_381);
 		}
+#endif
+#ifdef BLS_USE_STATIC_TBL_BN381_1
+	case MCL_BN381_1:
+		{
+			#include "./qcoeff-bn381_1.hpp"
+			#include "./qtbl-bn381_1.hpp"
+			return loadStaticTbl(ctx, QcoeffTblBN381_1, CYBOZU_NUM_OF_ARRAY(QcoeffTblBN381_1), QTblBN381_1, CYBOZU_NUM_OF_ARRAY(QTblBN381_1), QTblHashBN381_1);
+		}
+#endif
+	default:
+		return false;
+	}
+}
+
+static void setCofactorMinPrime(int curve)
+{
+	uint32_t q1 = 2, q2 = 2;
+	switch (curve) {
+	case MCL_BN254: q1 = 1; q2 = 13; break;
+	case MCL_BN381_1: q1 = 1; q2 = 97; break;
+	case MCL_BN462: q1 = 1; q2 = 997; break;
+	case MCL_BN_SNARK1: q1 = 1; q2 = 10069; break;
+	case MCL_BLS12_381: q1 = 3; q2 = 13; break;
+	default: break;
+	}
+	g_G1CofactorMinPrime = q1;
+	g_G2CofactorMinPrime = q2;
+}
+
+/*
+	set up ctx for the curve initialized by mclBn_init
+	use the default generator of the curve if gen = 0
+*/
+static int initContext(blsContext& ctx, int curve, const G2 *gen)
+{
+	ctx.QTbl.resize(getCtTblWinN() * ctTblHalfN);
+	if (gen) {
+		ctx.Q = *gen;
 	} else {
-		precomputeG2(&b, g_Qcoeff, getQ());
+		if (loadStaticTbl(ctx, curve)) {
+#ifndef NDEBUG
+			// the tables must agree with Q computed at runtime
+			G2 Q;
+			bool ok = initQ(Q, curve);
+			assert(ok && Q == ctx.Q);
+			(void)ok;
+			G1 P;
+			hashAndMapToG1(P, "Qcoeff", 6);
+			GT e1, e2;
+			BN::precomputedMillerLoop(e1, P, ctx.Qcoeff.data());
+			BN::finalExp(e1, e1);
+			BN::pairing(e2, P, Q);
+			assert(e1 == e2);
+#endif
+			return 0;
+		}
+		if (!initQ(ctx.Q, curve)) return -100;
 	}
+	bool b;
+	precomputeG2(&b, ctx.Qcoeff, ctx.Q);
 	if (!b) return -101;
+	initCtTbl(ctx.QTbl.data(), ctx.Q, getCtTblWinN());
 	return 0;
 }
 
+#ifdef BLS_USE_CACHE
+/*
+	normalized H(verifyCacheModeMsg), which changes with the map-to mode and the DST of mcl
+	set by blsInit, blsSetMapToMode and blsVerifyCacheSetMaxByteSize
+*/
+static G1 g_verifyCacheMode;
+
+static void initVerifyCacheMode()
+{
+	static const char verifyCacheModeMsg[] = "bls verify cache mode";
+	G1 P;
+	hashAndMapToG1(P, verifyCacheModeMsg, sizeof(verifyCacheModeMsg) - 1);
+	G1::normalize(g_verifyCacheMode, P);
+}
+#endif
+
+int blsInitNotThreadSafe(int curve, int compiledTimeVar)
+{
+	int ret = mclBn_init(curve, compiledTimeVar);
+	if (ret < 0) return ret;
+	g_curveType = curve;
+	setCofactorMinPrime(curve);
+#ifdef BLS_USE_CACHE
+	initVerifyCacheMode();
+#endif
+#ifndef BLS_MINIMUM_API
+	// the cached public keys and results belong to the previous curve
+	blsPublicKeyCacheClear();
+	blsVerifyCacheClear();
+#endif
+	return initContext(g_ctx, curve, 0);
+}
+
 #ifdef __EMSCRIPTEN__
 extern "C" BLS_DLL_API void *blsMalloc(size_t n)
 {
@@ -98,6 +559,30 @@ int blsInit(int curve, int compiledTimeVar)
 	return ret;
 }
 
+int blsSetMapToMode(int mode)
+{
+	int ret = mclBn_setMapToMode(mode);
+#ifdef BLS_USE_CACHE
+	initVerifyCacheMode();
+#endif
+	return ret;
+}
+
+int blsSetThreadNum(mclSize n)
+{
+	return bls::local::setThreadNum(n) ? 0 : -1;
+}
+
+mclSize blsGetThreadNum()
+{
+	return bls::local::getThreadNum(0);
+}
+
+int blsSetExecutor(blsExecutor exec, void *self, mclSize threadN)
+{
+	return bls::local::setExecutor(exec, self, threadN) ? 0 : -1;
+}
+
 static inline const mclBnG1 *cast(const G1* x) { return (const mclBnG1*)x; }
 static inline const mclBnG2 *cast(const G2* x) { return (const mclBnG2*)x; }
 
@@ -113,7 +598,7 @@ int blsSecretKeySetLittleEndian(blsSecretKey *sec, const void *buf, mclSize bufS
 
 void blsGetPublicKey(blsPublicKey *pub, const blsSecretKey *sec)
 {
-	mclBnG2_mul(&pub->v, cast(&getQ()), &sec->v);
+	mulCtTbl(*cast(&pub->v), g_ctx.QTbl.data(), getCtTblWinN(), *cast(&sec->v));
 }
 
 void blsSign(blsSignature *sig, const blsSecretKey *sec, const void *m, mclSize size)
@@ -138,7 +623,204 @@ bool isEqualTwoPairings(const G1& P1, const Fp6* Q1coeff, const G1& P2, const G2
 	return e.isOne();
 }
 
-int blsVerify(const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size)
+/*
+	f = prod_{i < n} ML(Pvec[i], Q_i) where QcoeffVec[i] is precomputed Q_i
+	all the line functions are evaluated in one loop
+	so the squaring of f is shared by the n pairs
+	Pvec[i] must be normalized and must not be zero
+*/
+static void precomputedMillerLoopVec(Fp12& f, const G1 *Pvec, const Fp6 *const *QcoeffVec, size_t n)
+{
+	using namespace mcl::bn::local;
+	G1 adjPvec[MillerLoopVecMaxN];
+	for (size_t i = 0; i < n; i++) {
+		makeAdjP(adjPvec[i], Pvec[i]);
+	}
+	size_t idx = 0;
+	Fp6 d, e;
+	for (size_t i = 0; i < n; i++) {
+		mulFp6cb_by_G1xy(d, QcoeffVec[i][idx], adjPvec[i]);
+		mulFp6cb_by_G1xy(e, QcoeffVec[i][idx + 1], Pvec[i]);
+		if (i == 0) {
+			mulSparse2(f, d, e);
+		} else {
+			mulSparse(f, d);
+			mulSparse(f, e);
+		}
+	}
+	idx += 2;
+	for (size_t j = 2; j < BN::param.siTbl.size(); j++) {
+		Fp12::sqr(f, f);
+		for (size_t i = 0; i < n; i++) {
+			mulFp6cb_by_G1xy(d, QcoeffVec[i][idx], adjPvec[i]);
+			mulSparse(f, d);
+		}
+		idx++;
+		if (BN::param.siTbl[j]) {
+			for (size_t i = 0; i < n; i++) {
+				mulFp6cb_by_G1xy(d, QcoeffVec[i][idx], Pvec[i]);
+				mulSparse(f, d);
+			}
+			idx++;
+		}
+	}
+	// the conjugation is a ring homomorphism, so it is applied to the product once
+	if (BN::param.z < 0) {
+		Fp6::neg(f.b, f.b);
+	}
+	if (BN::param.isBLS12) return;
+	for (size_t i = 0; i < n; i++) {
+		mulFp6cb_by_G1xy(d, QcoeffVec[i][idx], Pvec[i]);
+		mulFp6cb_by_G1xy(e, QcoeffVec[i][idx + 1], Pvec[i]);
+		mulSparse(f, d);
+		mulSparse(f, e);
+	}
+}
+
+/*
+	accumulate prod_i ML(P_i, Q_i)
+	the pairs are buffered and evaluated by precomputedMillerLoopVec every MillerLoopVecMaxN pairs
+	a pair with P_i = 0 or Q_i = 0 is skipped because ML(P_i, Q_i) = 1
+*/
+class MillerLoopVec {
+	G1 Pvec_[MillerLoopVecMaxN];
+	const Fp6 *QcoeffVec_[MillerLoopVecMaxN];
+	std::vector<Fp6> coeff_; // buffer of precomputed Q for add(P, Q)
+	size_t n_;
+	size_t coeffN_;
+	Fp12 f_;
+	bool isOne_;
+	void flush()
+	{
+		if (n_ == 0) return;
+		if (isOne_) {
+			precomputedMillerLoopVec(f_, Pvec_, QcoeffVec_, n_);
+			isOne_ = false;
+		} else {
+			Fp12 e;
+			precomputedMillerLoopVec(e, Pvec_, QcoeffVec_, n_);
+			f_ *= e;
+		}
+		n_ = 0;
+		coeffN_ = 0;
+	}
+	bool setP(const G1& P)
+	{
+		if (P.isZero()) return false;
+		G1::normalize(Pvec_[n_], P);
+		return true;
+	}
+	void next()
+	{
+		n_++;
+		if (n_ == MillerLoopVecMaxN) flush();
+	}
+public:
+	MillerLoopVec() : n_(0), coeffN_(0), isOne_(true) {}
+	// Qcoeff must be alive until get() is called
+	void add(const G1& P, const Fp6 *Qcoeff)
+	{
+		if (!setP(P)) return;
+		QcoeffVec_[n_] = Qcoeff;
+		next();
+	}
+	void add(const G1& P, const G2& Q)
+	{
+		if (Q.isZero() || !setP(P)) return;
+		const size_t coeffSize = BN::param.precomputedQcoeffSize;
+		if (coeff_.empty()) coeff_.resize(coeffSize * MillerLoopVecMaxN);
+		Fp6 *Qcoeff = &coeff_[coeffN_ * coeffSize];
+		precomputeG2(Qcoeff, Q);
+		coeffN_++;
+		QcoeffVec_[n_] = Qcoeff;
+		next();
+	}
+	// multiply the result by e
+	void mul(const Fp12& e)
+	{
+		if (isOne_) {
+			f_ = e;
+			isOne_ = false;
+		} else {
+			f_ *= e;
+		}
+	}
+	void get(Fp12& f)
+	{
+		flush();
+		if (isOne_) {
+			f = 1;
+		} else {
+			f = f_;
+		}
+	}
+};
+
+#ifdef BLS_USE_CACHE
+// the cache of the valid inputs of blsVerify, blsVerifyHash and blsVerifyAggregatedHashes
+static bls::local::DigestSet& getVerifyCache()
+{
+	static bls::local::DigestSet cache;
+	return cache;
+}
+
+/*
+	key of the verify cache ; tag | g_verifyCacheMode | sig | pubVec[0, n) | data
+	the points are in the normalized internal representation, which does not depend on the serialization mode of mcl,
+	and an input verified with other map-to modes does not hit
+	the fields are given to SipHash128 one by one without copying them into a buffer
+*/
+class VerifyCacheKey {
+	char tag_;
+	const blsSignature *sig_;
+	const blsPublicKey *pubVec_;
+	size_t n_;
+	const void *data_;
+	size_t dataSize_;
+	bool enabled_;
+	template<class G>
+	static void putPoint(bls::local::SipHash128& h, const G& x)
+	{
+		G t;
+		G::normalize(t, x);
+		if (t.isZero()) t.clear();
+		h.update(&t, sizeof(t));
+	}
+public:
+	VerifyCacheKey(char tag, const blsSignature *sig, const blsPublicKey *pubVec, size_t n, const void *data, size_t dataSize)
+		: tag_(tag)
+		, sig_(sig)
+		, pubVec_(pubVec)
+		, n_(n)
+		, data_(data)
+		, dataSize_(dataSize)
+		, enabled_(getVerifyCache().isEnabled())
+	{
+	}
+	void operator()(bls::local::SipHash128& h) const
+	{
+		h.update(&tag_, 1);
+		h.update(&g_verifyCacheMode, sizeof(g_verifyCacheMode));
+		putPoint(h, *cast(&sig_->v));
+		for (size_t i = 0; i < n_; i++) {
+			putPoint(h, *cast(&pubVec_[i].v));
+		}
+		if (dataSize_ > 0) h.update(data_, dataSize_);
+	}
+	bool isCached() const
+	{
+		return enabled_ && getVerifyCache().findBy(*this);
+	}
+	// record only the valid result
+	int record(int ret) const
+	{
+		if (ret == 1 && enabled_) getVerifyCache().insertBy(*this);
+		return ret;
+	}
+};
+#endif
+
+static int verify(const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size)
 {
 	G1 Hm;
 	hashAndMapToG1(Hm, m, size);
@@ -149,6 +831,17 @@ int blsVerify(const blsSignature *sig, const blsPublicKey *pub, const void *m, m
 	return isEqualTwoPairings(*cast(&sig->v), getQcoeff().data(), Hm, *cast(&pub->v));
 }
 
+int blsVerify(const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size)
+{
+#ifdef BLS_USE_CACHE
+	const VerifyCacheKey key('m', sig, pub, 1, m, size);
+	if (key.isCached()) return 1;
+	return key.record(verify(sig, pub, m, size));
+#else
+	return verify(sig, pub, m, size);
+#endif
+}
+
 mclSize blsIdSerialize(void *buf, mclSize maxBufSize, const blsId *id)
 {
 	return mclBnFr_serialize(buf, maxBufSize, &id->v);
@@ -189,117 +882,1416 @@ mclSize blsSignatureDeserialize(blsSignature *sig, const void *buf, mclSize bufS
 	return mclBnG1_deserialize(&sig->v, buf, bufSize);
 }
 
-int blsIdIsEqual(const blsId *lhs, const blsId *rhs)
+// write x to buf[0, n) where n = the byte size of Fp (Fp2)
+inline bool serializeFp(uint8_t *buf, size_t n, const Fp& x)
 {
-	return mclBnFr_isEqual(&lhs->v, &rhs->v);
+	return x.serialize(buf, n) == n;
 }
 
-int blsSecretKeyIsEqual(const blsSecretKey *lhs, const blsSecretKey *rhs)
+inline bool serializeFp(uint8_t *buf, size_t n, const Fp2& x)
 {
-	return mclBnFr_isEqual(&lhs->v, &rhs->v);
+	return serializeFp(buf, n / 2, x.a) && serializeFp(buf + n / 2, n / 2, x.b);
 }
 
-int blsPublicKeyIsEqual(const blsPublicKey *lhs, const blsPublicKey *rhs)
+inline bool deserializeFp(Fp& x, const uint8_t *buf, size_t n)
 {
-	return mclBnG2_isEqual(&lhs->v, &rhs->v);
+	return x.deserialize(buf, n) == n;
 }
 
-int blsSignatureIsEqual(const blsSignature *lhs, const blsSignature *rhs)
+inline bool deserializeFp(Fp2& x, const uint8_t *buf, size_t n)
 {
-	return mclBnG1_isEqual(&lhs->v, &rhs->v);
+	return deserializeFp(x.a, buf, n / 2) && deserializeFp(x.b, buf + n / 2, n / 2);
 }
 
-int blsSecretKeyShare(blsSecretKey *sec, const blsSecretKey* msk, mclSize k, const blsId *id)
+// return the byte size of x (or y) of G
+template<class G>
+size_t getCoordinateByteSize()
 {
-	return mclBn_FrEvaluatePolynomial(&sec->v, &msk->v, k, &id->v);
+	return sizeof(typename G::Fp) / sizeof(Fp) * mclBn_getG1ByteSize();
 }
 
-int blsPublicKeyShare(blsPublicKey *pub, const blsPublicKey *mpk, mclSize k, const blsId *id)
-{
-	return mclBn_G2EvaluatePolynomial(&pub->v, &mpk->v, k, &id->v);
+// buf = x || y of normalized P
+template<class G>
+size_t serializeUncompressed(void *buf, size_t maxBufSize, const G& P)
+{
+	const size_t n = getCoordinateByteSize<G>();
+	if (maxBufSize < n * 2) return 0;
+	uint8_t *p = (uint8_t*)buf;
+	if (P.isZero()) {
+		memset(p, 0, n * 2);
+		return n * 2;
+	}
+	G T;
+	G::normalize(T, P);
+	if (!serializeFp(p, n, T.x) || !serializeFp(p + n, n, T.y)) return 0;
+	return n * 2;
 }
 
-int blsSecretKeyRecover(blsSecretKey *sec, const blsSecretKey *secVec, const blsId *idVec, mclSize n)
-{
-	return mclBn_FrLagrangeInterpolation(&sec->v, &idVec->v, &secVec->v, n);
+template<class G>
+size_t deserializeUncompressed(G& P, const void *buf, size_t bufSize, bool trusted)
+{
+	const size_t n = getCoordinateByteSize<G>();
+	if (bufSize < n * 2) return 0;
+	const uint8_t *p = (const uint8_t*)buf;
+	bool isZero = true;
+	for (size_t i = 0; i < n * 2; i++) {
+		if (p[i]) {
+			isZero = false;
+			break;
+		}
+	}
+	if (isZero) {
+		P.clear();
+		return n * 2;
+	}
+	if (!deserializeFp(P.x, p, n) || !deserializeFp(P.y, p + n, n)) return 0;
+	P.z = 1;
+	if (!trusted && !P.isValid()) return 0;
+	return n * 2;
 }
 
-int blsPublicKeyRecover(blsPublicKey *pub, const blsPublicKey *pubVec, const blsId *idVec, mclSize n)
+mclSize blsPublicKeySerializeUncompressed(void *buf, mclSize maxBufSize, const blsPublicKey *pub)
 {
-	return mclBn_G2LagrangeInterpolation(&pub->v, &idVec->v, &pubVec->v, n);
+	return serializeUncompressed(buf, maxBufSize, *cast(&pub->v));
 }
 
-int blsSignatureRecover(blsSignature *sig, const blsSignature *sigVec, const blsId *idVec, mclSize n)
+mclSize blsSignatureSerializeUncompressed(void *buf, mclSize maxBufSize, const blsSignature *sig)
 {
-	return mclBn_G1LagrangeInterpolation(&sig->v, &idVec->v, &sigVec->v, n);
+	return serializeUncompressed(buf, maxBufSize, *cast(&sig->v));
 }
 
-void blsSecretKeyAdd(blsSecretKey *sec, const blsSecretKey *rhs)
+mclSize blsPublicKeyDeserializeUncompressed(blsPublicKey *pub, const void *buf, mclSize bufSize, int trusted)
 {
-	mclBnFr_add(&sec->v, &sec->v, &rhs->v);
+	return deserializeUncompressed(*cast(&pub->v), buf, bufSize, trusted != 0);
 }
 
-void blsPublicKeyAdd(blsPublicKey *pub, const blsPublicKey *rhs)
+mclSize blsSignatureDeserializeUncompressed(blsSignature *sig, const void *buf, mclSize bufSize, int trusted)
 {
-	mclBnG2_add(&pub->v, &pub->v, &rhs->v);
+	return deserializeUncompressed(*cast(&sig->v), buf, bufSize, trusted != 0);
 }
 
-void blsSignatureAdd(blsSignature *sig, const blsSignature *rhs)
+/*
+	T is blsPublicKey or blsSignature
+	deserialize(T*, buf, bufSize) is blsPublicKeyDeserialize or blsSignatureDeserialize
+*/
+template<class T, mclSize (*deserialize)(T*, const void*, mclSize)>
+struct DeserializeRange {
+	T *xVec;
+	int *okVec;
+	const uint8_t *buf;
+	size_t elemSize;
+	size_t *okNVec; // okNVec[idx] = the number of successful elements of the idx-th thread
+	void operator()(size_t idx, size_t begin, size_t end) const
+	{
+		size_t okN = 0;
+		for (size_t i = begin; i < end; i++) {
+			const bool ok = deserialize(&xVec[i], buf + i * elemSize, elemSize) == elemSize;
+			okVec[i] = ok ? 1 : 0;
+			okN += ok;
+		}
+		okNVec[idx] = okN;
+	}
+};
+
+template<class T, mclSize (*deserialize)(T*, const void*, mclSize)>
+mclSize deserializeBatch(T *xVec, int *okVec, const void *buf, mclSize elemSize, mclSize n, mclSize threadN)
 {
-	mclBnG1_add(&sig->v, &sig->v, &rhs->v);
+	if (n == 0) return 0;
+	threadN = bls::local::getThreadNum(threadN, n, deserializeMinTaskN);
+	std::vector<size_t> okNVec(threadN);
+	DeserializeRange<T, deserialize> f = { xVec, okVec, (const uint8_t*)buf, elemSize, okNVec.data() };
+	bls::local::parallelFor(f, n, threadN);
+	size_t okN = 0;
+	for (size_t i = 0; i < threadN; i++) {
+		okN += okNVec[i];
+	}
+	return okN;
 }
 
-void blsSignatureVerifyOrder(int doVerify)
+mclSize blsPublicKeyDeserializeBatchMT(blsPublicKey *pubVec, int *okVec, const void *buf, mclSize elemSize, mclSize n, mclSize threadN)
 {
-	mclBn_verifyOrderG1(doVerify);
+	return deserializeBatch<blsPublicKey, blsPublicKeyDeserialize>(pubVec, okVec, buf, elemSize, n, threadN);
 }
-void blsPublicKeyVerifyOrder(int doVerify)
+
+mclSize blsSignatureDeserializeBatchMT(blsSignature *sigVec, int *okVec, const void *buf, mclSize elemSize, mclSize n, mclSize threadN)
 {
-	mclBn_verifyOrderG2(doVerify);
+	return deserializeBatch<blsSignature, blsSignatureDeserialize>(sigVec, okVec, buf, elemSize, n, threadN);
 }
-int blsSignatureIsValidOrder(const blsSignature *sig)
+
+mclSize blsPublicKeyDeserializeBatch(blsPublicKey *pubVec, int *okVec, const void *buf, mclSize elemSize, mclSize n)
 {
-	return mclBnG1_isValidOrder(&sig->v);
+	return blsPublicKeyDeserializeBatchMT(pubVec, okVec, buf, elemSize, n, 0);
 }
-int blsPublicKeyIsValidOrder(const blsPublicKey *pub)
+
+mclSize blsSignatureDeserializeBatch(blsSignature *sigVec, int *okVec, const void *buf, mclSize elemSize, mclSize n)
 {
-	return mclBnG2_isValidOrder(&pub->v);
+	return blsSignatureDeserializeBatchMT(sigVec, okVec, buf, elemSize, n, 0);
 }
 
-#ifndef BLS_MINIMUM_API
-inline bool toG1(G1& Hm, const void *h, mclSize size)
+int blsIdIsEqual(const blsId *lhs, const blsId *rhs)
 {
-	Fp t;
-	t.setArrayMask((const char *)h, size);
-	bool b;
-	BN::mapToG1(&b, Hm, t);
-	return b;
+	return mclBnFr_isEqual(&lhs->v, &rhs->v);
 }
 
-int blsVerifyAggregatedHashes(const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n)
+int blsSecretKeyIsEqual(const blsSecretKey *lhs, const blsSecretKey *rhs)
 {
-	if (n == 0) return 0;
-	/*
-		e(aggSig, Q) = prod_i e(hVec[i], pubVec[i])
-		<=> finalExp(ML(-aggSig, Q) * prod_i ML(hVec[i], pubVec[i])) == 1
-	*/
-	GT e1, e2;
-	BN::precomputedMillerLoop(e1, -*cast(&aggSig->v), g_Qcoeff.data());
-	const char *ph = (const char*)hVec;
-	G1 h;
-	if (!toG1(h, &ph[0], sizeofHash)) return 0;
-	BN::millerLoop(e2, h, *cast(&pubVec[0].v));
-	e1 *= e2;
-	for (size_t i = 1; i < n; i++) {
-		if (!toG1(h, &ph[i * sizeofHash], sizeofHash)) return 0;
-		BN::millerLoop(e2, h, *cast(&pubVec[i].v));
-		e1 *= e2;
-	}
-	BN::finalExp(e1, e1);
-	return e1.isOne();
+	return mclBnFr_isEqual(&lhs->v, &rhs->v);
 }
 
-int blsSignHash(blsSignature *sig, const blsSecretKey *sec, const void *h, mclSize size)
+int blsPublicKeyIsEqual(const blsPublicKey *lhs, const blsPublicKey *rhs)
+{
+	return mclBnG2_isEqual(&lhs->v, &rhs->v);
+}
+
+int blsSignatureIsEqual(const blsSignature *lhs, const blsSignature *rhs)
+{
+	return mclBnG1_isEqual(&lhs->v, &rhs->v);
+}
+
+/*
+	y[i] = 1 / x[i] for i in [0, n) by one inversion (Montgomery's trick)
+	x[i] must not be zero and y may be equal to x
+*/
+template<class F>
+void invVec(F *y, const F *x, size_t n)
+{
+	if (n == 0) return;
+	// tbl[i] = prod_{j <= i} x[j]
+	std::vector<F> tbl(n);
+	tbl[0] = x[0];
+	for (size_t i = 1; i < n; i++) {
+		F::mul(tbl[i], tbl[i - 1], x[i]);
+	}
+	F t;
+	F::inv(t, tbl[n - 1]);
+	for (size_t i = n - 1; i > 0; i--) {
+		F xi = x[i];
+		F::mul(y[i], t, tbl[i - 1]);
+		F::mul(t, t, xi);
+	}
+	y[0] = t;
+}
+
+/*
+	d[i] = x[i] prod_{j != i} (x[j] - x[i]) for i in [0, k)
+	O(k^2) multiplications
+*/
+static void getLagrangeDenomNaive(Fr *d, const Fr *x, size_t k)
+{
+	for (size_t i = 0; i < k; i++) {
+		Fr b = x[i];
+		for (size_t j = 0; j < k; j++) {
+			if (j == i) continue;
+			b *= x[j] - x[i];
+		}
+		d[i] = b;
+	}
+}
+
+/*
+	d[i] = x[i] prod_{j != i} (x[j] - x[i]) = (-1)^(k-1) x[i] P'(x[i])
+	where P(X) = prod_j (X - x[j])
+	P and P'(x[i]) are computed by the subproduct tree in O(M(k) log k)
+*/
+static void getLagrangeDenomTree(Fr *d, const Fr *x, size_t k)
+{
+	typedef bls::local::SubproductTree<Fr> Tree;
+	const Tree tree(x, k);
+	const std::vector<Fr>& P = tree.getRoot();
+	std::vector<Fr> dP(k);
+	for (size_t i = 0; i < k; i++) {
+		Fr::mul(dP[i], P[i + 1], Fr(int64_t(i + 1)));
+	}
+	tree.eval(d, dP);
+	const bool neg = (k - 1) & 1;
+	for (size_t i = 0; i < k; i++) {
+		d[i] *= x[i];
+		if (neg) Fr::neg(d[i], d[i]);
+	}
+}
+
+/*
+	lambda[i] = prod_{j != i} x[j] / (x[j] - x[i]) for i in [0, k)
+	then f(0) = sum_i lambda[i] f(x[i]) for a polynomial f of degree < k
+	return false if x has zero or the same values
+*/
+static bool getLagrangeCoeff(Fr *lambda, const Fr *x, size_t k)
+{
+	if (k == 0) return false;
+	Fr a = x[0];
+	for (size_t i = 1; i < k; i++) {
+		a *= x[i];
+	}
+	if (a.isZero()) return false;
+	if (k < lagrangeTreeMinN) {
+		getLagrangeDenomNaive(lambda, x, k);
+	} else {
+		getLagrangeDenomTree(lambda, x, k);
+	}
+	// the denominator is zero iff x has the same values
+	for (size_t i = 0; i < k; i++) {
+		if (lambda[i].isZero()) return false;
+	}
+	invVec(lambda, lambda, k);
+	for (size_t i = 0; i < k; i++) {
+		lambda[i] *= a;
+	}
+	return true;
+}
+
+// the window size c of the bucket method minimizing (bitSize / c) * (n + 2^(c + 1))
+inline size_t getMulVecWindowSize(size_t n)
+{
+	size_t c = 0;
+	while ((size_t(1) << (c + 1)) <= n) c++;
+	if (c < 4) return 2;
+	if (c > 18) return 16;
+	return c - 2;
+}
+
+/*
+	winVec[w] = sum_i d_w(y_i) x_i for w in [begin, end)
+	where d_w(y) is the w-th c-bit digit of y
+	xVec must be normalized so that an addition to a bucket is a mixed addition
+*/
+template<class G>
+struct MulVecWindow {
+	const G *xVec;
+	const mcl::fp::Block *yVec;
+	size_t n;
+	size_t c;
+	G *winVec;
+	void operator()(size_t, size_t begin, size_t end) const
+	{
+		const size_t bucketN = (size_t(1) << c) - 1;
+		std::vector<G> bucket(bucketN);
+		for (size_t w = begin; w < end; w++) {
+			for (size_t j = 0; j < bucketN; j++) {
+				bucket[j].clear();
+			}
+			for (size_t i = 0; i < n; i++) {
+				size_t d = getDigit(yVec[i].p, yVec[i].n, w * c, c);
+				if (d) bucket[d - 1] += xVec[i];
+			}
+			// sum_j (j + 1) bucket[j]
+			G sum, t;
+			sum.clear();
+			t.clear();
+			for (size_t j = bucketN; j-- > 0;) {
+				sum += bucket[j];
+				t += sum;
+			}
+			winVec[w] = t;
+		}
+	}
+};
+
+/*
+	z = sum_{i < n} xVec[i] yVec[i]
+	use the bucket method (Pippenger) if n >= mulVecMinN
+	the windows are split into threadN threads (0 means blsGetThreadNum())
+	@note not constant time
+*/
+template<class G>
+void mulVec(G& z, const G *xVec, const Fr *yVec, size_t n, size_t threadN)
+{
+	if (n < mulVecMinN) {
+		G t;
+		z.clear();
+		for (size_t i = 0; i < n; i++) {
+			G::mul(t, xVec[i], yVec[i]);
+			z += t;
+		}
+		return;
+	}
+	std::vector<mcl::fp::Block> y(n);
+	// skip the windows above the longest y so that short coefficients are cheap
+	size_t maxBitLen = 0;
+	for (size_t i = 0; i < n; i++) {
+		yVec[i].getBlock(y[i]);
+		const size_t bitLen = getBitLen(y[i].p, y[i].n);
+		if (bitLen > maxBitLen) maxBitLen = bitLen;
+	}
+	if (maxBitLen == 0) {
+		z.clear();
+		return;
+	}
+	std::vector<G> x(n);
+	normalizeVec(x.data(), xVec, n);
+	const size_t c = getMulVecWindowSize(n);
+	const size_t winN = (maxBitLen + c - 1) / c;
+	std::vector<G> win(winN);
+	threadN = bls::local::getThreadNum(threadN, winN);
+	MulVecWindow<G> f = { x.data(), y.data(), n, c, win.data() };
+	bls::local::parallelFor(f, winN, threadN);
+	z = win[winN - 1];
+	for (size_t w = winN - 1; w > 0; w--) {
+		for (size_t j = 0; j < c; j++) {
+			G::dbl(z, z);
+		}
+		z += win[w - 1];
+	}
+}
+
+/*
+	out = sum_i lambda[i] vec[i]
+	lambda = 0 means lambda[i] = 1 (k = 1)
+*/
+template<class G, class T>
+void recoverPointWithCoeff(G& out, const T *vec, const Fr *lambda, size_t k, size_t threadN)
+{
+	if (lambda == 0) {
+		out = *cast(&vec[0].v);
+		return;
+	}
+	std::vector<G> P(k);
+	for (size_t i = 0; i < k; i++) {
+		P[i] = *cast(&vec[i].v);
+	}
+	mulVec(out, P.data(), lambda, k, threadN);
+}
+
+/*
+	out = sum_i lambda_i vec[i] where lambda_i is the Lagrange coefficient of idVec
+	return 0 if success else -1 ; same as mclBn_G{1,2}LagrangeInterpolation
+*/
+template<class G, class T>
+int recoverPoint(G& out, const T *vec, const blsId *idVec, size_t k, size_t threadN)
+{
+	if (k == 0) return -1;
+	if (k == 1) {
+		recoverPointWithCoeff(out, vec, 0, k, threadN);
+		return 0;
+	}
+	std::vector<Fr> x(k), lambda(k);
+	for (size_t i = 0; i < k; i++) {
+		x[i] = *cast(&idVec[i].v);
+	}
+	if (!getLagrangeCoeff(lambda.data(), x.data(), k)) return -1;
+	recoverPointWithCoeff(out, vec, lambda.data(), k, threadN);
+	return 0;
+}
+
+int blsSecretKeyShare(blsSecretKey *sec, const blsSecretKey* msk, mclSize k, const blsId *id)
+{
+	return mclBn_FrEvaluatePolynomial(&sec->v, &msk->v, k, &id->v);
+}
+
+/*
+	secVec[i] = c[0] + c[1] x_i + ... + c[k - 1] x_i^(k - 1) for i in [0, N) by Horner's method
+	the N independent chains are interleaved so that the multiplications are pipelined
+*/
+template<size_t N>
+void evaluateSecretKeyPolynomial(blsSecretKey *secVec, const Fr *c, size_t k, const blsId *idVec)
+{
+	Fr y[N];
+	const Fr *x[N];
+	for (size_t j = 0; j < N; j++) {
+		x[j] = cast(&idVec[j].v);
+		y[j] = c[k - 1];
+	}
+	for (size_t i = k - 1; i > 0; i--) {
+		for (size_t j = 0; j < N; j++) {
+			Fr::mul(y[j], y[j], *x[j]);
+			y[j] += c[i - 1];
+		}
+	}
+	for (size_t j = 0; j < N; j++) {
+		*cast(&secVec[j].v) = y[j];
+	}
+}
+
+struct SecretKeyShareRange {
+	blsSecretKey *secVec;
+	const Fr *c;
+	size_t k;
+	const blsId *idVec;
+	void operator()(size_t, size_t begin, size_t end) const
+	{
+		size_t i = begin;
+		for (; i + shareInterleaveN <= end; i += shareInterleaveN) {
+			evaluateSecretKeyPolynomial<shareInterleaveN>(secVec + i, c, k, idVec + i);
+		}
+		for (; i < end; i++) {
+			evaluateSecretKeyPolynomial<1>(secVec + i, c, k, idVec + i);
+		}
+	}
+};
+
+int blsSecretKeyShareBatchMT(blsSecretKey *secVec, const blsSecretKey *msk, mclSize k, const blsId *idVec, mclSize n, mclSize threadN)
+{
+	if (k == 0) return -1;
+	threadN = bls::local::getThreadNum(threadN, n, shareMinTaskN);
+	SecretKeyShareRange f = { secVec, cast(&msk->v), k, idVec };
+	bls::local::parallelFor(f, n, threadN);
+	return 0;
+}
+
+int blsSecretKeyShareBatch(blsSecretKey *secVec, const blsSecretKey *msk, mclSize k, const blsId *idVec, mclSize n)
+{
+	return blsSecretKeyShareBatchMT(secVec, msk, k, idVec, n, 0);
+}
+
+/*
+	fixed-base multi-scalar multiplication by base[0, k)
+	tbl_[j * winN_ + w] = 2^(c_ w) base[j] is normalized so that an addition to a bucket is a mixed addition
+	mul needs k winN_ + 2^(c_ + 1) additions and no doubling
+*/
+template<class G>
+class FixedBaseMulVec {
+	std::vector<G> tbl_;
+	size_t k_;
+	size_t c_;
+	size_t winN_;
+	struct InitRange {
+		FixedBaseMulVec *self;
+		const G *base;
+		void operator()(size_t, size_t begin, size_t end) const
+		{
+			const size_t winN = self->winN_;
+			G *tbl = &self->tbl_[0];
+			for (size_t j = begin; j < end; j++) {
+				G P = base[j];
+				for (size_t w = 0; w < winN; w++) {
+					tbl[j * winN + w] = P;
+					for (size_t i = 0; i < self->c_; i++) {
+						G::dbl(P, P);
+					}
+				}
+			}
+			normalizeVec(tbl + begin * winN, tbl + begin * winN, (end - begin) * winN);
+		}
+	};
+public:
+	explicit FixedBaseMulVec(size_t k)
+		: k_(k)
+		, c_(2)
+		, winN_(0)
+	{
+		const size_t bitSize = Fr::getBitSize();
+		// minimize k bitSize / c + 2^(c + 1)
+		size_t minCost = size_t(-1);
+		for (size_t c = 2; c <= 16; c++) {
+			const size_t cost = k * ((bitSize + c - 1) / c) + (size_t(1) << (c + 1));
+			if (cost < minCost) {
+				minCost = cost;
+				c_ = c;
+			}
+		}
+		winN_ = (bitSize + c_ - 1) / c_;
+	}
+	// threadN = 0 means blsGetThreadNum()
+	void init(const G *base, size_t threadN)
+	{
+		tbl_.resize(k_ * winN_);
+		threadN = bls::local::getThreadNum(threadN, k_);
+		InitRange f = { this, base };
+		bls::local::parallelFor(f, k_, threadN);
+	}
+	// the number of additions per base
+	size_t getWinN() const { return winN_; }
+	/*
+		z = sum_{j < k} y[j] base[j]
+		bucket is a work area
+	*/
+	void mul(G& z, const Fr *y, std::vector<G>& bucket) const
+	{
+		const size_t bucketN = (size_t(1) << c_) - 1;
+		bucket.resize(bucketN);
+		for (size_t i = 0; i < bucketN; i++) {
+			bucket[i].clear();
+		}
+		for (size_t j = 0; j < k_; j++) {
+			mcl::fp::Block b;
+			y[j].getBlock(b);
+			const G *tbl = &tbl_[j * winN_];
+			for (size_t w = 0; w < winN_; w++) {
+				size_t d = getDigit(b.p, b.n, w * c_, c_);
+				if (d) bucket[d - 1] += tbl[w];
+			}
+		}
+		// sum_i (i + 1) bucket[i]
+		G sum, t;
+		sum.clear();
+		t.clear();
+		for (size_t i = bucketN; i-- > 0;) {
+			sum += bucket[i];
+			t += sum;
+		}
+		z = t;
+	}
+};
+
+/*
+	Horner's method by a small id needs about 1.5 bitLen(id) operations per mpk[j]
+	and FixedBaseMulVec needs winN additions per mpk[j]
+*/
+inline bool useFixedBase(const Fr& id, size_t winN)
+{
+	return getBitLen(id) * 3 > winN * 2;
+}
+
+struct PublicKeyShareRange {
+	blsPublicKey *pubVec;
+	const blsPublicKey *mpk;
+	size_t k;
+	const blsId *idVec;
+	const FixedBaseMulVec<G2> *fb; // may be NULL
+	void operator()(size_t, size_t begin, size_t end) const
+	{
+		std::vector<Fr> s(k);
+		std::vector<G2> bucket;
+		for (size_t i = begin; i < end; i++) {
+			const Fr& x = *cast(&idVec[i].v);
+			if (fb == 0 || !useFixedBase(x, fb->getWinN())) {
+				mclBn_G2EvaluatePolynomial(&pubVec[i].v, &mpk->v, k, &idVec[i].v);
+				continue;
+			}
+			// s[j] = x^j
+			s[0] = 1;
+			for (size_t j = 1; j < k; j++) {
+				Fr::mul(s[j], s[j - 1], x);
+			}
+			fb->mul(*cast(&pubVec[i].v), s.data(), bucket);
+		}
+	}
+};
+
+int blsPublicKeyShareBatchMT(blsPublicKey *pubVec, const blsPublicKey *mpk, mclSize k, const blsId *idVec, mclSize n, mclSize threadN)
+{
+	if (k == 0) return -1;
+	FixedBaseMulVec<G2> fb(k);
+	size_t largeN = 0;
+	for (size_t i = 0; i < n; i++) {
+		if (useFixedBase(*cast(&idVec[i].v), fb.getWinN())) largeN++;
+	}
+	// the table costs about as much as Horner's method for one large id
+	const bool useTbl = k > 1 && largeN > 1;
+	if (useTbl) {
+		std::vector<G2> base(k);
+		for (size_t j = 0; j < k; j++) {
+			base[j] = *cast(&mpk[j].v);
+		}
+		fb.init(base.data(), threadN);
+	}
+	threadN = bls::local::getThreadNum(threadN, n, pubShareMinTaskN);
+	PublicKeyShareRange f = { pubVec, mpk, k, idVec, useTbl ? &fb : 0 };
+	bls::local::parallelFor(f, n, threadN);
+	return 0;
+}
+
+int blsPublicKeyShareBatch(blsPublicKey *pubVec, const blsPublicKey *mpk, mclSize k, const blsId *idVec, mclSize n)
+{
+	return blsPublicKeyShareBatchMT(pubVec, mpk, k, idVec, n, 0);
+}
+
+int blsPublicKeyShare(blsPublicKey *pub, const blsPublicKey *mpk, mclSize k, const blsId *id)
+{
+	return mclBn_G2EvaluatePolynomial(&pub->v, &mpk->v, k, &id->v);
+}
+
+int blsSecretKeyRecover(blsSecretKey *sec, const blsSecretKey *secVec, const blsId *idVec, mclSize n)
+{
+	if (n == 0) return -1;
+	if (n == 1) {
+		*sec = secVec[0];
+		return 0;
+	}
+	std::vector<Fr> x(n), lambda(n);
+	for (size_t i = 0; i < n; i++) {
+		x[i] = *cast(&idVec[i].v);
+	}
+	if (!getLagrangeCoeff(lambda.data(), x.data(), n)) return -1;
+	Fr s, t;
+	s.clear();
+	for (size_t i = 0; i < n; i++) {
+		Fr::mul(t, *cast(&secVec[i].v), lambda[i]);
+		s += t;
+	}
+	*cast(&sec->v) = s;
+	return 0;
+}
+
+int blsPublicKeyRecover(blsPublicKey *pub, const blsPublicKey *pubVec, const blsId *idVec, mclSize n)
+{
+	return recoverPoint(*cast(&pub->v), pubVec, idVec, n, 0);
+}
+
+int blsSignatureRecover(blsSignature *sig, const blsSignature *sigVec, const blsId *idVec, mclSize n)
+{
+	return recoverPoint(*cast(&sig->v), sigVec, idVec, n, 0);
+}
+
+int blsPublicKeyRecoverMT(blsPublicKey *pub, const blsPublicKey *pubVec, const blsId *idVec, mclSize n, mclSize threadN)
+{
+	return recoverPoint(*cast(&pub->v), pubVec, idVec, n, threadN);
+}
+
+int blsSignatureRecoverMT(blsSignature *sig, const blsSignature *sigVec, const blsId *idVec, mclSize n, mclSize threadN)
+{
+	return recoverPoint(*cast(&sig->v), sigVec, idVec, n, threadN);
+}
+
+struct blsLagrangeBasis {
+	std::vector<Fr> lambda; // empty if k = 1
+	size_t k;
+};
+
+blsLagrangeBasis *blsLagrangeBasisCreate(const blsId *idVec, mclSize k)
+{
+	if (k == 0) return 0;
+	blsLagrangeBasis *basis = new (std::nothrow) blsLagrangeBasis;
+	if (basis == 0) return 0;
+	basis->k = k;
+	if (k == 1) return basis;
+	std::vector<Fr> x(k);
+	for (size_t i = 0; i < k; i++) {
+		x[i] = *cast(&idVec[i].v);
+	}
+	basis->lambda.resize(k);
+	if (!getLagrangeCoeff(basis->lambda.data(), x.data(), k)) {
+		delete basis;
+		return 0;
+	}
+	return basis;
+}
+
+void blsLagrangeBasisDestroy(blsLagrangeBasis *basis)
+{
+	delete basis;
+}
+
+mclSize blsLagrangeBasisGetSize(const blsLagrangeBasis *basis)
+{
+	return basis->k;
+}
+
+static const Fr *getCoeff(const blsLagrangeBasis *basis)
+{
+	return basis->lambda.empty() ? 0 : basis->lambda.data();
+}
+
+void blsSecretKeyRecoverWithBasis(blsSecretKey *sec, const blsSecretKey *secVec, const blsLagrangeBasis *basis)
+{
+	const Fr *lambda = getCoeff(basis);
+	if (lambda == 0) {
+		*sec = secVec[0];
+		return;
+	}
+	Fr s, t;
+	s.clear();
+	for (size_t i = 0; i < basis->k; i++) {
+		Fr::mul(t, *cast(&secVec[i].v), lambda[i]);
+		s += t;
+	}
+	*cast(&sec->v) = s;
+}
+
+void blsPublicKeyRecoverWithBasis(blsPublicKey *pub, const blsPublicKey *pubVec, const blsLagrangeBasis *basis)
+{
+	recoverPointWithCoeff(*cast(&pub->v), pubVec, getCoeff(basis), basis->k, 0);
+}
+
+void blsSignatureRecoverWithBasis(blsSignature *sig, const blsSignature *sigVec, const blsLagrangeBasis *basis)
+{
+	recoverPointWithCoeff(*cast(&sig->v), sigVec, getCoeff(basis), basis->k, 0);
+}
+
+void blsSecretKeyAdd(blsSecretKey *sec, const blsSecretKey *rhs)
+{
+	mclBnFr_add(&sec->v, &sec->v, &rhs->v);
+}
+
+void blsPublicKeyAdd(blsPublicKey *pub, const blsPublicKey *rhs)
+{
+	mclBnG2_add(&pub->v, &pub->v, &rhs->v);
+}
+
+void blsSignatureAdd(blsSignature *sig, const blsSignature *rhs)
+{
+	mclBnG1_add(&sig->v, &sig->v, &rhs->v);
+}
+
+void blsSignatureVerifyOrder(int doVerify)
+{
+	mclBn_verifyOrderG1(doVerify);
+}
+void blsPublicKeyVerifyOrder(int doVerify)
+{
+	mclBn_verifyOrderG2(doVerify);
+}
+int blsSignatureIsValidOrder(const blsSignature *sig)
+{
+	return mclBnG1_isValidOrder(&sig->v);
+}
+int blsPublicKeyIsValidOrder(const blsPublicKey *pub)
+{
+	return mclBnG2_isValidOrder(&pub->v);
+}
+
+// s[0, 4) = a random seed by CSPRNG
+static bool getRandomSeed(uint32_t s[4])
+{
+#ifndef MCL_DONT_USE_CSPRNG
+	mclBnFr seed;
+	if (mclBnFr_setByCSPRNG(&seed) != 0) return false;
+	memcpy(s, seed.d, sizeof(uint32_t) * 4);
+	return true;
+#else
+	(void)s;
+	return false;
+#endif
+}
+
+/*
+	check the order of xVec[0, n) by random linear combinations
+	one round checks that sum_i r_i xVec[i] has order r for random b-bit r_i
+	if xVec[j] has a component of order q' > 1 then one round misses it with probability at most ceil(2^b / q') / 2^b
+	q' >= the smallest prime factor q of the cofactor, so roundN rounds make the probability at most 2^-secBit
+	a failed range is split into halves to find the bad points
+*/
+template<class G, class T>
+class OrderBatchChecker {
+	const T *xVec_;
+	int *okVec_;
+	cybozu::XorShift rg_;
+	size_t roundN_; // 0 means every point has order r
+	size_t b_;
+	size_t orderCost_;
+	static const G& get(const T& x) { return *cast(&x.v); }
+	bool isValidOrderEach(size_t begin, size_t end) const
+	{
+		bool ok = true;
+		for (size_t i = begin; i < end; i++) {
+			const bool v = get(xVec_[i]).isValidOrder();
+			if (okVec_ == 0 && !v) return false;
+			if (okVec_) okVec_[i] = v ? 1 : 0;
+			ok = ok && v;
+		}
+		return ok;
+	}
+	// the rough number of additions of mulVec for n points and b-bit coefficients
+	size_t getMulVecCost(size_t n) const
+	{
+		if (n < mulVecMinN) return n * b_ * 3 / 2;
+		const size_t c = getMulVecWindowSize(n);
+		return (b_ + c - 1) / c * (n + (size_t(1) << (c + 1))) + b_;
+	}
+	bool useBatch(size_t n) const
+	{
+		if (roundN_ == 0) return false;
+		return roundN_ * (getMulVecCost(n) + orderCost_) < n * orderCost_;
+	}
+	bool isValidOrderBatch(size_t begin, size_t end)
+	{
+		const size_t n = end - begin;
+		std::vector<G> x(n);
+		for (size_t i = 0; i < n; i++) {
+			x[i] = get(xVec_[begin + i]);
+		}
+		std::vector<Fr> r(n);
+		const uint64_t mask = (uint64_t(1) << b_) - 1;
+		G s;
+		for (size_t j = 0; j < roundN_; j++) {
+			for (size_t i = 0; i < n; i++) {
+				r[i] = int64_t(rg_.get64() & mask);
+			}
+			mulVec(s, x.data(), r.data(), n, 1);
+			if (!s.isValidOrder()) return false;
+		}
+		return true;
+	}
+	/*
+		return true if xVec[begin, end) have order r
+		hasBad means a bad point is known to be in the range
+	*/
+	bool check(size_t begin, size_t end, bool hasBad)
+	{
+		const size_t n = end - begin;
+		if (!useBatch(n)) return isValidOrderEach(begin, end);
+		if (!hasBad) {
+			if (isValidOrderBatch(begin, end)) {
+				if (okVec_) {
+					for (size_t i = begin; i < end; i++) okVec_[i] = 1;
+				}
+				return true;
+			}
+			if (okVec_ == 0) return false;
+		}
+		const size_t mid = begin + n / 2;
+		const bool leftOk = check(begin, mid, false);
+		// the bad point is in the right half if the left half is good
+		const bool rightOk = check(mid, end, leftOk);
+		return leftOk && rightOk;
+	}
+public:
+	OrderBatchChecker(const T *xVec, int *okVec, const uint32_t seed[4], uint32_t q, size_t secBit)
+		: xVec_(xVec)
+		, okVec_(okVec)
+		, rg_(seed[0], seed[1], seed[2], seed[3])
+		, roundN_(0)
+		, b_(8)
+		, orderCost_(Fr::getBitSize() * 3 / 2)
+	{
+		if (q <= 1) return;
+		for (uint32_t t = q; t; t >>= 1) b_++;
+		// one round gives b - log2(ceil(2^b / q)) bits of security
+		const uint64_t m = ((uint64_t(1) << b_) + q - 1) / q;
+		const double bitPerRound = b_ - log(double(m)) / log(2.0);
+		roundN_ = size_t(ceil(secBit / bitPerRound));
+	}
+	bool run(size_t n) { return check(0, n, false); }
+};
+
+template<class G, class T>
+int areValidOrderBatch(int *okVec, const T *xVec, size_t n, uint32_t q, size_t secBit)
+{
+	if (secBit == 0) secBit = orderBatchDefaultSecBit;
+	uint32_t seed[4];
+	// check each point without the random seed
+	if (!getRandomSeed(seed)) q = 1;
+	OrderBatchChecker<G, T> checker(xVec, okVec, seed, q, secBit);
+	return checker.run(n) ? 1 : 0;
+}
+
+int blsSignatureAreValidOrderBatch(int *okVec, const blsSignature *sigVec, mclSize n, mclSize secBit)
+{
+	return areValidOrderBatch<G1>(okVec, sigVec, n, g_G1CofactorMinPrime, secBit);
+}
+
+int blsPublicKeyAreValidOrderBatch(int *okVec, const blsPublicKey *pubVec, mclSize n, mclSize secBit)
+{
+	return areValidOrderBatch<G2>(okVec, pubVec, n, g_G2CofactorMinPrime, secBit);
+}
+
+#ifndef BLS_MINIMUM_API
+inline bool toG1(G1& Hm, const void *h, mclSize size)
+{
+	Fp t;
+	t.setArrayMask((const char *)h, size);
+	bool b;
+	BN::mapToG1(&b, Hm, t);
+	return b;
+}
+
+/*
+	eVec[idx] = prod_{i in [begin, end)} ML(hVec[i], pubVec[i])
+*/
+struct AggregatedHashesMillerLoop {
+	const blsPublicKey *pubVec;
+	const char *hVec;
+	size_t sizeofHash;
+	GT *eVec;
+	char *okVec;
+	void operator()(size_t idx, size_t begin, size_t end) const
+	{
+		okVec[idx] = 0;
+		MillerLoopVec ml;
+		G1 h;
+		for (size_t i = begin; i < end; i++) {
+			if (!toG1(h, &hVec[i * sizeofHash], sizeofHash)) return;
+			ml.add(h, *cast(&pubVec[i].v));
+		}
+		ml.get(eVec[idx]);
+		okVec[idx] = 1;
+	}
+};
+
+static int verifyAggregatedHashes(const Fp6 *Qcoeff, const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n, mclSize threadN)
+{
+	if (n == 0) return 0;
+	/*
+		e(aggSig, Q) = prod_i e(hVec[i], pubVec[i])
+		<=> finalExp(ML(-aggSig, Q) * prod_i ML(hVec[i], pubVec[i])) == 1
+	*/
+	threadN = bls::local::getThreadNum(threadN, n);
+	std::vector<GT> eVec(threadN);
+	std::vector<char> okVec(threadN);
+	AggregatedHashesMillerLoop f = { pubVec, (const char*)hVec, sizeofHash, eVec.data(), okVec.data() };
+	bls::local::parallelFor(f, n, threadN);
+	GT e1;
+	BN::precomputedMillerLoop(e1, -*cast(&aggSig->v), Qcoeff);
+	for (size_t i = 0; i < threadN; i++) {
+		if (!okVec[i]) return 0;
+		e1 *= eVec[i];
+	}
+	BN::finalExp(e1, e1);
+	return e1.isOne();
+}
+
+int blsVerifyAggregatedHashesMT(const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n, mclSize threadN)
+{
+#ifdef BLS_USE_CACHE
+	const VerifyCacheKey key('a', aggSig, pubVec, n, hVec, sizeofHash * n);
+	if (key.isCached()) return 1;
+	return key.record(verifyAggregatedHashes(getQcoeff().data(), aggSig, pubVec, hVec, sizeofHash, n, threadN));
+#else
+	return verifyAggregatedHashes(getQcoeff().data(), aggSig, pubVec, hVec, sizeofHash, n, threadN);
+#endif
+}
+
+int blsVerifyAggregatedHashes(const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n)
+{
+	return blsVerifyAggregatedHashesMT(aggSig, pubVec, hVec, sizeofHash, n, 0);
+}
+
+/*
+	running product of ML(h_i, pub_i) of the added pairs
+	the pairs are evaluated by MillerLoopVec every MillerLoopVecMaxN pairs
+*/
+struct blsAggregateVerifier {
+	MillerLoopVec ml;
+	size_t n;
+	bool ok; // false if a hash can not be mapped to G1
+	blsAggregateVerifier() : n(0), ok(true) {}
+};
+
+blsAggregateVerifier *blsAggregateVerifierCreate()
+{
+	return new (std::nothrow) blsAggregateVerifier;
+}
+
+void blsAggregateVerifierDestroy(blsAggregateVerifier *v)
+{
+	delete v;
+}
+
+void blsAggregateVerifierClear(blsAggregateVerifier *v)
+{
+	v->ml = MillerLoopVec();
+	v->n = 0;
+	v->ok = true;
+}
+
+mclSize blsAggregateVerifierGetSize(const blsAggregateVerifier *v)
+{
+	return v->n;
+}
+
+void blsAggregateVerifierAdd(blsAggregateVerifier *v, const blsPublicKey *pub, const void *m, mclSize size)
+{
+	G1 Hm;
+	hashAndMapToG1(Hm, m, size);
+	v->ml.add(Hm, *cast(&pub->v));
+	v->n++;
+}
+
+int blsAggregateVerifierAddHash(blsAggregateVerifier *v, const blsPublicKey *pub, const void *h, mclSize size)
+{
+	G1 Hm;
+	if (!toG1(Hm, h, size)) {
+		v->ok = false;
+		return -1;
+	}
+	v->ml.add(Hm, *cast(&pub->v));
+	v->n++;
+	return 0;
+}
+
+void blsAggregateVerifierAddPrepared(blsAggregateVerifier *v, const blsPublicKey *pub, const blsMessage *msg)
+{
+	v->ml.add(*cast(&msg->v), *cast(&pub->v));
+	v->n++;
+}
+
+void blsAggregateVerifierMerge(blsAggregateVerifier *v, blsAggregateVerifier *rhs)
+{
+	if (v == rhs) return;
+	Fp12 e;
+	rhs->ml.get(e);
+	v->ml.mul(e);
+	v->n += rhs->n;
+	v->ok = v->ok && rhs->ok;
+}
+
+int blsAggregateVerifierFinalize(blsAggregateVerifier *v, const blsSignature *aggSig)
+{
+	if (v->n == 0 || !v->ok) return 0;
+	/*
+		e(aggSig, Q) = prod_i e(h_i, pub_i)
+		<=> finalExp(ML(-aggSig, Q) * prod_i ML(h_i, pub_i)) == 1
+	*/
+	Fp12 e, e1;
+	v->ml.get(e);
+	BN::precomputedMillerLoop(e1, -*cast(&aggSig->v), getQcoeff().data());
+	e *= e1;
+	BN::finalExp(e, e);
+	return e.isOne();
+}
+
+/*
+	return true if x.getSig(i) and x.getPub(i) have order r for all i
+	check only the groups whose order is not checked by deserialization
+*/
+template<class T>
+static bool isValidOrderBatchInput(const T& x, size_t n)
+{
+	if (!G1::verifyOrder_) {
+		std::vector<blsSignature> sigVec(n);
+		for (size_t i = 0; i < n; i++) {
+			*cast(&sigVec[i].v) = x.getSig(i);
+		}
+		if (!blsSignatureAreValidOrderBatch(0, sigVec.data(), n, 0)) return false;
+	}
+	if (!G2::verifyOrder_) {
+		std::vector<blsPublicKey> pubVec(n);
+		for (size_t i = 0; i < n; i++) {
+			*cast(&pubVec[i].v) = x.getPub(i);
+		}
+		if (!blsPublicKeyAreValidOrderBatch(0, pubVec.data(), n, 0)) return false;
+	}
+	return true;
+}
+
+/*
+	check e(sig_i, Q) = e(H_i, pub_i) for i in [0, n) at once
+	e(sum_i r_i sig_i, Q) = prod_i e(r_i H_i, pub_i)
+	<=> finalExp(ML(-sum_i r_i sig_i, Q) * prod_i ML(r_i H_i, pub_i)) == 1
+	r_0 = 1 and r_i (i > 0) are 63-bit random values of XorShift seeded by s given by getRandomSeed
+	the bound 2^-63 holds only for the points of order r, so the order is checked if deserialization does not
+	x.getSig(i), x.getPub(i) and x.getHm(H, i) give the i-th input
+*/
+template<class T>
+static bool verifyBatchRandom(const T& x, size_t n, const uint32_t s[4])
+{
+	if (!isValidOrderBatchInput(x, n)) return false;
+	cybozu::XorShift rg(s[0], s[1], s[2], s[3]);
+	MillerLoopVec ml;
+	std::vector<G1> sigVec(n);
+	std::vector<Fr> rVec(n);
+	G1 h;
+	for (size_t i = 0; i < n; i++) {
+		int64_t r = 1;
+		if (i > 0) {
+			r = int64_t(rg.get64() >> 1);
+			if (r == 0) r = 1;
+		}
+		rVec[i] = r;
+		sigVec[i] = x.getSig(i);
+		x.getHm(h, i);
+		if (i > 0) G1::mul(h, h, r);
+		ml.add(h, x.getPub(i));
+	}
+	G1 aggSig;
+	mulVec(aggSig, sigVec.data(), rVec.data(), n, 0);
+	ml.add(-aggSig, getQcoeff().data());
+	GT e1;
+	ml.get(e1);
+	BN::finalExp(e1, e1);
+	return e1.isOne();
+}
+
+#ifndef MCL_DONT_USE_CSPRNG
+// the input of blsVerifyBatch for verifyBatchRandom
+struct MsgBatch {
+	const blsSignature *sigVec;
+	const blsPublicKey *pubVec;
+	const char *msgVec;
+	size_t msgSize;
+	const G1& getSig(size_t i) const { return *cast(&sigVec[i].v); }
+	const G2& getPub(size_t i) const { return *cast(&pubVec[i].v); }
+	void getHm(G1& Hm, size_t i) const { hashAndMapToG1(Hm, &msgVec[i * msgSize], msgSize); }
+};
+
+int blsVerifyBatch(const blsSignature *sigVec, const blsPublicKey *pubVec, const void *msgVec, mclSize msgSize, mclSize n)
+{
+	if (n == 0) return 0;
+	uint32_t s[4];
+	if (!getRandomSeed(s)) return 0;
+	const MsgBatch x = { sigVec, pubVec, (const char*)msgVec, msgSize };
+	return verifyBatchRandom(x, n, s);
+}
+#endif
+
+#ifdef BLS_USE_STD_THREAD
+struct VerifyJob {
+	blsSignature sig;
+	blsPublicKey pub;
+	std::string msg;
+	blsVerifyCallback cb;
+	void *self;
+	std::chrono::steady_clock::time_point deadline; // the job must be taken by then
+	G1 Hm; // H(msg) set by a worker
+	int ret;
+};
+
+// the input of blsVerifyQueue for verifyBatchRandom
+struct JobBatch {
+	const VerifyJob *jobVec;
+	const G1& getSig(size_t i) const { return *cast(&jobVec[i].sig.v); }
+	const G2& getPub(size_t i) const { return *cast(&jobVec[i].pub.v); }
+	void getHm(G1& Hm, size_t i) const { Hm = jobVec[i].Hm; }
+};
+
+// return i such that 2^i <= n < 2^(i+1) ; the last bucket has larger n
+inline size_t getHistIdx(size_t n)
+{
+	size_t i = 0;
+	while (n > 1 && i < BLS_VERIFY_QUEUE_HIST_N - 1) {
+		n >>= 1;
+		i++;
+	}
+	return i;
+}
+
+struct blsVerifyQueue {
+	std::mutex m;
+	std::condition_variable cv; // wake up the workers
+	std::condition_variable doneCv; // wake up blsVerifyQueueFlush
+	std::deque<VerifyJob> q;
+	std::vector<std::thread> workerVec;
+	size_t maxBatchN;
+	std::chrono::microseconds maxDelay;
+	size_t runningN; // the number of jobs taken by the workers
+	size_t flushN; // the number of the callers of blsVerifyQueueFlush
+	bool quit;
+	blsVerifyQueueStat stat;
+	blsVerifyQueue(size_t maxBatchN, size_t maxDelayUsec)
+		: maxBatchN(maxBatchN)
+		, maxDelay(maxDelayUsec)
+		, runningN(0)
+		, flushN(0)
+		, quit(false)
+	{
+		memset(&stat, 0, sizeof(stat));
+	}
+	/*
+		take at most maxBatchN jobs when there are maxBatchN jobs or the oldest one expires
+		the jobs are taken without waiting while quit is set or blsVerifyQueueFlush is called
+	*/
+	void run()
+	{
+		std::vector<VerifyJob> jobVec;
+		std::unique_lock<std::mutex> lk(m);
+		for (;;) {
+			if (q.empty()) {
+				if (quit) return;
+				cv.wait(lk);
+				continue;
+			}
+			if (q.size() < maxBatchN && !quit && flushN == 0) {
+				const std::chrono::steady_clock::time_point deadline = q.front().deadline;
+				if (std::chrono::steady_clock::now() < deadline) {
+					cv.wait_until(lk, deadline);
+					continue;
+				}
+			}
+			const size_t n = (std::min)(q.size(), maxBatchN);
+			stat.depthHist[getHistIdx(q.size())]++;
+			stat.batchSizeHist[getHistIdx(n)]++;
+			stat.batchN++;
+			jobVec.assign(std::make_move_iterator(q.begin()), std::make_move_iterator(q.begin() + n));
+			q.erase(q.begin(), q.begin() + n);
+			stat.pending = q.size();
+			runningN += n;
+			if (!q.empty()) cv.notify_one();
+			// the CSPRNG may not be thread safe
+			uint32_t seed[4];
+			const bool hasSeed = getRandomSeed(seed);
+			lk.unlock();
+			const bool fallback = process(jobVec, hasSeed ? seed : 0);
+			for (size_t i = 0; i < n; i++) {
+				jobVec[i].cb(jobVec[i].self, jobVec[i].ret);
+			}
+			lk.lock();
+			runningN -= n;
+			stat.doneN += n;
+			if (fallback) stat.fallbackN++;
+			if (q.empty() && runningN == 0) doneCv.notify_all();
+		}
+	}
+	/*
+		set ret of the jobs
+		check all the jobs at once with seed and check each job if the batch fails
+		check each job if seed = 0 (no CSPRNG)
+		return true if each job is checked
+	*/
+	static bool process(std::vector<VerifyJob>& jobVec, const uint32_t *seed)
+	{
+		const size_t n = jobVec.size();
+		for (size_t i = 0; i < n; i++) {
+			VerifyJob& job = jobVec[i];
+			hashAndMapToG1(job.Hm, job.msg.c_str(), job.msg.size());
+		}
+		if (n > 1 && seed) {
+			const JobBatch x = { &jobVec[0] };
+			if (verifyBatchRandom(x, n, seed)) {
+				for (size_t i = 0; i < n; i++) jobVec[i].ret = 1;
+				return false;
+			}
+		}
+		for (size_t i = 0; i < n; i++) {
+			VerifyJob& job = jobVec[i];
+			job.ret = isEqualTwoPairings(*cast(&job.sig.v), getQcoeff().data(), job.Hm, *cast(&job.pub.v));
+		}
+		return n > 1;
+	}
+};
+
+blsVerifyQueue *blsVerifyQueueCreate(mclSize threadN, mclSize maxBatchN, mclSize maxDelayUsec)
+{
+	blsVerifyQueue *vq = new (std::nothrow) blsVerifyQueue(maxBatchN == 0 ? 64 : maxBatchN, maxDelayUsec);
+	if (vq == 0) return 0;
+	threadN = bls::local::getThreadNum(threadN);
+	for (size_t i = 0; i < threadN; i++) {
+		vq->workerVec.push_back(std::thread(&blsVerifyQueue::run, vq));
+	}
+	return vq;
+}
+
+void blsVerifyQueueDestroy(blsVerifyQueue *vq)
+{
+	if (vq == 0) return;
+	{
+		std::lock_guard<std::mutex> lk(vq->m);
+		vq->quit = true;
+	}
+	vq->cv.notify_all();
+	for (size_t i = 0; i < vq->workerVec.size(); i++) {
+		vq->workerVec[i].join();
+	}
+	delete vq;
+}
+
+int blsVerifyQueueSubmit(blsVerifyQueue *vq, const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size, blsVerifyCallback cb, void *self)
+{
+	VerifyJob job;
+	job.sig = *sig;
+	job.pub = *pub;
+	job.msg.assign((const char*)m, size);
+	job.cb = cb;
+	job.self = self;
+	job.deadline = std::chrono::steady_clock::now() + vq->maxDelay;
+	job.ret = 0;
+	{
+		std::lock_guard<std::mutex> lk(vq->m);
+		if (vq->quit) return -1;
+		vq->q.push_back(job);
+		vq->stat.submitN++;
+		vq->stat.pending = vq->q.size();
+		if (vq->stat.pending > vq->stat.maxPending) vq->stat.maxPending = vq->stat.pending;
+	}
+	vq->cv.notify_one();
+	return 0;
+}
+
+void blsVerifyQueueFlush(blsVerifyQueue *vq)
+{
+	std::unique_lock<std::mutex> lk(vq->m);
+	if (vq->q.empty() && vq->runningN == 0) return;
+	vq->flushN++;
+	vq->cv.notify_all();
+	while (!vq->q.empty() || vq->runningN > 0) {
+		vq->doneCv.wait(lk);
+	}
+	vq->flushN--;
+}
+
+void blsVerifyQueueGetStat(blsVerifyQueue *vq, blsVerifyQueueStat *stat)
+{
+	std::lock_guard<std::mutex> lk(vq->m);
+	*stat = vq->stat;
+}
+#else
+blsVerifyQueue *blsVerifyQueueCreate(mclSize, mclSize, mclSize)
+{
+	return 0;
+}
+void blsVerifyQueueDestroy(blsVerifyQueue *) {}
+int blsVerifyQueueSubmit(blsVerifyQueue *, const blsSignature *, const blsPublicKey *, const void *, mclSize, blsVerifyCallback, void *)
+{
+	return -1;
+}
+void blsVerifyQueueFlush(blsVerifyQueue *) {}
+void blsVerifyQueueGetStat(blsVerifyQueue *, blsVerifyQueueStat *stat)
+{
+	memset(stat, 0, sizeof(*stat));
+}
+#endif
+
+/*
+	sumVec[idx] = sum_{i in [begin, end)} xVec[i]
+	the points which are not normalized are normalized at once
+	so that every addition is a mixed addition
+*/
+template<class G, class T>
+struct SumRange {
+	const T *xVec;
+	G *sumVec;
+	void operator()(size_t idx, size_t begin, size_t end) const
+	{
+		G& sum = sumVec[idx];
+		sum.clear();
+		std::vector<G> tmp;
+		for (size_t i = begin; i < end; i++) {
+			const G& P = *cast(&xVec[i].v);
+			if (P.isNormalized()) {
+				sum += P;
+			} else {
+				tmp.push_back(P);
+			}
+		}
+		normalizeVec(tmp.data(), tmp.data(), tmp.size());
+		for (size_t i = 0; i < tmp.size(); i++) {
+			sum += tmp[i];
+		}
+	}
+};
+
+/*
+	sum = sum_{i < n} xVec[i]
+	the partial sums of threadN ranges are reduced by a binary tree
+	sum is normalized if normalize is true
+*/
+template<class G, class T>
+void sumPoints(G& sum, const T *xVec, size_t n, size_t threadN, bool normalize = false)
+{
+	if (n == 0) {
+		sum.clear();
+		return;
+	}
+	threadN = bls::local::getThreadNum(threadN, n, sumMinTaskN);
+	std::vector<G> partial(threadN);
+	SumRange<G, T> f = { xVec, partial.data() };
+	bls::local::parallelFor(f, n, threadN);
+	for (size_t step = 1; step < threadN; step *= 2) {
+		for (size_t i = 0; i + step < threadN; i += step * 2) {
+			partial[i] += partial[i + step];
+		}
+	}
+	if (normalize) {
+		G::normalize(sum, partial[0]);
+	} else {
+		sum = partial[0];
+	}
+}
+
+void blsSignatureAggregate(blsSignature *out, const blsSignature *sigVec, mclSize n)
+{
+	sumPoints(*cast(&out->v), sigVec, n, 0, true);
+}
+
+void blsPublicKeyAggregate(blsPublicKey *out, const blsPublicKey *pubVec, mclSize n)
+{
+	sumPoints(*cast(&out->v), pubVec, n, 0, true);
+}
+
+static int fastAggregateVerify(const Fp6 *Qcoeff, const blsSignature *sig, const blsPublicKey *pubVec, mclSize n, const void *m, mclSize size)
+{
+	if (n == 0) return 0;
+	G2 pub;
+	sumPoints(pub, pubVec, n, 0);
+	G1 Hm;
+	hashAndMapToG1(Hm, m, size);
+	return isEqualTwoPairings(*cast(&sig->v), Qcoeff, Hm, pub);
+}
+
+int blsFastAggregateVerify(const blsSignature *sig, const blsPublicKey *pubVec, mclSize n, const void *m, mclSize size)
+{
+	return fastAggregateVerify(getQcoeff().data(), sig, pubVec, n, m, size);
+}
+
+int blsSignHash(blsSignature *sig, const blsSecretKey *sec, const void *h, mclSize size)
 {
 	G1 Hm;
 	if (!toG1(Hm, h, size)) return -1;
@@ -307,13 +2299,529 @@ int blsSignHash(blsSignature *sig, const blsSecretKey *sec, const void *h, mclSi
 	return 0;
 }
 
-int blsVerifyHash(const blsSignature *sig, const blsPublicKey *pub, const void *h, mclSize size)
+struct SignMultiKeyRange {
+	blsSignature *sigVec;
+	const blsSecretKey *secVec;
+	const G1 *tbl;
+	size_t winN;
+	void operator()(size_t, size_t begin, size_t end) const
+	{
+		for (size_t i = begin; i < end; i++) {
+			mulCtTbl(*cast(&sigVec[i].v), tbl, winN, *cast(&secVec[i].v));
+		}
+	}
+};
+
+void blsSignMultiKeyMT(blsSignature *sigVec, const blsSecretKey *secVec, mclSize n, const void *m, mclSize size, mclSize threadN)
+{
+	if (n == 0) return;
+	G1 Hm;
+	hashAndMapToG1(Hm, m, size);
+	if (n < signTblMinN) {
+		for (size_t i = 0; i < n; i++) {
+			mclBnG1_mulCT(&sigVec[i].v, cast(&Hm), &secVec[i].v);
+		}
+		return;
+	}
+	const size_t winN = getCtTblWinN();
+	std::vector<G1> tbl(winN * ctTblHalfN);
+	initCtTbl(tbl.data(), Hm, winN);
+	threadN = bls::local::getThreadNum(threadN, n, signMinTaskN);
+	SignMultiKeyRange f = { sigVec, secVec, tbl.data(), winN };
+	bls::local::parallelFor(f, n, threadN);
+}
+
+void blsSignMultiKey(blsSignature *sigVec, const blsSecretKey *secVec, mclSize n, const void *m, mclSize size)
+{
+	blsSignMultiKeyMT(sigVec, secVec, n, m, size, 0);
+}
+
+static int verifyHash(const blsSignature *sig, const blsPublicKey *pub, const void *h, mclSize size)
 {
 	G1 Hm;
 	if (!toG1(Hm, h, size)) return 0;
 	return isEqualTwoPairings(*cast(&sig->v), getQcoeff().data(), Hm, *cast(&pub->v));
 }
 
+int blsVerifyHash(const blsSignature *sig, const blsPublicKey *pub, const void *h, mclSize size)
+{
+#ifdef BLS_USE_CACHE
+	const VerifyCacheKey key('h', sig, pub, 1, h, size);
+	if (key.isCached()) return 1;
+	return key.record(verifyHash(sig, pub, h, size));
+#else
+	return verifyHash(sig, pub, h, size);
+#endif
+}
+
+struct blsPublicKeyPrecomputed {
+	mcl::FixedArray<Fp6, maxQcoeffN> Qcoeff; // precomputed pub
+	bool isZero;
+};
+
+blsPublicKeyPrecomputed *blsPublicKeyPrecomputedCreate(const blsPublicKey *pub)
+{
+	blsPublicKeyPrecomputed *ppub = new (std::nothrow) blsPublicKeyPrecomputed;
+	if (ppub == 0) return 0;
+	const G2& Q = *cast(&pub->v);
+	ppub->isZero = Q.isZero();
+	if (ppub->isZero) return ppub;
+	bool b;
+	precomputeG2(&b, ppub->Qcoeff, Q);
+	if (!b) {
+		delete ppub;
+		return 0;
+	}
+	return ppub;
+}
+
+void blsPublicKeyPrecomputedDestroy(blsPublicKeyPrecomputed *ppub)
+{
+	delete ppub;
+}
+
+/*
+	e(sig, Q) = e(Hm, pub)
+	<=> finalExp(ML(Hm, pub) * ML(-sig, Q)) == 1
+	both pub and Q are precomputed
+*/
+static bool isEqualTwoPairingsPrecomputed(const G1& sig, const G1& Hm, const blsPublicKeyPrecomputed *ppub)
+{
+	Fp12 e;
+	if (ppub->isZero) {
+		precomputedMillerLoop(e, -sig, getQcoeff().data());
+	} else {
+		precomputedMillerLoop2(e, Hm, ppub->Qcoeff.data(), -sig, getQcoeff().data());
+	}
+	finalExp(e, e);
+	return e.isOne();
+}
+
+int blsVerifyPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const void *m, mclSize size)
+{
+	G1 Hm;
+	hashAndMapToG1(Hm, m, size);
+	return isEqualTwoPairingsPrecomputed(*cast(&sig->v), Hm, ppub);
+}
+
+int blsVerifyHashPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const void *h, mclSize size)
+{
+	G1 Hm;
+	if (!toG1(Hm, h, size)) return 0;
+	return isEqualTwoPairingsPrecomputed(*cast(&sig->v), Hm, ppub);
+}
+
+void blsMessagePrepare(blsMessage *msg, const void *m, mclSize size)
+{
+	G1& Hm = *cast(&msg->v);
+	hashAndMapToG1(Hm, m, size);
+	Hm.normalize();
+}
+
+void blsSignPrepared(blsSignature *sig, const blsSecretKey *sec, const blsMessage *msg)
+{
+	mclBnG1_mulCT(&sig->v, &msg->v, &sec->v);
+}
+
+int blsVerifyPrepared(const blsSignature *sig, const blsPublicKey *pub, const blsMessage *msg)
+{
+	return isEqualTwoPairings(*cast(&sig->v), getQcoeff().data(), *cast(&msg->v), *cast(&pub->v));
+}
+
+int blsVerifyPreparedPrecomputed(const blsSignature *sig, const blsPublicKeyPrecomputed *ppub, const blsMessage *msg)
+{
+	return isEqualTwoPairingsPrecomputed(*cast(&sig->v), *cast(&msg->v), ppub);
+}
+
+blsContext *blsContextCreate(const blsPublicKey *gen)
+{
+	if (gen) {
+		const G2& Q = *cast(&gen->v);
+		if (Q.isZero() || !Q.isValid() || !Q.isValidOrder()) return 0;
+	}
+	blsContext *ctx = new (std::nothrow) blsContext;
+	if (ctx == 0) return 0;
+	if (initContext(*ctx, g_curveType, gen ? cast(&gen->v) : 0) != 0) {
+		delete ctx;
+		return 0;
+	}
+	return ctx;
+}
+
+void blsContextDestroy(blsContext *ctx)
+{
+	delete ctx;
+}
+
+void blsContextGetGeneratorOfG2(const blsContext *ctx, blsPublicKey *pub)
+{
+	*(G2*)pub = ctx->Q;
+}
+
+void blsContextGetPublicKey(const blsContext *ctx, blsPublicKey *pub, const blsSecretKey *sec)
+{
+	mulCtTbl(*cast(&pub->v), ctx->QTbl.data(), getCtTblWinN(), *cast(&sec->v));
+}
+
+void blsContextSign(const blsContext *ctx, blsSignature *sig, const blsSecretKey *sec, const void *m, mclSize size)
+{
+	(void)ctx;
+	blsSign(sig, sec, m, size);
+}
+
+int blsContextVerify(const blsContext *ctx, const blsSignature *sig, const blsPublicKey *pub, const void *m, mclSize size)
+{
+	G1 Hm;
+	hashAndMapToG1(Hm, m, size);
+	return isEqualTwoPairings(*cast(&sig->v), ctx->Qcoeff.data(), Hm, *cast(&pub->v));
+}
+
+int blsContextFastAggregateVerify(const blsContext *ctx, const blsSignature *sig, const blsPublicKey *pubVec, mclSize n, const void *m, mclSize size)
+{
+	return fastAggregateVerify(ctx->Qcoeff.data(), sig, pubVec, n, m, size);
+}
+
+int blsContextVerifyAggregatedHashes(const blsContext *ctx, const blsSignature *aggSig, const blsPublicKey *pubVec, const void *hVec, size_t sizeofHash, mclSize n)
+{
+	return verifyAggregatedHashes(ctx->Qcoeff.data(), aggSig, pubVec, hVec, sizeofHash, n, 0);
+}
+
+#ifdef BLS_USE_CACHE
+struct PublicKeyCacheEntry {
+	blsPublicKey pub; // order is checked
+	std::shared_ptr<const blsPublicKeyPrecomputed> ppub; // may be empty
+};
+typedef bls::local::LruCache<PublicKeyCacheEntry> PublicKeyCache;
+
+static PublicKeyCache& getPublicKeyCache()
+{
+	static PublicKeyCache cache(publicKeyCacheDefaultByteSize);
+	return cache;
+}
+
+/*
+	return the cached entry of the serialized public key buf
+	deserialize and check the order of buf only if it is not cached
+	the key is the serialization mode and buf because buf means another point in the other mode
+	@param withPrecomputed [in] the entry has the precomputed public key if true
+	@param readSize [out] the byte size of the serialized public key
+*/
+static PublicKeyCache::ValuePtr getCachedPublicKey(const void *buf, mclSize bufSize, bool withPrecomputed, mclSize *readSize)
+{
+	const mclSize n = mclBn_getG1ByteSize() * 2;
+	if (bufSize < n) return PublicKeyCache::ValuePtr();
+	*readSize = n;
+	std::string key(1, char(mclBn_getETHserialization()));
+	key.append((const char*)buf, n);
+	PublicKeyCache& cache = getPublicKeyCache();
+	PublicKeyCache::ValuePtr v = cache.find(key);
+	if (v && (!withPrecomputed || v->ppub)) return v;
+	std::shared_ptr<PublicKeyCacheEntry> e = std::make_shared<PublicKeyCacheEntry>();
+	if (v) {
+		e->pub = v->pub;
+	} else {
+		if (mclBnG2_deserialize(&e->pub.v, buf, n) != n) return PublicKeyCache::ValuePtr();
+		// mclBnG2_deserialize has checked the order if verifyOrder_ is set
+		if (!G2::verifyOrder_ && !mclBnG2_isValidOrder(&e->pub.v)) return PublicKeyCache::ValuePtr();
+	}
+	size_t byteSize = sizeof(PublicKeyCacheEntry);
+	if (withPrecomputed) {
+		blsPublicKeyPrecomputed *ppub = blsPublicKeyPrecomputedCreate(&e->pub);
+		if (ppub == 0) return PublicKeyCache::ValuePtr();
+		e->ppub.reset(ppub, blsPublicKeyPrecomputedDestroy);
+		byteSize += sizeof(blsPublicKeyPrecomputed);
+	}
+	cache.insert(key, e, byteSize);
+	return e;
+}
+#endif
+
+mclSize blsPublicKeyDeserializeCached(blsPublicKey *pub, const void *buf, mclSize bufSize)
+{
+#ifdef BLS_USE_CACHE
+	mclSize n;
+	PublicKeyCache::ValuePtr e = getCachedPublicKey(buf, bufSize, false, &n);
+	if (!e) return 0;
+	*pub = e->pub;
+	return n;
+#else
+	mclSize n = mclBnG2_deserialize(&pub->v, buf, bufSize);
+	if (n == 0 || (!G2::verifyOrder_ && !mclBnG2_isValidOrder(&pub->v))) return 0;
+	return n;
+#endif
+}
+
+int blsVerifyCached(const blsSignature *sig, const void *pubBuf, mclSize pubBufSize, const void *m, mclSize size)
+{
+#ifdef BLS_USE_CACHE
+	mclSize n;
+	PublicKeyCache::ValuePtr e = getCachedPublicKey(pubBuf, pubBufSize, true, &n);
+	if (!e) return 0;
+	return blsVerifyPrecomputed(sig, e->ppub.get(), m, size);
+#else
+	blsPublicKey pub;
+	if (blsPublicKeyDeserializeCached(&pub, pubBuf, pubBufSize) == 0) return 0;
+	return blsVerify(sig, &pub, m, size);
+#endif
+}
+
+void blsPublicKeyCacheSetMaxByteSize(mclSize maxByteSize)
+{
+#ifdef BLS_USE_CACHE
+	getPublicKeyCache().setMaxByteSize(maxByteSize);
+#else
+	(void)maxByteSize;
+#endif
+}
+
+void blsPublicKeyCacheClear()
+{
+#ifdef BLS_USE_CACHE
+	getPublicKeyCache().clear();
+#endif
+}
+
+void blsPublicKeyCacheGetStat(blsPublicKeyCacheStat *stat)
+{
+#ifdef BLS_USE_CACHE
+	PublicKeyCache::Stat s;
+	getPublicKeyCache().getStat(s);
+	stat->hit = s.hit;
+	stat->miss = s.miss;
+	stat->eviction = s.eviction;
+	stat->n = s.n;
+	stat->byteSize = s.byteSize;
+#else
+	memset(stat, 0, sizeof(*stat));
+#endif
+}
+
+#ifdef BLS_USE_CACHE
+// a new random key of the verify cache
+static bool getVerifyCacheKey(uint64_t key[2])
+{
+	uint32_t s[4];
+	if (!getRandomSeed(s)) return false;
+	key[0] = s[0] | (uint64_t(s[1]) << 32);
+	key[1] = s[2] | (uint64_t(s[3]) << 32);
+	return true;
+}
+#endif
+
+void blsVerifyCacheSetMaxByteSize(mclSize maxByteSize)
+{
+#ifdef BLS_USE_CACHE
+	uint64_t key[2] = {};
+	// the digests must not be predictable, so the cache is disabled without CSPRNG
+	if (!getVerifyCacheKey(key)) maxByteSize = 0;
+	initVerifyCacheMode();
+	getVerifyCache().reset(maxByteSize, key);
+#else
+	(void)maxByteSize;
+#endif
+}
+
+void blsVerifyCacheClear()
+{
+#ifdef BLS_USE_CACHE
+	bls::local::DigestSet& cache = getVerifyCache();
+	if (!cache.isEnabled()) return;
+	uint64_t key[2] = {};
+	if (getVerifyCacheKey(key)) {
+		cache.clear(key);
+	} else {
+		cache.reset(0, key);
+	}
+#endif
+}
+
+void blsVerifyCacheGetStat(blsVerifyCacheStat *stat)
+{
+#ifdef BLS_USE_CACHE
+	bls::local::DigestSet::Stat s;
+	getVerifyCache().getStat(s);
+	stat->hit = s.hit;
+	stat->miss = s.miss;
+	stat->n = s.n;
+	stat->byteSize = s.byteSize;
+#else
+	memset(stat, 0, sizeof(*stat));
+#endif
+}
+
+/*
+	the header of a public key registry file
+	the records are in the memory representation of the writer,
+	so the reader must have the same curve, compiled time variable, unit size and byte order
+*/
+struct PublicKeyRegistryHeader {
+	char magic[8];
+	uint32_t version;
+	uint32_t endian; // registryEndian in the byte order of the writer
+	int32_t curve;
+	int32_t compiledTimeVar;
+	uint32_t unitSize; // sizeof(mcl::fp::Unit)
+	uint32_t flags; // BLS_REGISTRY_PRECOMPUTED
+	uint64_t n; // the number of public keys
+	uint64_t pubSize; // sizeof(blsPublicKey)
+	uint64_t ppubSize; // sizeof(blsPublicKeyPrecomputed) or 0
+	uint64_t ppubOffset; // the offset of blsPublicKeyPrecomputed[n] or 0
+	uint64_t checksum; // of [registryPubOffset, file size)
+};
+static const char registryMagic[8] = { 'B', 'L', 'S', 'P', 'K', 'R', 'E', 'G' };
+static const uint32_t registryVersion = 1;
+static const uint32_t registryEndian = 0x01020304;
+// the records are aligned to registryAlign bytes
+static const size_t registryAlign = 64;
+static const size_t registryPubOffset = (sizeof(PublicKeyRegistryHeader) + registryAlign - 1) / registryAlign * registryAlign;
+
+static bool writeRegistryRecord(FILE *fp, Fnv64& sum, const void *buf, size_t n)
+{
+	sum.update(buf, n);
+	return fwrite(buf, 1, n, fp) == n;
+}
+
+static bool writeRegistryRecords(FILE *fp, PublicKeyRegistryHeader& h, const blsPublicKey *pubVec, size_t n, bool withPrecomputed)
+{
+	Fnv64 sum;
+	const char zero[registryAlign] = {};
+	if (fseek(fp, long(registryPubOffset), SEEK_SET) != 0) return false;
+	for (size_t i = 0; i < n; i++) {
+		blsPublicKey pub;
+		G2::normalize(*cast(&pub.v), *cast(&pubVec[i].v));
+		if (!writeRegistryRecord(fp, sum, &pub, sizeof(pub))) return false;
+	}
+	if (withPrecomputed) {
+		const size_t end = registryPubOffset + n * sizeof(blsPublicKey);
+		const size_t pad = (registryAlign - end % registryAlign) % registryAlign;
+		if (!writeRegistryRecord(fp, sum, zero, pad)) return false;
+		h.ppubSize = sizeof(blsPublicKeyPrecomputed);
+		h.ppubOffset = end + pad;
+		blsPublicKeyPrecomputed *ppub = new (std::nothrow) blsPublicKeyPrecomputed;
+		if (ppub == 0) return false;
+		bool ok = true;
+		for (size_t i = 0; ok && i < n; i++) {
+			// clear the unused area so that the same keys make the same file
+			memset((void*)ppub, 0, sizeof(*ppub));
+			const G2& Q = *cast(&pubVec[i].v);
+			ppub->isZero = Q.isZero();
+			if (!ppub->isZero) precomputeG2(&ok, ppub->Qcoeff, Q);
+			ok = ok && writeRegistryRecord(fp, sum, ppub, sizeof(*ppub));
+		}
+		delete ppub;
+		if (!ok) return false;
+	}
+	h.checksum = sum.get();
+	return true;
+}
+
+int blsPublicKeyRegistryWrite(const char *path, const blsPublicKey *pubVec, mclSize n, int flags)
+{
+	for (size_t i = 0; i < n; i++) {
+		const G2& Q = *cast(&pubVec[i].v);
+		if (!Q.isValid() || !Q.isValidOrder()) return -1;
+	}
+	PublicKeyRegistryHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, registryMagic, sizeof(h.magic));
+	h.version = registryVersion;
+	h.endian = registryEndian;
+	h.curve = g_curveType;
+	h.compiledTimeVar = MCLBN_COMPILED_TIME_VAR;
+	h.unitSize = sizeof(mcl::fp::Unit);
+	h.flags = flags & BLS_REGISTRY_PRECOMPUTED;
+	h.n = n;
+	h.pubSize = sizeof(blsPublicKey);
+	FILE *fp = fopen(path, "wb");
+	if (fp == 0) return -1;
+	bool ok = writeRegistryRecords(fp, h, pubVec, n, (flags & BLS_REGISTRY_PRECOMPUTED) != 0);
+	// write the header at last to make it valid
+	ok = ok && fseek(fp, 0, SEEK_SET) == 0 && fwrite(&h, 1, sizeof(h), fp) == sizeof(h);
+	// pad the header to registryPubOffset because nothing is written after it if n = 0
+	const char zero[registryPubOffset - sizeof(h)] = {};
+	ok = ok && fwrite(zero, 1, sizeof(zero), fp) == sizeof(zero);
+	if (fclose(fp) != 0) ok = false;
+	if (!ok) {
+		remove(path);
+		return -1;
+	}
+	return 0;
+}
+
+struct blsPublicKeyRegistry {
+	bls::local::MappedFile file;
+	size_t n;
+	const blsPublicKey *pubVec;
+	const blsPublicKeyPrecomputed *ppubVec; // may be NULL
+};
+
+static bool isValidRegistryHeader(const PublicKeyRegistryHeader& h, size_t fileSize)
+{
+	if (memcmp(h.magic, registryMagic, sizeof(h.magic)) != 0) return false;
+	if (h.version != registryVersion || h.endian != registryEndian) return false;
+	if (h.curve != g_curveType || h.compiledTimeVar != MCLBN_COMPILED_TIME_VAR) return false;
+	if (h.unitSize != sizeof(mcl::fp::Unit) || h.pubSize != sizeof(blsPublicKey)) return false;
+	if (h.n > (fileSize - registryPubOffset) / sizeof(blsPublicKey)) return false;
+	const size_t end = registryPubOffset + size_t(h.n) * sizeof(blsPublicKey);
+	if (h.flags == 0) return h.ppubSize == 0 && h.ppubOffset == 0 && end == fileSize;
+	if (h.flags != BLS_REGISTRY_PRECOMPUTED) return false;
+	if (h.ppubSize != sizeof(blsPublicKeyPrecomputed)) return false;
+	if (h.ppubOffset < end || h.ppubOffset % registryAlign != 0 || h.ppubOffset > fileSize) return false;
+	return h.n == (fileSize - h.ppubOffset) / sizeof(blsPublicKeyPrecomputed) && (fileSize - h.ppubOffset) % sizeof(blsPublicKeyPrecomputed) == 0;
+}
+
+static bool openRegistry(blsPublicKeyRegistry *reg, const char *path, int flags)
+{
+	if (!reg->file.open(path, (flags & BLS_REGISTRY_HUGE_PAGE) != 0)) return false;
+	const size_t fileSize = reg->file.size();
+	const uint8_t *top = (const uint8_t*)reg->file.data();
+	if (fileSize < registryPubOffset) return false;
+	PublicKeyRegistryHeader h;
+	memcpy(&h, top, sizeof(h));
+	if (!isValidRegistryHeader(h, fileSize)) return false;
+	if (flags & BLS_REGISTRY_VERIFY_CHECKSUM) {
+		Fnv64 sum;
+		sum.update(top + registryPubOffset, fileSize - registryPubOffset);
+		if (sum.get() != h.checksum) return false;
+	}
+	reg->n = size_t(h.n);
+	reg->pubVec = (const blsPublicKey*)(top + registryPubOffset);
+	reg->ppubVec = h.ppubOffset ? (const blsPublicKeyPrecomputed*)(top + h.ppubOffset) : 0;
+	return true;
+}
+
+blsPublicKeyRegistry *blsPublicKeyRegistryOpen(const char *path, int flags)
+{
+	blsPublicKeyRegistry *reg = new (std::nothrow) blsPublicKeyRegistry;
+	if (reg == 0) return 0;
+	if (!openRegistry(reg, path, flags)) {
+		delete reg;
+		return 0;
+	}
+	return reg;
+}
+
+void blsPublicKeyRegistryClose(blsPublicKeyRegistry *reg)
+{
+	delete reg;
+}
+
+mclSize blsPublicKeyRegistryGetSize(const blsPublicKeyRegistry *reg)
+{
+	return reg->n;
+}
+
+const blsPublicKey *blsPublicKeyRegistryGetPublicKeys(const blsPublicKeyRegistry *reg)
+{
+	return reg->pubVec;
+}
+
+const blsPublicKeyPrecomputed *blsPublicKeyRegistryGetPrecomputed(const blsPublicKeyRegistry *reg, mclSize i)
+{
+	if (reg->ppubVec == 0 || i >= reg->n) return 0;
+	return &reg->ppubVec[i];
+}
+
 void blsSecretKeySub(blsSecretKey *sec, const blsSecretKey *rhs)
 {
 	mclBnFr_sub(&sec->v, &sec->v, &rhs->v);
@@ -0,0 +1,488 @@
+#pragma once
+/**
+	@file
+	@brief bounded caches shared by threads
+	@license modified new BSD license
+	http://opensource.org/licenses/BSD-3-Clause
+*/
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <new>
+
+namespace bls { namespace local {
+
+/*
+	LRU cache of std::shared_ptr<const V> keyed by a byte string
+	the entries are split into shardN shards by the hash of the key
+	and each shard has its own mutex, so there is no global lock
+	the estimated memory usage of the entries is kept under maxByteSize
+	a found value is alive while the caller holds it even if it is evicted
+*/
+template<class V>
+class LruCache {
+public:
+	typedef std::shared_ptr<const V> ValuePtr;
+	struct Stat {
+		uint64_t hit;
+		uint64_t miss;
+		uint64_t eviction;
+		size_t n; // the number of entries
+		size_t byteSize; // estimated memory usage
+	};
+private:
+	static const size_t shardN = 16;
+	struct Node {
+		std::string key;
+		ValuePtr v;
+		size_t byteSize;
+	};
+	typedef std::list<Node> List;
+	typedef std::unordered_map<std::string, typename List::iterator> Map;
+	struct Shard {
+		std::mutex m;
+		List lru; // the front is the most recently used
+		Map map;
+		size_t byteSize;
+		Shard() : byteSize(0) {}
+	};
+	Shard shardTbl_[shardN];
+	std::atomic<size_t> maxByteSize_;
+	std::atomic<uint64_t> hit_;
+	std::atomic<uint64_t> miss_;
+	std::atomic<uint64_t> eviction_;
+	LruCache(const LruCache&);
+	void operator=(const LruCache&);
+	Shard& getShard(const std::string& key)
+	{
+		return shardTbl_[std::hash<std::string>()(key) % shardN];
+	}
+	// remove the least recently used entries while byteSize > maxByteSize
+	void evict(Shard& s, size_t maxByteSize)
+	{
+		while (!s.lru.empty() && s.byteSize > maxByteSize) {
+			Node& node = s.lru.back();
+			s.byteSize -= node.byteSize;
+			s.map.erase(node.key);
+			s.lru.pop_back();
+			eviction_++;
+		}
+	}
+public:
+	explicit LruCache(size_t maxByteSize = 0)
+		: maxByteSize_(maxByteSize)
+		, hit_(0)
+		, miss_(0)
+		, eviction_(0)
+	{
+	}
+	// maxByteSize = 0 disables the cache
+	void setMaxByteSize(size_t maxByteSize)
+	{
+		maxByteSize_ = maxByteSize;
+		for (size_t i = 0; i < shardN; i++) {
+			Shard& s = shardTbl_[i];
+			std::lock_guard<std::mutex> lock(s.m);
+			evict(s, maxByteSize / shardN);
+		}
+	}
+	size_t getMaxByteSize() const { return maxByteSize_; }
+	// return an empty pointer if not found
+	ValuePtr find(const std::string& key)
+	{
+		Shard& s = getShard(key);
+		std::lock_guard<std::mutex> lock(s.m);
+		typename Map::iterator i = s.map.find(key);
+		if (i == s.map.end()) {
+			miss_++;
+			return ValuePtr();
+		}
+		hit_++;
+		s.lru.splice(s.lru.begin(), s.lru, i->second);
+		return i->second->v;
+	}
+	/*
+		insert or replace the value of key
+		@param byteSize [in] estimated memory usage of v
+	*/
+	void insert(const std::string& key, const ValuePtr& v, size_t byteSize)
+	{
+		const size_t maxByteSize = maxByteSize_ / shardN;
+		// the key is stored in the node and the map
+		byteSize += sizeof(Node) + key.size() * 2;
+		if (byteSize > maxByteSize) return;
+		Shard& s = getShard(key);
+		std::lock_guard<std::mutex> lock(s.m);
+		typename Map::iterator i = s.map.find(key);
+		if (i != s.map.end()) {
+			s.byteSize -= i->second->byteSize;
+			s.lru.erase(i->second);
+			s.map.erase(i);
+		}
+		Node node = { key, v, byteSize };
+		s.lru.push_front(node);
+		s.map[key] = s.lru.begin();
+		s.byteSize += byteSize;
+		evict(s, maxByteSize);
+	}
+	void clear()
+	{
+		for (size_t i = 0; i < shardN; i++) {
+			Shard& s = shardTbl_[i];
+			std::lock_guard<std::mutex> lock(s.m);
+			s.lru.clear();
+			s.map.clear();
+			s.byteSize = 0;
+		}
+	}
+	void getStat(Stat& stat)
+	{
+		stat.hit = hit_;
+		stat.miss = miss_;
+		stat.eviction = eviction_;
+		stat.n = 0;
+		stat.byteSize = 0;
+		for (size_t i = 0; i < shardN; i++) {
+			Shard& s = shardTbl_[i];
+			std::lock_guard<std::mutex> lock(s.m);
+			stat.n += s.map.size();
+			stat.byteSize += s.byteSize;
+		}
+	}
+};
+
+inline uint64_t rotl64(uint64_t x, int s) { return (x << s) | (x >> (64 - s)); }
+
+inline void sipRound(uint64_t v[4])
+{
+	v[0] += v[1]; v[1] = rotl64(v[1], 13); v[1] ^= v[0]; v[0] = rotl64(v[0], 32);
+	v[2] += v[3]; v[3] = rotl64(v[3], 16); v[3] ^= v[2];
+	v[0] += v[3]; v[3] = rotl64(v[3], 21); v[3] ^= v[0];
+	v[2] += v[1]; v[1] = rotl64(v[1], 17); v[1] ^= v[2]; v[2] = rotl64(v[2], 32);
+}
+
+inline uint64_t loadLE64(const uint8_t *p, size_t n = 8)
+{
+	uint64_t x = 0;
+	for (size_t i = 0; i < n; i++) {
+		x |= uint64_t(p[i]) << (i * 8);
+	}
+	return x;
+}
+
+/*
+	SipHash-2-4 with 128-bit output
+	a keyed hash whose output can not be predicted or forged without the key
+	update may be called many times and the digest is the same as that of the concatenated bytes
+*/
+class SipHash128 {
+	uint64_t v_[4];
+	uint64_t tail_; // the last n_ % 8 bytes
+	size_t n_; // the total byte size
+	void compress(uint64_t m)
+	{
+		v_[3] ^= m;
+		sipRound(v_);
+		sipRound(v_);
+		v_[0] ^= m;
+	}
+public:
+	explicit SipHash128(const uint64_t key[2])
+		: tail_(0)
+		, n_(0)
+	{
+		v_[0] = key[0] ^ 0x736f6d6570736575ull;
+		v_[1] = key[1] ^ 0x646f72616e646f6dull ^ 0xee;
+		v_[2] = key[0] ^ 0x6c7967656e657261ull;
+		v_[3] = key[1] ^ 0x7465646279746573ull;
+	}
+	void update(const void *buf, size_t n)
+	{
+		const uint8_t *p = (const uint8_t*)buf;
+		size_t r = n_ % 8;
+		n_ += n;
+		if (r > 0) {
+			while (r < 8 && n > 0) {
+				tail_ |= uint64_t(*p++) << (r * 8);
+				r++;
+				n--;
+			}
+			if (r < 8) return;
+			compress(tail_);
+			tail_ = 0;
+		}
+		for (; n >= 8; n -= 8) {
+			compress(loadLE64(p));
+			p += 8;
+		}
+		tail_ = loadLE64(p, n);
+	}
+	void final(uint64_t out[2])
+	{
+		compress(tail_ | (uint64_t(n_) << 56));
+		v_[2] ^= 0xee;
+		for (int i = 0; i < 4; i++) sipRound(v_);
+		out[0] = v_[0] ^ v_[1] ^ v_[2] ^ v_[3];
+		v_[1] ^= 0xdd;
+		for (int i = 0; i < 4; i++) sipRound(v_);
+		out[1] = v_[0] ^ v_[1] ^ v_[2] ^ v_[3];
+	}
+};
+
+inline void sipHash128(uint64_t out[2], const uint64_t key[2], const void *buf, size_t n)
+{
+	SipHash128 h(key);
+	h.update(buf, n);
+	h.final(out);
+}
+
+/*
+	bounded set of byte strings shared by threads
+	a string is stored as its 128-bit SipHash digest with a random key,
+	so a string can not be made to collide with a stored one without the key
+	the digests are in buckets of wayN slots (one cache line) and a bucket is chosen by the digest,
+	so threads touching different buckets do not share any cache line
+	find and insert are lock-free ; a new digest overwrites a slot chosen by the digest if the bucket is full
+	the reader and hit/miss counters are split into stripeN cache lines chosen by the thread
+	the two words of a slot are written separately and a reader may see a slot mixed from two digests,
+	but it matches only if both words match, which does not happen for random digests
+	reset and clear replace the table and wait for the readers of the old one
+*/
+class DigestSet {
+public:
+	struct Stat {
+		uint64_t hit;
+		uint64_t miss;
+		size_t n; // the number of stored digests
+		size_t byteSize; // memory usage of the table
+	};
+private:
+	static const size_t wayN = 4;
+	struct Slot {
+		std::atomic<uint64_t> v[2]; // zero if empty
+	};
+	struct Table {
+		uint64_t key[2];
+		size_t bucketN; // power of two
+		Slot *slot; // bucketN * wayN
+		std::vector<char> mem;
+		Table(size_t bucketN, const uint64_t key[2])
+			: bucketN(bucketN)
+			, mem(bucketN * wayN * sizeof(Slot) + 64)
+		{
+			this->key[0] = key[0];
+			this->key[1] = key[1];
+			// align the buckets to cache lines
+			slot = (Slot*)(((uintptr_t)mem.data() + 63) & ~uintptr_t(63));
+			for (size_t i = 0; i < bucketN * wayN; i++) {
+				new (&slot[i]) Slot;
+				slot[i].v[0] = 0;
+				slot[i].v[1] = 0;
+			}
+		}
+		Slot *getBucket(const uint64_t d[2]) const { return &slot[(d[1] & (bucketN - 1)) * wayN]; }
+		// feed(h) passes the string to h.update
+		template<class F>
+		void digest(uint64_t d[2], const F& feed) const
+		{
+			SipHash128 h(key);
+			feed(h);
+			h.final(d);
+			d[0] |= 1; // distinguish from an empty slot
+		}
+	};
+	struct BufFeeder {
+		const void *buf;
+		size_t n;
+		void operator()(SipHash128& h) const { h.update(buf, n); }
+	};
+	static const size_t stripeN = 16;
+	struct Stripe {
+		std::atomic<size_t> readerN[2];
+		std::atomic<uint64_t> hit;
+		std::atomic<uint64_t> miss;
+		char pad[64 - (sizeof(std::atomic<size_t>) * 2 + sizeof(std::atomic<uint64_t>) * 2) % 64];
+	};
+	std::atomic<Table*> tbl_;
+	/*
+		readers register themselves to stripe_[s].readerN[epoch_] while using tbl_
+		a writer swaps tbl_, flips epoch_ and waits for the readers of the old epoch
+	*/
+	std::atomic<size_t> epoch_;
+	std::atomic<size_t> byteSize_; // memory usage of the table
+	std::mutex writer_; // serializes the writers of tbl_
+	std::vector<char> stripeMem_;
+	Stripe *stripe_; // stripeN, aligned to cache lines
+	DigestSet(const DigestSet&);
+	void operator=(const DigestSet&);
+	static size_t getStripeIdx()
+	{
+		return std::hash<std::thread::id>()(std::this_thread::get_id()) % stripeN;
+	}
+	size_t acquire(Stripe& st)
+	{
+		for (;;) {
+			const size_t e = epoch_;
+			st.readerN[e]++;
+			if (epoch_ == e) return e;
+			st.readerN[e]--;
+		}
+	}
+	void release(Stripe& st, size_t e) { st.readerN[e]--; }
+	// replace the table by p and delete the old one ; writer_ must be locked
+	void replace(Table *p)
+	{
+		byteSize_ = p ? p->bucketN * wayN * sizeof(Slot) : 0;
+		Table *old = tbl_.exchange(p);
+		const size_t e = epoch_;
+		epoch_ = 1 - e;
+		for (size_t i = 0; i < stripeN; i++) {
+			while (stripe_[i].readerN[e] > 0) std::this_thread::yield();
+		}
+		delete old;
+	}
+	static size_t getBucketN(size_t maxByteSize)
+	{
+		const size_t bucketByteSize = sizeof(Slot) * wayN;
+		if (maxByteSize < bucketByteSize) return 0;
+		size_t n = 1;
+		while (n * 2 * bucketByteSize <= maxByteSize) n *= 2;
+		return n;
+	}
+public:
+	DigestSet()
+		: tbl_(0)
+		, epoch_(0)
+		, byteSize_(0)
+		, stripeMem_(stripeN * sizeof(Stripe) + 64)
+	{
+		stripe_ = (Stripe*)(((uintptr_t)stripeMem_.data() + 63) & ~uintptr_t(63));
+		for (size_t i = 0; i < stripeN; i++) {
+			Stripe *st = new (&stripe_[i]) Stripe;
+			st->readerN[0] = 0;
+			st->readerN[1] = 0;
+			st->hit = 0;
+			st->miss = 0;
+		}
+	}
+	~DigestSet() { delete tbl_.load(); }
+	/*
+		make an empty set of at most maxByteSize bytes with the hash key
+		maxByteSize < 64 disables the set
+	*/
+	void reset(size_t maxByteSize, const uint64_t key[2])
+	{
+		const size_t bucketN = getBucketN(maxByteSize);
+		std::lock_guard<std::mutex> lock(writer_);
+		replace(bucketN ? new Table(bucketN, key) : 0);
+	}
+	// memory usage of the table
+	size_t getByteSize() const { return byteSize_; }
+	bool isEnabled() const { return tbl_ != 0; }
+	bool find(const void *buf, size_t n)
+	{
+		const BufFeeder feed = { buf, n };
+		return findBy(feed);
+	}
+	void insert(const void *buf, size_t n)
+	{
+		const BufFeeder feed = { buf, n };
+		insertBy(feed);
+	}
+	// same as find and insert for the string given to SipHash128::update by feed(h)
+	template<class F>
+	bool findBy(const F& feed)
+	{
+		Stripe& st = stripe_[getStripeIdx()];
+		const size_t e = acquire(st);
+		const Table *p = tbl_;
+		bool found = false;
+		if (p) {
+			uint64_t d[2];
+			p->digest(d, feed);
+			const Slot *b = p->getBucket(d);
+			for (size_t i = 0; i < wayN; i++) {
+				if (b[i].v[0].load(std::memory_order_relaxed) == d[0] && b[i].v[1].load(std::memory_order_relaxed) == d[1]) {
+					found = true;
+					break;
+				}
+			}
+			if (found) {
+				st.hit.fetch_add(1, std::memory_order_relaxed);
+			} else {
+				st.miss.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+		release(st, e);
+		return found;
+	}
+	template<class F>
+	void insertBy(const F& feed)
+	{
+		Stripe& st = stripe_[getStripeIdx()];
+		const size_t e = acquire(st);
+		const Table *p = tbl_;
+		if (p) {
+			uint64_t d[2];
+			p->digest(d, feed);
+			Slot *b = p->getBucket(d);
+			// an empty slot or the slot chosen by the digest
+			size_t pos = (d[0] >> 1) % wayN;
+			for (size_t i = 0; i < wayN; i++) {
+				const uint64_t v0 = b[i].v[0].load(std::memory_order_relaxed);
+				if (v0 == d[0] && b[i].v[1].load(std::memory_order_relaxed) == d[1]) {
+					pos = wayN;
+					break;
+				}
+				if (v0 == 0) {
+					pos = i;
+					break;
+				}
+			}
+			if (pos < wayN) {
+				b[pos].v[0].store(d[0], std::memory_order_relaxed);
+				b[pos].v[1].store(d[1], std::memory_order_relaxed);
+			}
+		}
+		release(st, e);
+	}
+	// remove all the digests and use the new hash key
+	void clear(const uint64_t key[2])
+	{
+		std::lock_guard<std::mutex> lock(writer_);
+		// only the writers delete a table
+		const Table *p = tbl_;
+		if (p) replace(new Table(p->bucketN, key));
+	}
+	void getStat(Stat& stat)
+	{
+		stat.hit = 0;
+		stat.miss = 0;
+		for (size_t i = 0; i < stripeN; i++) {
+			stat.hit += stripe_[i].hit;
+			stat.miss += stripe_[i].miss;
+		}
+		stat.n = 0;
+		stat.byteSize = 0;
+		Stripe& st = stripe_[getStripeIdx()];
+		const size_t e = acquire(st);
+		const Table *p = tbl_;
+		if (p) {
+			for (size_t i = 0; i < p->bucketN * wayN; i++) {
+				if (p->slot[i].v[0].load(std::memory_order_relaxed)) stat.n++;
+			}
+		}
+		stat.byteSize = byteSize_;
+		release(st, e);
+	}
+};
+
+} } // bls::local
@@ -0,0 +1,105 @@
+#pragma once
+/**
+	@file
+	@brief read-only mapping of a file
+	@license modified new BSD license
+	http://opensource.org/licenses/BSD-3-Clause
+*/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__) && !defined(__wasm__)
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#define BLS_USE_MMAP
+#endif
+
+namespace bls { namespace local {
+
+/*
+	map a file read-only so that the processes mapping it share the physical pages
+	the file is read into memory if mmap is not available
+*/
+class MappedFile {
+	void *p_;
+	size_t size_;
+	bool isMapped_;
+	MappedFile(const MappedFile&);
+	void operator=(const MappedFile&);
+	bool read(const char *path)
+	{
+		FILE *fp = fopen(path, "rb");
+		if (fp == 0) return false;
+		bool ok = false;
+		if (fseek(fp, 0, SEEK_END) == 0) {
+			const long size = ftell(fp);
+			if (size > 0 && fseek(fp, 0, SEEK_SET) == 0) {
+				p_ = malloc(size_t(size));
+				if (p_ && fread(p_, 1, size_t(size), fp) == size_t(size)) {
+					size_ = size_t(size);
+					ok = true;
+				}
+			}
+		}
+		fclose(fp);
+		if (!ok) close();
+		return ok;
+	}
+public:
+	MappedFile() : p_(0), size_(0), isMapped_(false) {}
+	~MappedFile() { close(); }
+	/*
+		hugePage advises the kernel to back the mapping by huge pages
+		it is a hint and works only on a file system supporting it such as tmpfs
+	*/
+	bool open(const char *path, bool hugePage = false)
+	{
+		close();
+#ifdef BLS_USE_MMAP
+		int fd = ::open(path, O_RDONLY);
+		if (fd < 0) return false;
+		struct stat st;
+		if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+			::close(fd);
+			return false;
+		}
+		const size_t size = size_t(st.st_size);
+		void *p = mmap(0, size, PROT_READ, MAP_SHARED, fd, 0);
+		// the mapping keeps the file open
+		::close(fd);
+		if (p == MAP_FAILED) return false;
+	#ifdef MADV_HUGEPAGE
+		if (hugePage) madvise(p, size, MADV_HUGEPAGE);
+	#endif
+		p_ = p;
+		size_ = size;
+		isMapped_ = true;
+		return true;
+#else
+		(void)hugePage;
+		return read(path);
+#endif
+	}
+	void close()
+	{
+		if (p_ == 0) return;
+#ifdef BLS_USE_MMAP
+		if (isMapped_) {
+			munmap(p_, size_);
+		} else
+#endif
+		{
+			free(p_);
+		}
+		p_ = 0;
+		size_ = 0;
+		isMapped_ = false;
+	}
+	const void *data() const { return p_; }
+	size_t size() const { return size_; }
+};
+
+} } // bls::local
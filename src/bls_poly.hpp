@@ -0,0 +1,318 @@
+#pragma once
+/**
+	@file
+	@brief polynomial arithmetic over a prime field for fast multipoint evaluation
+	@license modified new BSD license
+	http://opensource.org/licenses/BSD-3-Clause
+*/
+#include <stddef.h>
+#include <vector>
+
+namespace bls { namespace local {
+
+/*
+	a polynomial is std::vector<F> of coefficients ; x[i] is the coefficient of X^i
+*/
+template<class F>
+struct Poly {
+	typedef std::vector<F> Vec;
+	// use Karatsuba multiplication if the shorter length >= karatsubaMinN
+	static const size_t karatsubaMinN = 32;
+	// use the division by Newton iteration if the degree of the divisor >= newtonDivMinN
+	static const size_t newtonDivMinN = 256;
+	// evaluate a remainder by Horner's method if the number of points <= leafN
+	static const size_t leafN = 32;
+
+	// z[0, xn + yn - 1) = x[0, xn) * y[0, yn) ; z must not overlap x and y
+	static void mul(F *z, const F *x, size_t xn, const F *y, size_t yn)
+	{
+		if (xn < yn) {
+			mul(z, y, yn, x, xn);
+			return;
+		}
+		if (yn == 0) return;
+		if (yn < karatsubaMinN) {
+			mulSchool(z, x, xn, y, yn);
+			return;
+		}
+		const size_t h = (xn + 1) / 2;
+		if (yn <= h) {
+			// z = x0 y + X^h x1 y
+			Vec t(xn - h + yn - 1);
+			mul(z, x, h, y, yn);
+			for (size_t i = h + yn - 1; i < xn + yn - 1; i++) {
+				z[i] = 0;
+			}
+			mul(&t[0], x + h, xn - h, y, yn);
+			for (size_t i = 0; i < t.size(); i++) {
+				z[h + i] += t[i];
+			}
+			return;
+		}
+		/*
+			x = x0 + X^h x1, y = y0 + X^h y1
+			z = z0 + X^h ((x0 + x1)(y0 + y1) - z0 - z2) + X^2h z2
+		*/
+		const size_t x1n = xn - h;
+		const size_t y1n = yn - h;
+		Vec xs(h), ys(h), m(2 * h - 1);
+		for (size_t i = 0; i < h; i++) {
+			xs[i] = x[i];
+			ys[i] = y[i];
+		}
+		for (size_t i = 0; i < x1n; i++) xs[i] += x[h + i];
+		for (size_t i = 0; i < y1n; i++) ys[i] += y[h + i];
+		mul(&m[0], &xs[0], h, &ys[0], h);
+		// z0 at z[0, 2h - 1) and z2 at z[2h, 2h + x1n + y1n - 1)
+		mul(z, x, h, y, h);
+		z[2 * h - 1] = 0;
+		mul(z + 2 * h, x + h, x1n, y + h, y1n);
+		for (size_t i = 0; i < 2 * h - 1; i++) {
+			m[i] -= z[i];
+		}
+		for (size_t i = 0; i < x1n + y1n - 1; i++) {
+			m[i] -= z[2 * h + i];
+		}
+		for (size_t i = 0; i < m.size(); i++) {
+			z[h + i] += m[i];
+		}
+	}
+	static void mulSchool(F *z, const F *x, size_t xn, const F *y, size_t yn)
+	{
+		for (size_t i = 0; i < xn + yn - 1; i++) {
+			z[i] = 0;
+		}
+		F t;
+		for (size_t i = 0; i < xn; i++) {
+			for (size_t j = 0; j < yn; j++) {
+				F::mul(t, x[i], y[j]);
+				z[i + j] += t;
+			}
+		}
+	}
+	static void mul(Vec& z, const Vec& x, const Vec& y)
+	{
+		if (x.empty() || y.empty()) {
+			z.clear();
+			return;
+		}
+		z.resize(x.size() + y.size() - 1);
+		mul(&z[0], &x[0], x.size(), &y[0], y.size());
+	}
+	/*
+		g = 1 / f mod X^n by Newton iteration
+		g_{2t} = g_t (2 - f g_t) mod X^{2t}
+		f[0] must not be zero
+	*/
+	static void inv(Vec& g, const Vec& f, size_t n)
+	{
+		g.resize(1);
+		F::inv(g[0], f[0]);
+		Vec fg, e;
+		for (size_t t = 1; t < n;) {
+			const size_t t2 = t * 2 < n ? t * 2 : n;
+			Vec fl(f.begin(), f.begin() + (f.size() < t2 ? f.size() : t2));
+			mul(fg, fl, g);
+			fg.resize(t2);
+			for (size_t i = 0; i < t2; i++) {
+				F::neg(fg[i], fg[i]);
+			}
+			fg[0] += 2;
+			mul(e, g, fg);
+			e.resize(t2);
+			g.swap(e);
+			t = t2;
+		}
+	}
+	/*
+		r = a mod p where p is monic
+		revInv = 1 / rev(p) mod X^n for some n >= a.size() - deg p if p is large
+	*/
+	static void mod(Vec& r, const Vec& a, const Vec& p, const Vec& revInv)
+	{
+		const size_t m = p.size() - 1;
+		if (a.size() <= m) {
+			r = a;
+			return;
+		}
+		const size_t qn = a.size() - m;
+		if (m < newtonDivMinN || revInv.size() < qn) {
+			modSchool(r, a, p);
+			return;
+		}
+		// rev(q) = rev(a) / rev(p) mod X^qn
+		Vec ra(qn), rq, q(qn), qp;
+		for (size_t i = 0; i < qn; i++) {
+			ra[i] = a[a.size() - 1 - i];
+		}
+		Vec ri(revInv.begin(), revInv.begin() + qn);
+		mul(rq, ra, ri);
+		for (size_t i = 0; i < qn; i++) {
+			q[i] = rq[qn - 1 - i];
+		}
+		// r = a - q p mod X^m
+		Vec qm(q.begin(), q.begin() + (qn < m ? qn : m));
+		Vec pm(p.begin(), p.begin() + m);
+		mul(qp, qm, pm);
+		r.resize(m);
+		for (size_t i = 0; i < m; i++) {
+			if (i < qp.size()) {
+				F::sub(r[i], a[i], qp[i]);
+			} else {
+				r[i] = a[i];
+			}
+		}
+	}
+	// long division by monic p
+	static void modSchool(Vec& r, const Vec& a, const Vec& p)
+	{
+		const size_t m = p.size() - 1;
+		r = a;
+		F t;
+		for (size_t i = r.size(); i-- > m;) {
+			const F& c = r[i];
+			for (size_t j = 0; j < m; j++) {
+				F::mul(t, c, p[j]);
+				r[i - m + j] -= t;
+			}
+		}
+		r.resize(m);
+	}
+	// return f(x) by Horner's method
+	static void eval(F& y, const Vec& f, const F& x)
+	{
+		if (f.empty()) {
+			y = 0;
+			return;
+		}
+		y = f[f.size() - 1];
+		for (size_t i = f.size() - 1; i > 0; i--) {
+			F::mul(y, y, x);
+			y += f[i - 1];
+		}
+	}
+};
+
+/*
+	subproduct tree of x[0, n) for multipoint evaluation
+	the node of [begin, end) has prod_{i in [begin, end)} (X - x[i])
+	the total cost is O(M(n) log n) where M(n) is the cost of multiplication
+*/
+template<class F>
+class SubproductTree {
+	typedef Poly<F> P;
+	typedef typename P::Vec Vec;
+	struct Node {
+		size_t begin, end;
+		Vec p; // prod (X - x[i])
+		int left, right; // child index or -1 for a leaf
+	};
+	const F *x_;
+	std::vector<Node> tbl_;
+	int build(size_t begin, size_t end)
+	{
+		const int idx = (int)tbl_.size();
+		tbl_.push_back(Node());
+		tbl_[idx].begin = begin;
+		tbl_[idx].end = end;
+		tbl_[idx].left = tbl_[idx].right = -1;
+		Vec p;
+		if (end - begin <= P::leafN) {
+			p.resize(1);
+			p[0] = 1;
+			Vec t(2);
+			t[1] = 1;
+			Vec u;
+			for (size_t i = begin; i < end; i++) {
+				F::neg(t[0], x_[i]);
+				P::mul(u, p, t);
+				p.swap(u);
+			}
+		} else {
+			const size_t mid = begin + (end - begin) / 2;
+			const int left = build(begin, mid);
+			const int right = build(mid, end);
+			tbl_[idx].left = left;
+			tbl_[idx].right = right;
+			P::mul(p, tbl_[left].p, tbl_[right].p);
+		}
+		tbl_[idx].p.swap(p);
+		return idx;
+	}
+	static size_t deg(const Node& node) { return node.p.size() - 1; }
+	static bool useNewton(const Node& node) { return deg(node) >= P::newtonDivMinN; }
+	/*
+		revInv = 1 / rev(child.p) mod X^n
+		1 / rev(child.p) = rev(sibling.p) / rev(parent.p)
+		because rev(parent.p) = rev(child.p) rev(sibling.p)
+	*/
+	static void getChildRevInv(Vec& revInv, const Node& sibling, const Vec& parentRevInv, size_t n)
+	{
+		Vec r(sibling.p.rbegin(), sibling.p.rend());
+		if (r.size() > n) r.resize(n);
+		Vec pi(parentRevInv.begin(), parentRevInv.begin() + n);
+		P::mul(revInv, r, pi);
+		revInv.resize(n);
+	}
+	/*
+		evaluate f at x[node.begin, node.end)
+		revInv = 1 / rev(node.p) mod X^(deg f + 1 - deg node.p) if useNewton(node)
+	*/
+	void evalSub(F *y, int idx, const Vec& f, const Vec& revInv) const
+	{
+		const Node& node = tbl_[idx];
+		Vec r;
+		P::mod(r, f, node.p, revInv);
+		if (node.left < 0) {
+			for (size_t i = node.begin; i < node.end; i++) {
+				P::eval(y[i], r, x_[i]);
+			}
+			return;
+		}
+		evalSubChildren(y, node, r, revInv);
+	}
+	void evalSubChildren(F *y, const Node& node, const Vec& r, const Vec& revInv) const
+	{
+		const Node& left = tbl_[node.left];
+		const Node& right = tbl_[node.right];
+		// the quotient of r by a child is shorter than the degree of the sibling
+		Vec leftInv, rightInv;
+		if (useNewton(left)) getChildRevInv(leftInv, right, revInv, deg(right));
+		if (useNewton(right)) getChildRevInv(rightInv, left, revInv, deg(left));
+		evalSub(y, node.left, r, leftInv);
+		evalSub(y, node.right, r, rightInv);
+	}
+public:
+	SubproductTree(const F *x, size_t n)
+		: x_(x)
+	{
+		tbl_.reserve(4 * (n / P::leafN + 1));
+		build(0, n);
+	}
+	// prod_i (X - x[i])
+	const Vec& getRoot() const { return tbl_[0].p; }
+	/*
+		y[i] = f(x[i]) for i in [0, n)
+		deg f must be less than n
+	*/
+	void eval(F *y, const Vec& f) const
+	{
+		const Node& root = tbl_[0];
+		if (root.left < 0) {
+			for (size_t i = root.begin; i < root.end; i++) {
+				P::eval(y[i], f, x_[i]);
+			}
+			return;
+		}
+		Vec revInv;
+		const Node& left = tbl_[root.left];
+		const Node& right = tbl_[root.right];
+		if (useNewton(left) || useNewton(right)) {
+			Vec r(root.p.rbegin(), root.p.rend());
+			P::inv(revInv, r, deg(left) > deg(right) ? deg(left) : deg(right));
+		}
+		evalSubChildren(y, root, f, revInv);
+	}
+};
+
+} } // bls::local
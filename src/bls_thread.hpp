@@ -0,0 +1,395 @@
+#pragma once
+/**
+	@file
+	@brief split a loop over several threads
+	@license modified new BSD license
+	http://opensource.org/licenses/BSD-3-Clause
+*/
+#include <stddef.h>
+#include <cybozu/inttype.hpp>
+
+#if !defined(__EMSCRIPTEN__) && !defined(__wasm__) && defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+	#include <thread>
+	#include <vector>
+	#include <atomic>
+	#include <mutex>
+	#include <condition_variable>
+	#define BLS_USE_STD_THREAD
+#endif
+
+namespace bls { namespace local {
+
+typedef void (*TaskFunc)(void *arg);
+// exec(self, task, arg) calls task(arg) once on any thread
+typedef void (*ExecutorFunc)(void *self, TaskFunc task, void *arg);
+
+#ifdef BLS_USE_STD_THREAD
+/*
+	taskN tasks run by at most dqN participants
+	the participant p has a deque of task indices [begin, end) packed into dq_[p]
+	it pops the front of its own deque and steals the back half of another one by CAS
+	p = 0 is the caller of parallelFor and the others join by join()
+*/
+class Job {
+	std::vector<std::atomic<uint64_t> > dq_;
+	std::atomic<size_t> joinN_; // the deque index for the next participant
+	std::atomic<size_t> remainN_; // the number of the unfinished tasks
+	size_t refN_; // the number of the participants except for the caller ; guarded by m_
+	std::mutex m_;
+	std::condition_variable cv_;
+	Job(const Job&);
+	void operator=(const Job&);
+	static uint64_t pack(uint64_t begin, uint64_t end) { return begin | (end << 32); }
+	bool pop(size_t p, size_t& idx)
+	{
+		uint64_t v = dq_[p].load(std::memory_order_acquire);
+		for (;;) {
+			const uint64_t b = v & 0xffffffff, e = v >> 32;
+			if (b >= e) return false;
+			if (dq_[p].compare_exchange_weak(v, pack(b + 1, e), std::memory_order_acq_rel)) {
+				idx = size_t(b);
+				return true;
+			}
+		}
+	}
+	// the deque of p must be empty
+	bool steal(size_t p, size_t& idx)
+	{
+		const size_t dqN = dq_.size();
+		for (size_t i = 1; i < dqN; i++) {
+			const size_t q = (p + i) % dqN;
+			uint64_t v = dq_[q].load(std::memory_order_acquire);
+			for (;;) {
+				const uint64_t b = v & 0xffffffff, e = v >> 32;
+				if (b >= e) break;
+				const uint64_t k = (e - b + 1) / 2;
+				if (dq_[q].compare_exchange_weak(v, pack(b, e - k), std::memory_order_acq_rel)) {
+					idx = size_t(e - k);
+					if (k > 1) dq_[p].store(pack(e - k + 1, e), std::memory_order_release);
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+	void finish()
+	{
+		if (remainN_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			std::lock_guard<std::mutex> lk(m_);
+			cv_.notify_all();
+		}
+	}
+protected:
+	virtual void call(size_t idx) = 0;
+public:
+	Job(size_t taskN, size_t dqN)
+		: dq_(dqN)
+		, joinN_(1)
+		, remainN_(taskN)
+		, refN_(0)
+	{
+		for (size_t p = 0; p < dqN; p++) {
+			dq_[p].store(pack(taskN * p / dqN, taskN * (p + 1) / dqN), std::memory_order_relaxed);
+		}
+	}
+	virtual ~Job() {}
+	// run the tasks until all of them are taken
+	void run(size_t p)
+	{
+		size_t idx;
+		while (pop(p, idx) || steal(p, idx)) {
+			call(idx);
+			finish();
+		}
+	}
+	bool canJoin() const
+	{
+		return joinN_.load(std::memory_order_relaxed) < dq_.size() && remainN_.load(std::memory_order_relaxed) > 0;
+	}
+	// call enter() before join() and leave() after it
+	void enter()
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		refN_++;
+	}
+	void join()
+	{
+		const size_t p = joinN_.fetch_add(1, std::memory_order_relaxed);
+		if (p < dq_.size()) run(p);
+	}
+	void leave()
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		refN_--;
+		if (refN_ == 0) cv_.notify_all();
+	}
+	// wait for all the tasks and the participants
+	void wait()
+	{
+		std::unique_lock<std::mutex> lk(m_);
+		while (remainN_.load(std::memory_order_acquire) > 0 || refN_ > 0) {
+			cv_.wait(lk);
+		}
+	}
+	static void runTask(void *arg)
+	{
+		Job *job = (Job*)arg;
+		job->join();
+		job->leave();
+	}
+};
+
+template<class F>
+class RangeJob : public Job {
+	F& f_;
+	size_t n_;
+	size_t taskN_;
+	void call(size_t idx) { f_(idx, n_ * idx / taskN_, n_ * (idx + 1) / taskN_); }
+public:
+	RangeJob(F& f, size_t n, size_t taskN, size_t dqN)
+		: Job(taskN, dqN)
+		, f_(f)
+		, n_(n)
+		, taskN_(taskN)
+	{
+	}
+};
+
+/*
+	workerN threads sleep while there is no job to join
+	the jobs are added and removed with the lock but the tasks are taken without it
+*/
+class ThreadPool {
+	std::mutex m_;
+	std::condition_variable cv_;
+	std::vector<std::thread> workerVec_;
+	std::vector<Job*> jobVec_;
+	bool quit_;
+	ThreadPool(const ThreadPool&);
+	void operator=(const ThreadPool&);
+	void work()
+	{
+		std::unique_lock<std::mutex> lk(m_);
+		for (;;) {
+			if (quit_) return;
+			Job *job = 0;
+			for (size_t i = 0; i < jobVec_.size(); i++) {
+				if (jobVec_[i]->canJoin()) {
+					job = jobVec_[i];
+					break;
+				}
+			}
+			if (job == 0) {
+				cv_.wait(lk);
+				continue;
+			}
+			job->enter();
+			lk.unlock();
+			job->join();
+			job->leave();
+			lk.lock();
+		}
+	}
+public:
+	ThreadPool() : quit_(false) {}
+	~ThreadPool() { stop(); }
+	size_t getWorkerNum() const { return workerVec_.size(); }
+	void start(size_t workerN)
+	{
+		quit_ = false;
+		for (size_t i = 0; i < workerN; i++) {
+			workerVec_.push_back(std::thread(&ThreadPool::work, this));
+		}
+	}
+	void stop()
+	{
+		{
+			std::lock_guard<std::mutex> lk(m_);
+			quit_ = true;
+		}
+		cv_.notify_all();
+		for (size_t i = 0; i < workerVec_.size(); i++) {
+			workerVec_[i].join();
+		}
+		workerVec_.clear();
+	}
+	void add(Job *job)
+	{
+		{
+			std::lock_guard<std::mutex> lk(m_);
+			jobVec_.push_back(job);
+		}
+		cv_.notify_all();
+	}
+	// a worker can not enter job after this
+	void remove(Job *job)
+	{
+		std::lock_guard<std::mutex> lk(m_);
+		for (size_t i = 0; i < jobVec_.size(); i++) {
+			if (jobVec_[i] == job) {
+				jobVec_.erase(jobVec_.begin() + i);
+				return;
+			}
+		}
+	}
+};
+
+/*
+	where parallelFor runs the tasks
+	poolN = 0 : a new thread per task if threadN > 1 is given explicitly (default)
+	poolN > 0 : poolN - 1 workers of pool and the caller
+	exec != 0 : execN - 1 tasks given to exec and the caller
+*/
+struct Scheduler {
+	size_t poolN;
+	ThreadPool pool;
+	ExecutorFunc exec;
+	void *execSelf;
+	size_t execN;
+	Scheduler() : poolN(0), exec(0), execSelf(0), execN(0) {}
+};
+
+inline Scheduler& getScheduler()
+{
+	static Scheduler s;
+	return s;
+}
+#endif
+
+/*
+	use the pool of n threads (n = 0 means the number of cores) for parallelFor
+	return false if there is no thread support
+	@note not thread safe
+*/
+inline bool setThreadNum(size_t n)
+{
+#ifdef BLS_USE_STD_THREAD
+	if (n == 0) {
+		n = std::thread::hardware_concurrency();
+		if (n == 0) n = 1;
+	}
+	Scheduler& s = getScheduler();
+	s.pool.stop();
+	s.pool.start(n - 1);
+	s.poolN = n;
+	return true;
+#else
+	(void)n;
+	return false;
+#endif
+}
+
+/*
+	use exec for parallelFor (the pool if exec = 0)
+	threadN is the number of threads including the caller of parallelFor
+	return false if there is no thread support
+	@note not thread safe
+*/
+inline bool setExecutor(ExecutorFunc exec, void *self, size_t threadN)
+{
+#ifdef BLS_USE_STD_THREAD
+	Scheduler& s = getScheduler();
+	s.exec = exec;
+	s.execSelf = self;
+	s.execN = threadN == 0 ? 1 : threadN;
+	return true;
+#else
+	(void)exec;
+	(void)self;
+	(void)threadN;
+	return false;
+#endif
+}
+
+/*
+	return the number of threads to be used
+	threadN = 0 means the number of threads given by setThreadNum or setExecutor (1 by default)
+*/
+inline size_t getThreadNum(size_t threadN)
+{
+#ifdef BLS_USE_STD_THREAD
+	if (threadN == 0) {
+		const Scheduler& s = getScheduler();
+		if (s.exec) return s.execN;
+		if (s.poolN) return s.poolN;
+		return 1;
+	}
+	return threadN;
+#else
+	(void)threadN;
+	return 1;
+#endif
+}
+
+/*
+	return the number of threads to be used for n tasks
+	each thread has at least minTaskN tasks
+*/
+inline size_t getThreadNum(size_t threadN, size_t n, size_t minTaskN = 1)
+{
+	threadN = getThreadNum(threadN);
+	if (minTaskN == 0) minTaskN = 1;
+	const size_t maxN = n / minTaskN;
+	if (threadN > maxN) threadN = maxN;
+	if (threadN == 0) threadN = 1;
+	return threadN;
+}
+
+template<class F>
+struct RangeCaller {
+	F *f;
+	size_t idx;
+	size_t begin;
+	size_t end;
+	void operator()() const { (*f)(idx, begin, end); }
+};
+
+/*
+	split [0, n) into threadN ranges and call f(idx, begin, end) for idx = 0, ..., threadN - 1
+	threadN should be getThreadNum(threadN, n)
+	the ranges are run by the pool or the executor if set and the caller joins them
+	otherwise f(0, ...) runs on the caller thread and the others on new threads
+*/
+template<class F>
+void parallelFor(F& f, size_t n, size_t threadN)
+{
+	if (n == 0) return;
+#ifdef BLS_USE_STD_THREAD
+	if (threadN > 1) {
+		Scheduler& s = getScheduler();
+		if (s.exec || s.poolN) {
+			if (threadN > 0xffffffff) threadN = 0xffffffff;
+			size_t dqN = s.exec ? s.execN : s.pool.getWorkerNum() + 1;
+			if (dqN > threadN) dqN = threadN;
+			RangeJob<F> job(f, n, threadN, dqN);
+			if (s.exec) {
+				for (size_t i = 1; i < dqN; i++) {
+					job.enter();
+					s.exec(s.execSelf, Job::runTask, &job);
+				}
+				job.run(0);
+			} else {
+				if (dqN > 1) s.pool.add(&job);
+				job.run(0);
+				if (dqN > 1) s.pool.remove(&job);
+			}
+			job.wait();
+			return;
+		}
+		std::vector<std::thread> tv;
+		tv.reserve(threadN - 1);
+		for (size_t i = 1; i < threadN; i++) {
+			RangeCaller<F> c = { &f, i, n * i / threadN, n * (i + 1) / threadN };
+			tv.push_back(std::thread(c));
+		}
+		f(0, 0, n / threadN);
+		for (size_t i = 0; i < tv.size(); i++) {
+			tv[i].join();
+		}
+		return;
+	}
+#endif
+	f(0, 0, n);
+}
+
+} } // bls::local
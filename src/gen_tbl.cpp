@@ -0,0 +1,144 @@
+/*
+	generate the static tables of Q loaded by blsInit
+	usage: gen_tbl.exe [dir [curve ...]]
+	write qcoeff-<curve>.hpp and qtbl-<curve>.hpp into dir (default ./src)
+	curve is bn254, bn381_1 or bls12_381 (all of them by default)
+*/
+#define MCLBN_FP_UNIT_SIZE 6
+#define BLS_DONT_USE_STATIC_TBL
+#include "bls_c_impl.hpp"
+#include <string>
+
+// the i-th 64-bit word of x
+static uint64_t getWord(const Fp& x, size_t i)
+{
+	const mcl::fp::Unit *p = x.getUnit();
+#if MCL_SIZEOF_UNIT == 8
+	return p[i];
+#else
+	return p[i * 2] | (uint64_t(p[i * 2 + 1]) << 32);
+#endif
+}
+
+static void putFp(FILE *fp, const Fp& x)
+{
+	fprintf(fp, "\t\t{");
+	for (int i = 0; i < mclBn_getOpUnitSize(); i++) {
+		fprintf(fp, "0x%016llxull,", (unsigned long long)getWord(x, i));
+	}
+	fprintf(fp, "},\n");
+}
+
+static bool putQcoeff(const std::string& path, const char *name)
+{
+	FILE *fp = fopen(path.c_str(), "w");
+	if (fp == 0) return false;
+	fprintf(fp, "static const uint64_t QcoeffTbl%s[][6][%d] = {\n", name, mclBn_getOpUnitSize());
+	for (size_t i = 0; i < g_ctx.Qcoeff.size(); i++) {
+		const Fp *x6 = g_ctx.Qcoeff[i].getFp0();
+		fprintf(fp, "\t{\n");
+		for (size_t j = 0; j < 6; j++) {
+			putFp(fp, x6[j]);
+		}
+		fprintf(fp, "\t},\n");
+	}
+	fprintf(fp, "};\n");
+	return fclose(fp) == 0;
+}
+
+// Fnv64 of the words of QTbl and Qcoeff in this order checked by loadStaticTbl
+static void updateHash(Fnv64& h, const Fp& x)
+{
+	for (int i = 0; i < mclBn_getOpUnitSize(); i++) {
+		const uint64_t v = getWord(x, i);
+		h.update(&v, sizeof(v));
+	}
+}
+
+static uint64_t getTblHash()
+{
+	Fnv64 h;
+	for (size_t i = 0; i < g_ctx.QTbl.size(); i++) {
+		G2 P = g_ctx.QTbl[i];
+		P.normalize();
+		const Fp *tbl[] = { &P.x.a, &P.x.b, &P.y.a, &P.y.b };
+		for (size_t j = 0; j < 4; j++) {
+			updateHash(h, *tbl[j]);
+		}
+	}
+	for (size_t i = 0; i < g_ctx.Qcoeff.size(); i++) {
+		const Fp *x6 = g_ctx.Qcoeff[i].getFp0();
+		for (size_t j = 0; j < 6; j++) {
+			updateHash(h, x6[j]);
+		}
+	}
+	return h.get();
+}
+
+static bool putQTbl(const std::string& path, const char *name)
+{
+	FILE *fp = fopen(path.c_str(), "w");
+	if (fp == 0) return false;
+	fprintf(fp, "/*\n");
+	fprintf(fp, "\tQTbl%s[i * %d + j] = (2j + 1) 2^(%di) Q for i in [0, %d), j in [0, %d)\n", name, int(ctTblHalfN), int(ctTblW), int(getCtTblWinN()), int(ctTblHalfN));
+	fprintf(fp, "\t{x.a, x.b, y.a, y.b} in Montgomery form\n");
+	fprintf(fp, "*/\n");
+	fprintf(fp, "static const uint64_t QTbl%s[][4][%d] = {\n", name, mclBn_getOpUnitSize());
+	for (size_t i = 0; i < g_ctx.QTbl.size(); i++) {
+		G2 P = g_ctx.QTbl[i];
+		P.normalize();
+		fprintf(fp, "\t{\n");
+		putFp(fp, P.x.a);
+		putFp(fp, P.x.b);
+		putFp(fp, P.y.a);
+		putFp(fp, P.y.b);
+		fprintf(fp, "\t},\n");
+	}
+	fprintf(fp, "};\n");
+	fprintf(fp, "static const uint64_t QTblHash%s = 0x%016llxull;\n", name, (unsigned long long)getTblHash());
+	return fclose(fp) == 0;
+}
+
+static bool isSelected(int argc, char *argv[], const char *file)
+{
+	if (argc <= 2) return true;
+	for (int i = 2; i < argc; i++) {
+		if (strcmp(argv[i], file) == 0) return true;
+	}
+	return false;
+}
+
+int main(int argc, char *argv[])
+{
+	const std::string dir = argc > 1 ? argv[1] : "./src";
+	const struct {
+		int curve;
+		const char *name; // suffix of the table
+		const char *file; // suffix of the file
+	} tbl[] = {
+		{ MCL_BN254, "BN254", "bn254" },
+		{ MCL_BN381_1, "BN381_1", "bn381_1" },
+		{ MCL_BLS12_381, "BLS12_381", "bls12_381" },
+	};
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		if (!isSelected(argc, argv, tbl[i].file)) continue;
+		if (blsInit(tbl[i].curve, MCLBN_COMPILED_TIME_VAR) != 0) {
+			fprintf(stderr, "err blsInit %s\n", tbl[i].name);
+			return 1;
+		}
+		// the first entry of QTbl must be Q because blsInit reads Q from it
+		G2 Q = g_ctx.QTbl[0];
+		Q.normalize();
+		if (Q != getQ()) {
+			fprintf(stderr, "err QTbl[0] != Q %s\n", tbl[i].name);
+			return 1;
+		}
+		const std::string qcoeff = dir + "/qcoeff-" + tbl[i].file + ".hpp";
+		const std::string qtbl = dir + "/qtbl-" + tbl[i].file + ".hpp";
+		if (!putQcoeff(qcoeff, tbl[i].name) || !putQTbl(qtbl, tbl[i].name)) {
+			fprintf(stderr, "err write %s\n", tbl[i].name);
+			return 1;
+		}
+		printf("%s %s\n", qcoeff.c_str(), qtbl.c_str());
+	}
+}
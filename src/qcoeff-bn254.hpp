@@ -1,4 +1,3 @@
-#if MCL_SIZEOF_UNIT == 8
 static const uint64_t QcoeffTblBN254[][6][4] = {
 	{
 		{0x8c5c1b842e501310ull,0x6a418cdaced77710ull,0xf5ad725dd0d9a5ffull,0x012d501f32362f48ull,},
@@ -561,4 +560,3 @@ static const uint64_t QcoeffTblBN254[][6][4] = {
 		{0x1a105d54bc290b18ull,0xa7e1a7c716529370ull,0x6e5a6c5b44350fd0ull,0x1fd2ae638488fccbull,},
 	},
 };
-#endif
@@ -0,0 +1,3079 @@
+/*
+	QTblBN254[i * 8 + j] = (2j + 1) 2^(4i) Q for i in [0, 64), j in [0, 8)
+	{x.a, x.b, y.a, y.b} in Montgomery form
+*/
+static const uint64_t QTblBN254[][4][4] = {
+	{
+		{0xad3e48d252eca0b2ull,0x883eb9edff5cf651ull,0xececbff3c8f6c1ffull,0x14f0a73f8023038bull,},
+		{0xb5cf1314f327bd46ull,0x2b00b07f55e721b4ull,0xc005f9150e52d775ull,0x0098f380f485a10cull,},
+		{0xa52d79c60552c985ull,0x8c4ff7b0d3a61c46ull,0x41e61912e3ba4293ull,0x1083a48ac11886e3ull,},
+		{0x21d77b1089052925ull,0x9ace8352b719ca43ull,0x6fad59af11116cd8ull,0x104b45d649cba1d6ull,},
+	},
+	{
+		{0xa5f13d6c033d3337ull,0x285a0068024cdf5cull,0x4f03af684ff40cacull,0x163ca147d69a3fb8ull,},
+		{0xe15269b85b91de06ull,0x086eebb720904857ull,0xedd128e7253287efull,0x20e470d9d7e48b6eull,},
+		{0xe7465c6c6b9d652cull,0xf427a5aae8520fcbull,0x00a425b1d1d63009ull,0x0b15deff03691dbdull,},
+		{0x66a9fcba8e00f8d4ull,0xb7963a60268853f8ull,0xaa493a155c73a837ull,0x0adaa6574b1933daull,},
+	},
+	{
+		{0x87bf9662c5a45812ull,0x0653f48f13637961ull,0x3c8b48acb818c29aull,0x0d1b3211995b7b32ull,},
+		{0x1825cd4aee6a6bdfull,0x94ac66f2d14cf5ebull,0x9a2a0bf0e73f6295ull,0x1d9dd33a87602238ull,},
+		{0xd67d61229ba0f614ull,0x4e4d5565b40c4cfaull,0x07ccb628dc49b2c5ull,0x207cc36b2a23da6dull,},
+		{0xf898c5603fce89b1ull,0x88fc5801e60d8711ull,0xc22ff1a8359ba8a7ull,0x105d99b00be2d974ull,},
+	},
+	{
+		{0xc191f6eb12d1403bull,0x611173d0b0656f6eull,0xaf812bd745a699b5ull,0x1f8c11af208c7197ull,},
+		{0x551b190bae9b5affull,0x67e6c0468badfbe1ull,0x4ce8171fca2f04c0ull,0x21a9519cf5cdf4f7ull,},
+		{0x1ee749f25322a7aeull,0x4d551edca7f6d0f9ull,0xf10f203c49948b3dull,0x1a4c15022dac7686ull,},
+		{0x7af7f5bc7bc1a3a7ull,0xd004298184664778ull,0xaf3be270a24e1f74ull,0x113df5da856f8a08ull,},
+	},
+	{
+		{0x0ee4d3b95cc72524ull,0xb15855d8d294fce8ull,0x859d7fe696a4d83aull,0x0aa893ebf6843782ull,},
+		{0xa04eea0310a11b12ull,0xe044714213e779a1ull,0xc55e9908eea6c3bdull,0x1f17fdc83654cafaull,},
+		{0x00e212eb58520dbfull,0x62d231476c961b5cull,0xc0612c218ea33303ull,0x00f5b9c96ca09fa7ull,},
+		{0x4c0fbdf8d6cf1be4ull,0x751deaaafc69c5bbull,0xbbe8d18d6e0180f2ull,0x09999abb0cdef789ull,},
+	},
+	{
+		{0xefb23294b5963d44ull,0x5216f784c4cab3b6ull,0x80afeeb77b62c67bull,0x213a89ff35bb66f4ull,},
+		{0x0e10e4b8e195e709ull,0x9b6d6edc2a184c23ull,0x7938b77c2963583cull,0x1b7e741ce271591aull,},
+		{0x9ef1f742c68b6584ull,0x53b46ff47bf0e80eull,0x79dc67bbad4c5ad5ull,0x0231041fefe530f7ull,},
+		{0x85020ffaeef4ef1cull,0x06b0497f8321b67eull,0x716fcd8663445d22ull,0x02a0f4f870af2dd8ull,},
+	},
+	{
+		{0x73e246d8076d78ceull,0x5c2329e2c9dd4b57ull,0x1e20624ae02d43e9ull,0x1be8a3520a4ee09dull,},
+		{0x130b14a310a56d68ull,0x48232b50b840295cull,0xd28219cc2556665cull,0x1548e667fb6b67f5ull,},
+		{0x4a7887204d563ba7ull,0x1c7646fe5507a93dull,0xfb9d4176632801f2ull,0x0dbd8300da4aaa22ull,},
+		{0x19bb803dbd6a3d8bull,0xbe96bb4f17f2d8bbull,0x122449b5cbd54a63ull,0x234ca60510359b73ull,},
+	},
+	{
+		{0x6e314565b98f10ffull,0xbe77b2b051a1eb92ull,0x3bf00217dc060632ull,0x152b475258654febull,},
+		{0xb43041a071b3f94dull,0x846ebcf258df6e2bull,0x9b5b7b347c714020ull,0x16ae9f7f787d524full,},
+		{0x9e0fc0fc11c28c4eull,0x655fc5a88d98e387ull,0x1e2ca7553ed71276ull,0x1184c89920aa490dull,},
+		{0x4cca720f0cd70404ull,0x92784cbb0be0335eull,0x52c9e88d3235a318ull,0x0a498ab11c1150fcull,},
+	},
+	{
+		{0x5ad6544ebf0040e8ull,0xba97d6ceb5ac1067ull,0x5dc75c1bcacab271ull,0x1bc04c782f9e5d14ull,},
+		{0xae594ba5749b6a01ull,0x4f21f00ac4c71776ull,0x2d224bd2a87ce5e0ull,0x24f91b0cbcd7f381ull,},
+		{0x8f3c436257571a67ull,0x0bc1d6254683c581ull,0xe49e466f35c5a32full,0x172b3c39e55462a4ull,},
+		{0x43f040e2affba227ull,0x3840b6af271086edull,0x9b7b3dcead203717ull,0x076c9cbed33acc2eull,},
+	},
+	{
+		{0xfb8ebba3e23ffdc6ull,0x8f619d2b4aece457ull,0x8e3217faba130ffcull,0x245b71b817840ab2ull,},
+		{0x8775b041a75354dbull,0xa11ae9cfb7719802ull,0xf35e55dc193b43b1ull,0x1d99670119e7ad65ull,},
+		{0xd138da44e79f8d6bull,0x1f9b5350acc036deull,0xc76cb19812728a40ull,0x029153fca9f0eeefull,},
+		{0xfe293f15c1af36ccull,0x293e8de6911b9055ull,0x6e0515fc3c741ea4ull,0x1d758cb882e5ea95ull,},
+	},
+	{
+		{0xa32fa30dca5f5e5cull,0x2c7c4ae6a79f63d6ull,0x9e91fcd8d7b483a9ull,0x0ba1f003d953706cull,},
+		{0x2f5979aa384dd13full,0x11946864862d7889ull,0x87e88550e1563d3full,0x0445c389fc2c9d4dull,},
+		{0xcc8813837185e91eull,0x1c5e1b1a90e3117dull,0x3a95797c8349f5b9ull,0x06189da69209c8a7ull,},
+		{0x7dd892935e55376eull,0xc2037f90e9e9abd3ull,0x5aed576d9f343b06ull,0x046fd72f3e9286f9ull,},
+	},
+	{
+		{0xdbb10e671cce4b63ull,0xa417c29c67b335ccull,0x56b73dfd5ea5bb32ull,0x165b073ff0cabfcfull,},
+		{0xfb3556bf50969ebdull,0x3a9738888f55eeafull,0x7e306a4da2440be1ull,0x11c6673f940866a1ull,},
+		{0xee128f0e11bbd9a5ull,0x8f33d6fa49d88374ull,0xc8a45c02ec3820b3ull,0x1e04913ffc6c2cccull,},
+		{0x5a46e65b75a0e556ull,0x11b5af1a8f0ad266ull,0x384209f2d88d8582ull,0x06fdaa024ad20a8eull,},
+	},
+	{
+		{0x8de52fa19768d3deull,0xac700e103e011ed6ull,0x5e14f38a17bb9726ull,0x20ff5096848ec297ull,},
+		{0x681c8cf9487d0caaull,0x214b414c45e80c7dull,0xb326a658bbe6e677ull,0x12ea0099ae2dee7bull,},
+		{0x6deb37f61c7b7901ull,0x10056cb932cd9a44ull,0x7137464e9d882d43ull,0x21b91a57790c58bfull,},
+		{0xb8fa7de3f1068a03ull,0x6e65cdf4873ab587ull,0x9ef174ad26ce1de5ull,0x1455bca335bcb0ecull,},
+	},
+	{
+		{0x2722b3b1a58d3a12ull,0xf7c7e3eb83ffb947ull,0xc1d01819f260c489ull,0x00d7eb96f3d8d7e5ull,},
+		{0x4582f05c18734919ull,0x25119f4017643acdull,0xb2188af4aaf467a7ull,0x173586dc30fd5fb7ull,},
+		{0xca0307168057da11ull,0x37be34d694876296ull,0x10f86ce4445e934aull,0x0e4c7c1d18a9abfeull,},
+		{0x5eff0d28ae4bc869ull,0xba98d4a34d449d14ull,0xacf7c6f82a60aba2ull,0x093e35afec8c2defull,},
+	},
+	{
+		{0x888f66db472928d0ull,0x287a2f93c9008beeull,0x4bc90fb8cb8d8211ull,0x0168282d591949a6ull,},
+		{0xa247f3bb180a22e8ull,0xfb5a6ce7c5e597b9ull,0x72990bed3ef3940cull,0x1308fd201dab8feeull,},
+		{0x49333addd922ef72ull,0xeabc08394bd93a51ull,0x1a08205789458e99ull,0x11a9cb75c557b663ull,},
+		{0x87e15e3c4ba53612ull,0x3880efb62b611a00ull,0xe30f66ac9098444bull,0x09b74fe8f703051dull,},
+	},
+	{
+		{0x705c13f1b8685700ull,0xab28b3f188e4af60ull,0xa7c6a7fa5fba01dbull,0x1de1b5e9e7170d87ull,},
+		{0x17e3528fa7962cc6ull,0xa37c895dfd2bdc43ull,0xa2681925e407f94full,0x11a042b110a50865ull,},
+		{0x99a0c4ae97a7df48ull,0xcc4a353e983f7e65ull,0x13e49c5edf509571ull,0x1698484c0682c0a3ull,},
+		{0x6a5bcb126bd4a874ull,0xdcf9e3f7f6ffc046ull,0x87da52967e1a83ccull,0x146a8e035d9146afull,},
+	},
+	{
+		{0x515d8af73b399ba1ull,0x94e9e5ff71d8574aull,0xee2f03ec96df1764ull,0x0287994654642074ull,},
+		{0x4f193de3fa6e91f7ull,0x841feb8032c0f09full,0xcc842b12b35122b5ull,0x09523fbc9321a8d8ull,},
+		{0x94c64503abb7fcb9ull,0xdf46693ff2d73e0bull,0x07cbb40483ba5e98ull,0x04f064de356e990bull,},
+		{0x3e4985b462ca02faull,0xfe803ef7be403c50ull,0xd0dcdbaf58876b55ull,0x1bd19bb9c5e0224dull,},
+	},
+	{
+		{0x9270ed595834a6f8ull,0x3b8e588048190bb0ull,0xa8f45b580b7c1537ull,0x1a137e6ef17938fbull,},
+		{0x12f27d59703acc99ull,0x1da41a99b65dc893ull,0x2691f0391f872e7aull,0x1e5c1ed9b499fa7dull,},
+		{0x7323d52d05942083ull,0x8fd3358bfe91b6ffull,0x9af35beaebe6d952ull,0x0761efb955c328c7ull,},
+		{0xc1f2e2b83876ce7full,0x32a54a23694e8af1ull,0xfec412b07ebead55ull,0x09dd27e7ecf91771ull,},
+	},
+	{
+		{0x949c4219fd5470eeull,0xfef0c5d0fb23de6full,0x32d5274a2b99448dull,0x1fb281e45d0db523ull,},
+		{0xb77fd586b88982b3ull,0xb3932984d7197094ull,0x99329586c9d21628ull,0x0a54b1bc5103f632ull,},
+		{0x442cbf6e4519c1eaull,0x19eee6ba30ff3b95ull,0x529becda46948d59ull,0x22a26def52625e68ull,},
+		{0xbf37304e61b5a9a8ull,0x51f1a186f98f9b7eull,0x4b14c313343d09b5ull,0x0e3080683af4226cull,},
+	},
+	{
+		{0xc1ce8acac48d39c9ull,0x00003dfe80a17266ull,0x8617f38c5f950491ull,0x1344fa3a54f959f8ull,},
+		{0xd98f434107506467ull,0xb12e6f4b10c5c9fcull,0x02185e8253441421ull,0x1c6edaea4c5606cfull,},
+		{0x5343a635887ac7b6ull,0xacab1fdaf98398e0ull,0xb37081d1556eed06ull,0x0d1683aa5524fa1cull,},
+		{0xf12f008efb9e5f28ull,0xf1a6fa66345465a0ull,0xaa5af1e789c0c69eull,0x1e9e5591280219a1ull,},
+	},
+	{
+		{0x2cd1462ac559ee98ull,0xfa710cf6c16d121dull,0xf08bbac5812a61a0ull,0x09df3b72f95f585full,},
+		{0xa28e22960118c2e6ull,0xfa87dbc33f9dc32cull,0xf0385e582746c22dull,0x18d8fb009e32febeull,},
+		{0xc90beb7e120dca31ull,0x48cd75833fb5276aull,0x77805ccc0598d89eull,0x02a3ea7b64a02bcbull,},
+		{0x9bf7b2db7aa9e613ull,0x7d164d3cf0c5f0dcull,0x8fd74d856e4e3486ull,0x235368adaecf3919ull,},
+	},
+	{
+		{0x5880ed5aab228215ull,0x06f5d9b259e8bea8ull,0x4b1070a3cc8b9b2aull,0x1eb3e5380352acbeull,},
+		{0xd3ce09717e3dd532ull,0x051dc0b91c46b792ull,0x2fdd684370519308ull,0x0e8d9ad4fc81685dull,},
+		{0x6424db3c768defe9ull,0xbeb2306ca1490ef0ull,0xd54df6abee1e2b3aull,0x1e1e7c968ca3f470ull,},
+		{0x0eebd11722b27395ull,0x7f52d3dfda83aab0ull,0xcb1f22a1b0dde6c0ull,0x0314abcba95a11c1ull,},
+	},
+	{
+		{0x8bb7f2683e7d549bull,0xbe70ef9b4b60cb93ull,0xe753be39bbf7cd9eull,0x10f9989ff99a1111ull,},
+		{0xc4c6d0830850bd5dull,0xbdf4933dd9f6ce22ull,0xf243d141c6ce7092ull,0x19c30b1d348f2cf9ull,},
+		{0x0de3015155382cc9ull,0x8156d27fc9b88ee2ull,0x48b7ff26187aa4e2ull,0x0cca87035e042f84ull,},
+		{0xefff367fd7a17508ull,0xf1bc3b47c51b2324ull,0xab711cd9af271231ull,0x1c22c5125b591de4ull,},
+	},
+	{
+		{0x3479381f4eaa63dfull,0x4569ed981f3a9eedull,0x72061c8c39ed58e2ull,0x05d7d6c6b95e8c01ull,},
+		{0xec56ef5b3c0d0ba1ull,0x55d626456554541cull,0x8d2c1c64290fc4ecull,0x0389a65ad2c36a89ull,},
+		{0x46834954bdec0e1cull,0xd69c1bb2aa00720aull,0xd2e1bc13215f83acull,0x01afbb5f8640a03bull,},
+		{0x007281a7c80f7983ull,0x6cd733ccdeabfd64ull,0xa6f2e1d6b004ee8bull,0x0053306ed30ccae7ull,},
+	},
+	{
+		{0x72ffd68607750f4bull,0x4467937f2da77803ull,0x830494e508b7ce0eull,0x05d242e754e0a393ull,},
+		{0x785daf122ecbd53dull,0xf225fc3267da29a3ull,0x01408a479d6f042aull,0x18e411764bc66e88ull,},
+		{0x5617493b800eece2ull,0x21511807ce588863ull,0x0b53ca656f7018cfull,0x0735bbfe4aee8bf0ull,},
+		{0xc4234b6329541963ull,0x8a5310d4077486d1ull,0x3d8a116a75772034ull,0x04a571bbaa9b0249ull,},
+	},
+	{
+		{0x33c0a528f7669102ull,0xc6a206d75b2b1e65ull,0x062061bff0f640a5ull,0x10e137e74f2e18b0ull,},
+		{0xcb3e24c22c9bba7full,0x4743f8e4ccf1972bull,0x374036d00480ba4cull,0x23a148f52f61cb14ull,},
+		{0x8028f2c89876ec92ull,0x2e4cc4d749ca5c33ull,0xc64ba57656ca6917ull,0x0990e18cce742b7eull,},
+		{0xe3377c9cd3735e36ull,0xdac39243e198a1ebull,0x8dcc6abfad012ee0ull,0x1fe4c346fc5c92f2ull,},
+	},
+	{
+		{0x84d6830c6fca2e65ull,0x69a5534ffeb6bcbcull,0xa746ea0b06887292ull,0x156a4a69babc0e6eull,},
+		{0xfc9d44a872b05741ull,0xf77052173207b0d2ull,0x5204684c67334273ull,0x03fe58ee16ae8579ull,},
+		{0xf883d6411af43b10ull,0x498a4aff5e34dc39ull,0xdd136d0f4ab45b10ull,0x2261b82d6da4e4aaull,},
+		{0xd81781f365c032d1ull,0x9414eba987401023ull,0xa0dd2e7b6817ec43ull,0x1c6f85d41ee31f45ull,},
+	},
+	{
+		{0x57baab2b56e9edfaull,0x2cb39f59d1deeed9ull,0x3bcda1bb0d2effdfull,0x18cf0fe6f578658eull,},
+		{0xca1c0786d922f8cbull,0x6c239db859d40892ull,0x5cbb193d8f242aabull,0x06206d5f02e7ac1bull,},
+		{0x374d317104c67cc0ull,0xd0d401a43266799cull,0xc890acae84fe041cull,0x06a20964c0420e3eull,},
+		{0x69cc35a915f6cc77ull,0x2e0ee5dac715f1ccull,0xb32ccac66c634f29ull,0x072765169a23b07bull,},
+	},
+	{
+		{0x8b6fefc04cec5ce8ull,0x62d30b67bc0578f7ull,0x72cceb775b8d67d4ull,0x0f9be455905453dcull,},
+		{0xca9ae5261136ab68ull,0x97135f82bb0055a3ull,0xc0daf7ad36a3e9a9ull,0x0936bfb96b7d8a50ull,},
+		{0x5342fd1adf0a088cull,0xb929c69449ff9cd4ull,0xced956aec66fb9dfull,0x161411441a3464faull,},
+		{0x47d9dc8a722d841dull,0x7b61cfd9e3eae2f1ull,0x788611d5c5c6bd69ull,0x16925da817599c0full,},
+	},
+	{
+		{0x8e81ab0bf7714fc3ull,0xf7f82821ff43e0e4ull,0x70a36786456c5480ull,0x0cfae90ef4b6c98cull,},
+		{0x276f282500921245ull,0x57b8e1a5356b2ed1ull,0x1f47efb07b058af6ull,0x20c3cd0c0b4efeaeull,},
+		{0x21c53fd59bef6924ull,0x5fd610499cfeec61ull,0x093213defc46847cull,0x048c7e09f3684adcull,},
+		{0x874408efc90552caull,0x1539133f9c69aee4ull,0x57031b4fa85dcbc3ull,0x1940f988f3ce8084ull,},
+	},
+	{
+		{0xd050a2150b8d5735ull,0x9bad2652b0872f3full,0x1211fb19b46fdc20ull,0x077f98d4511aee20ull,},
+		{0xf14d523a71a0d905ull,0x48ff6d2446595c07ull,0x39eddddb7d4a1ad9ull,0x03d8451e80f0b1c5ull,},
+		{0x40981fb91cd33a86ull,0x3a712f09e1a0dd6full,0x022a613e0671bb75ull,0x232b8e4a334a2a27ull,},
+		{0x81be6706c1d5467cull,0xa5e74d9d470247e4ull,0x57675e2380d25739ull,0x1d93c27563b5bcc8ull,},
+	},
+	{
+		{0x77cc7637e7c63b57ull,0xf951ba7882497d30ull,0x89e6ed3b0d3c441full,0x0343d0d7a3e8a0ffull,},
+		{0xc40c19375aefb900ull,0x97da60a1495f220bull,0x9372acbe3a5ba484ull,0x0fb1d6d7387cc61dull,},
+		{0x42c7edf1d1a208b5ull,0x53097bde17f5b31dull,0x3d0677b3cd016d6cull,0x129c48786216cce1ull,},
+		{0xd16aa997eec15d5eull,0x6f300a923e2cc01full,0xe07fa41b9af3b515ull,0x04d3f5b883a46875ull,},
+	},
+	{
+		{0x5a1f8835969f32caull,0x406fbff7cf89f3acull,0x4dbfe2195e9240e1ull,0x06d7815782d8f9c4ull,},
+		{0xeba3ce5c65056b2eull,0xe822b5bc7c7dc319ull,0x4d48acd326a666b4ull,0x12661093974765b2ull,},
+		{0x26cfb8a0b2d98bd5ull,0xfbb34c55b8730e31ull,0x30b9454b723b8650ull,0x1d8a6d63ffc914d2ull,},
+		{0xde8b495e9958d31dull,0x01964f0f801b785full,0xb4c7f080810a7d87ull,0x19570da0b3f40b51ull,},
+	},
+	{
+		{0xb3c320476d41b21cull,0x006dcc2768a9e995ull,0x46c2a0e56c034858ull,0x0320e5195641f4d9ull,},
+		{0x83eb51d012ed0d0aull,0x0cc385e432554759ull,0xbedecd3bf21a3686ull,0x0eff2619c62cf09eull,},
+		{0x7b7fcde3080fe520ull,0x44de7a71cf993fcfull,0x9577a11e3075ac98ull,0x170d7a11a33bee10ull,},
+		{0x3923993d746fc16bull,0x4c3090b045076258ull,0xf98a6f7fecafbee1ull,0x198d34abc8b324fdull,},
+	},
+	{
+		{0x8be87f4915cb6bf6ull,0x2d8c95017147a3adull,0x89583928aeccca1aull,0x13d3e300d1de5301ull,},
+		{0xf7019f7faea1eb53ull,0x46961f07154cf5d1ull,0xdbe8013296921728ull,0x0967aad66d860332ull,},
+		{0x9915a9734838c4deull,0xa79fac987375f28eull,0xaa56f566048554f6ull,0x1fad4a1b38c317d6ull,},
+		{0x730c7f54cf828d81ull,0xe58265be0eef20e3ull,0xfd9829dfc52fc5e7ull,0x02d767aa053f2f60ull,},
+	},
+	{
+		{0x27b53bfe8e9da58eull,0x9ee4d1f90bfbb979ull,0x6783e5a78505e68aull,0x24bf30d80dd5c41bull,},
+		{0xfee02a65804ede92ull,0x72889657ab5e7a6aull,0x9e7d6d49ada8448eull,0x0d663c0510d41356ull,},
+		{0x607b58cc3ea57305ull,0xa65d5c62d4efc9bbull,0x260723aef07f4af2ull,0x1e352bc3f1a994aaull,},
+		{0x72e226129d561becull,0x1e8c72caa65a3279ull,0x0072d62af4b08158ull,0x01ffce94db3c524dull,},
+	},
+	{
+		{0x4f8ebdd1dd86eee8ull,0x67837672275a6153ull,0x47a03fa5c5a66600ull,0x01b987a221ea4deaull,},
+		{0x4cf2fb5120e0ca71ull,0x71bd1e1e7294dfc1ull,0x1ca1a370f9fe35cfull,0x107b8cb8efd44045ull,},
+		{0xe7f51bf32637f5abull,0x750d5ce1bf04f2f7ull,0xed8b3d93b2984160ull,0x1bf02911a2a4e2f3ull,},
+		{0x62ae2755be9159b9ull,0x11e717a9efbaac5dull,0xde874cc2dfe952a2ull,0x0a783cd8b6714bbeull,},
+	},
+	{
+		{0x090a431bb6a3225bull,0x0800422a74b0048eull,0x02585ed6ebbb8c3cull,0x1d60f32ee94c59caull,},
+		{0x0a5cfba73e07154eull,0xf1b5cd976f054c39ull,0x510508f6f868151bull,0x1a0c6c5f46e8c6e3ull,},
+		{0x8620f2ddedd001b4ull,0x562888f8945e2fbdull,0xb64b2962058ce4edull,0x0ecd22e4c625612dull,},
+		{0xe91a147bbcc23abbull,0x7c9c6ea4e757fcd6ull,0x0641153815e9802eull,0x0483aac0f4b9c548ull,},
+	},
+	{
+		{0x6e0eb65219b800b7ull,0x2fcfcfbc0eba9db9ull,0x5cf42c41103670e2ull,0x0c3ed9714c4be698ull,},
+		{0xe1fdbf7990b9d18cull,0x0c69a0f12bf00731ull,0x11c795ec6c1b74fcull,0x0d1219677ab763f3ull,},
+		{0xc80906aa2c174a93ull,0x3f7fdedf8cb12867ull,0xdafc12e00021b1e1ull,0x19ee7adbad22aff9ull,},
+		{0xc8eef8377558c311ull,0x41d4b3eb287dae80ull,0xaf5edd8a8283dc09ull,0x19db722473778b02ull,},
+	},
+	{
+		{0x82811399e3f889c0ull,0x647c47867156eb95ull,0x8d043b31bfeb96f6ull,0x112884ec94d83f19ull,},
+		{0x4bc4722eed262ac8ull,0x497a89d8625896feull,0x14ad281391aa7accull,0x13935a7c0ebbc205ull,},
+		{0x504b2152a314a79aull,0x088fc4801556a4f0ull,0x37399b96d6dd77afull,0x220b022d30e7a74eull,},
+		{0xd2219012cadb806aull,0x6c82efd2ba3edf1cull,0xfa48a276017cc97full,0x06154b9ef84b1715ull,},
+	},
+	{
+		{0x76af35f133746b99ull,0x9e18186a1bf1b98bull,0xb2f8b14e1622f53dull,0x02881fe46da12253ull,},
+		{0xce3b3feee57d2925ull,0x82efde85e64df800ull,0xb23117c2371dc7d6ull,0x069a5a7ed05c5615ull,},
+		{0xb6e4363541988c37ull,0xc060f1bc4367a646ull,0x8594313351d8a2f2ull,0x15ca85ab419c8ee5ull,},
+		{0x7ed1b531cadd55daull,0x162bc93d9484357bull,0xa70db3e4c68f1dbaull,0x02aff8ffbcec5607ull,},
+	},
+	{
+		{0xb22b15c9b73936d4ull,0xac3c9c6bf4f75158ull,0x544a4e50aa7ae362ull,0x2096f34d727fda8dull,},
+		{0x4de7a92bb1d8cabfull,0x961ddf9fe3ce7b9bull,0x04588faf51fd214eull,0x0a8ab145cf820680ull,},
+		{0x6df523853bfb3e29ull,0xf468f7d0186bbd8cull,0x4670a162a3f8bc81ull,0x0b95cd505e67877aull,},
+		{0x954b01e116b6d9a3ull,0xe752dedc58491a04ull,0x7a67fe2d51eab404ull,0x1c4f4a2f2322b629ull,},
+	},
+	{
+		{0xadb9cb703b2828c5ull,0xa0b454cefbe0f1b8ull,0x72570a1790c5ba88ull,0x24f456f9ef59ca3full,},
+		{0x1e671d83e8eb1d05ull,0x9c1bb3fd879740a5ull,0x321bf4bff7bb98bbull,0x0b7588cf67dffcfcull,},
+		{0x9350eb53e4d0848full,0x326e9ab0d5f8bda9ull,0x47b9e901f9614b5dull,0x0110d5c2fe53389bull,},
+		{0xf0cd5f0455b15cf4ull,0x757dc5915e7a1e79ull,0xdc578ebf76c65521ull,0x0e6e899ece26a5c1ull,},
+	},
+	{
+		{0x2fa879517a63b580ull,0xd70b3eeed1c12e48ull,0xc0e6c50c6755ede7ull,0x1ac05c3ed5996f2eull,},
+		{0x2843a8a13c57e1e1ull,0x4b3412b3e345ced0ull,0x510d3a91ad54b5a9ull,0x08791b5b0a44d153ull,},
+		{0x39b3fb0549e1abf6ull,0x81837febb844bd0cull,0x81e6a74905b0b332ull,0x09a22e094d1bed8eull,},
+		{0xdf775b7502ac1933ull,0xb750d8ca280eb522ull,0x2e626e511120b16dull,0x171a0b0426036015ull,},
+	},
+	{
+		{0x17240d755a03165full,0x90900aff519f19a5ull,0x2cc5561ca8f4c6c9ull,0x1a04f475192b6347ull,},
+		{0x9adac2a85b826f5aull,0x86df5011011191c3ull,0x405935d2b2cac96aull,0x17ce70ff56029062ull,},
+		{0x000c7c84902b1f8cull,0x9f7251e8128de6adull,0xd9c64837a7e247fbull,0x182f4f5dc1ba80a4ull,},
+		{0xcb79d94ecfb1f1ffull,0xdd36a1a5dcf7ad3eull,0xb67181270c424bb9ull,0x1c8493997469a345ull,},
+	},
+	{
+		{0xb9064072d45640f4ull,0x114da3dd0c9f0290ull,0x322f483b0551c598ull,0x13f4d1241f1171ceull,},
+		{0x7779ed3974213336ull,0x46c62c60449c92afull,0x55f9e350f66d916bull,0x121336a5e2b10221ull,},
+		{0x46e0072a26e33bf1ull,0x70da420872cb814cull,0x38347107a56b91f2ull,0x17987715397fb952ull,},
+		{0x273badad2927a3adull,0x2bf9ca222e2f300dull,0xfb4062ab71665c91ull,0x00041fff0bbbb736ull,},
+	},
+	{
+		{0x986b21591b0e1cacull,0x0e47fbc40a67ba24ull,0x69bec7fc6fae36bfull,0x0b14ecd992faf7a2ull,},
+		{0x4680762f527789fcull,0xe4c6e436314d5723ull,0xd349f9bb8efdf31full,0x186609a1db3fd372ull,},
+		{0x38ec38ea0293767cull,0x670a7b0370c2f406ull,0xbb935b3625030e5dull,0x03424fff6c44930full,},
+		{0x9742dd5be6ebcc77ull,0x25edde139fc99a5full,0x6e3e5c5843e3f627ull,0x019f0e6e63634f3full,},
+	},
+	{
+		{0x960a934602315604ull,0x6adc5824b9cf49b0ull,0x7cb01459b32b7584ull,0x1b5f8b5a1e1cd799ull,},
+		{0xc7834afa2e6803e4ull,0x8b08433a367d2cefull,0x8293d148e7b416a6ull,0x12b84accd0e8e523ull,},
+		{0x1983e15e93813456ull,0xb76b050bf6971719ull,0xf698002a9accb2c9ull,0x1d943283326608abull,},
+		{0x66cc33832b275313ull,0x5d2f935ab189c1c7ull,0xde69eeeca7df1256ull,0x1c74b758bafbb096ull,},
+	},
+	{
+		{0xa22d1f1edd4a8010ull,0x318f51420e873844ull,0x061bd0f26a98d7aaull,0x1a49b5984490ced7ull,},
+		{0xfddb19ee468c2ab4ull,0xf1cccf9573216b6dull,0x8beeee16f1bc1cf6ull,0x066243c6930bdf4dull,},
+		{0x7aae959568740f97ull,0x3ae574f311fcd874ull,0xf2e0c7f576b2aa3cull,0x0b302e1020cd4765ull,},
+		{0xd4f327c0d192cfcfull,0xc732b7a18c21dccdull,0xff2f36e71c27b62bull,0x22dedefaa5a2ec09ull,},
+	},
+	{
+		{0x781fa085c153daa2ull,0x8b1e5ac5a8f64be2ull,0x753a7b06bc67c1aeull,0x026d8dd7520c64dcull,},
+		{0x28d663d4d570465eull,0x4172b990e044fae9ull,0x3df1a5eb2bd120a5ull,0x1fb7ef0f9f2b22b9ull,},
+		{0x2e8d04810ee625fcull,0x4df11c03e0acb0dfull,0x40c94a5fd6ebcad6ull,0x11d7bb8e00e25ccdull,},
+		{0x6d1311ec446f1d68ull,0xd511ef82d1f9c729ull,0xc8735b4465a3a252ull,0x0befc5c5bfcd5015ull,},
+	},
+	{
+		{0xedc947db6b4b894eull,0x0ebdc6b50fe99c0bull,0x7a57afe2b2d95c94ull,0x09af4805763699c4ull,},
+		{0xd89b517f9e57b8f0ull,0xcb313122cc221f2bull,0x3e30e520b62c2df1ull,0x1d446d0c6229a9d2ull,},
+		{0xb3e8034a0407c09full,0xc968c5c535049701ull,0xd454c976cf6539a5ull,0x2283baac4ec1c697ull,},
+		{0x5be558319cc8cfbdull,0x8967896ea20a63f2ull,0xebe498fc286b9d7aull,0x1839716aa54b2677ull,},
+	},
+	{
+		{0xd2348e57949c5758ull,0xf5c9fc28fd6f68ccull,0xe37cac251fd84b93ull,0x16c6790a19c249beull,},
+		{0x603d63b36f2a644eull,0x1d151cb144a17c88ull,0x93d6fe9d924b21f1ull,0x20fe61448ca4d100ull,},
+		{0xc6bc6dd185338a81ull,0x6a6c246d4583f0aeull,0xbf389ef9afff75a9ull,0x21d65fb20d05562full,},
+		{0xe8858f60c76cc59cull,0x1b3aed9174b98fd5ull,0x689be72b52cb9bcdull,0x0b394325eb0313c9ull,},
+	},
+	{
+		{0x3587c236daf625ceull,0x06b47334bfffd7dbull,0x989b0fccb75c0981ull,0x09013f846bc13369ull,},
+		{0x1821986e00466ac2ull,0x003b3b58d34825c9ull,0x33352af7506fa332ull,0x23be0a8d7136357dull,},
+		{0xbb25c18916168b65ull,0x2529f0eca58b4db6ull,0x51c915c5bdcc15bbull,0x0ed8f32565280749ull,},
+		{0x4013d66dda3066c0ull,0x602d736ef17e59c9ull,0x28dc2d81b28c9107ull,0x03fbc975e4155d08ull,},
+	},
+	{
+		{0x2188d9e890f57362ull,0xaa913f594419207dull,0xbde0759c48140a67ull,0x237be6c59f221dd1ull,},
+		{0x78f7464343b13a6cull,0x1d37f015d22d2bf5ull,0x6b3ffe3adf69e72full,0x101b9aaef19c5a08ull,},
+		{0x75087f8d5364e4e5ull,0xc2a7dc727f082fb3ull,0x09e8b824f5f81844ull,0x0daea1b86c7c5630ull,},
+		{0x7fa946b2833dc5c4ull,0x22de33467c51e416ull,0x346ae37e5e7e0c6cull,0x000ebc3cc329cfefull,},
+	},
+	{
+		{0xacf5495cf6cd8a42ull,0x8fdd188633fafefeull,0x817397d32c22e2bdull,0x210cf53fc94c601dull,},
+		{0x46f67edd80e6a69aull,0x742d67281d773f73ull,0x3a1e52791655b389ull,0x1ca7ab6625018ae5ull,},
+		{0x6c4455fbae0fe625ull,0x0d6b865cdc8ba30aull,0x91fa8ca467a04eeaull,0x21aced384e4fcb59ull,},
+		{0xe4481e5aed4187dbull,0x8bf93c68e66e1ecdull,0x49e0b8c60695066full,0x06da13adfbd5aa58ull,},
+	},
+	{
+		{0x7542f8d8d4f58c1aull,0xebf1855bab09b9dcull,0x27a13c33377587d0ull,0x1b7b3f483d356bf8ull,},
+		{0x5d90ae790a29ef61ull,0x3214ab017d121cdeull,0x1114be959b72de2cull,0x05aad0ff20bf87a4ull,},
+		{0x83065e8907d42335ull,0x55e45ba6b70a5919ull,0x0f9df85a759f8334ull,0x226e85745b567c42ull,},
+		{0xa5c74e9cfdb5fb28ull,0x4925791452fa1662ull,0x235056cd3ad889d6ull,0x23d85ae4055fb357ull,},
+	},
+	{
+		{0x4bd34b21cb2d2910ull,0xcb7b826de0aa96b1ull,0xcd57ca2445ac2388ull,0x196a5efbb7f3c81dull,},
+		{0xbd2d1ea607013624ull,0xbed9c642ff3995c7ull,0x7137f612fc0414a1ull,0x1bae65deadbf5592ull,},
+		{0x33b532174873f3ffull,0x4e8d975652416e64ull,0x0fb64b3cc4da1f35ull,0x22f75468ffa4a4a7ull,},
+		{0x13e2190c2ceeafc3ull,0x2a630f4b6f87a737ull,0xd28e523613be7767ull,0x1ff7bc7637a65ee1ull,},
+	},
+	{
+		{0x6cbcc2fd59796e47ull,0xf64e19bc91d24884ull,0xf10cec7a90b1fa59ull,0x249e9c6a635d0cc3ull,},
+		{0xb45bc57eb0b82e7bull,0x68970989c483e84bull,0x62a911fa25251bffull,0x03250b3ac7528419ull,},
+		{0x1e760f53392a6a27ull,0x3034c5066d1a65dbull,0x585f9dbf57ff1bfcull,0x12a38ab4152d550bull,},
+		{0x0f22f9c3f06612dcull,0x2eab18bdc1ae8765ull,0xdbdd5a0e4c669f70ull,0x24b7ba6f1df5ad0eull,},
+	},
+	{
+		{0xe07ca026b7699e55ull,0x66f3e3bfcc76dd4cull,0xe58f9a668a6095afull,0x0a7ad2d41a4c6698ull,},
+		{0x619c87201e48726aull,0xccabf3f972d2057full,0xae35c8a8ab06ba49ull,0x1ee72f1194831b5cull,},
+		{0x3c9c9b5c39f5de54ull,0xbb7080e54d7ec154ull,0x3d41802121f8446dull,0x099e3410296f2316ull,},
+		{0xf5d0cf93a6bcf4eeull,0xa646403e8198f2f5ull,0xe7a675bd2a8aaa8eull,0x230d736beac2d7d1ull,},
+	},
+	{
+		{0x131f6bd33bfbcc4cull,0xde19771170d599b8ull,0x038ce33ae62dfb37ull,0x23f058f7067cd36aull,},
+		{0x486fce26a5f849c5ull,0xfc6da83990c17969ull,0xfa99e69102d1401eull,0x196ff003b682d89cull,},
+		{0x1861c151875a3c07ull,0x52b77e0e15bbc05bull,0x5e9b7388408b27f2ull,0x114e1ce70dbd56b5ull,},
+		{0xf7150a2cc7bf385cull,0xa7f3114a56f4d689ull,0x9240808a48ef34beull,0x1423a8e08d321eebull,},
+	},
+	{
+		{0x430b6f756ab6a054ull,0x54f86a6aa051b01eull,0x5247dca0d4e3a1e7ull,0x17f958887f797ceeull,},
+		{0x8167f362a0ed8cbcull,0x104889566e0d5df3ull,0x1b900dd4b96ce2f6ull,0x2097491cb9af676cull,},
+		{0x101cb52819389bc6ull,0x19295e369f6d0425ull,0xee97319b62e3d9e6ull,0x137c2db44a78394cull,},
+		{0x75dfae8b5011579bull,0xdc9aa9e490610821ull,0x186940515bb3fe0cull,0x1ef8bd81680faedcull,},
+	},
+	{
+		{0xd170aca22a06b138ull,0xa82146420d2f4a93ull,0x8981a62c5feaf467ull,0x1f29a0f2df3cae0aull,},
+		{0x1bc53a95bf86e928ull,0x354cb0a7bef2310dull,0xf73d8c003820a235ull,0x06f15543c0f3aa36ull,},
+		{0x903a0e84c3f88794ull,0xaaad1b0cfc10cc49ull,0xe42cbd54393722f1ull,0x170da50178058344ull,},
+		{0x513bb03014eddcaeull,0x8830d44a677abc95ull,0x345d0d0b6f8685d3ull,0x1f7bbf380586bce7ull,},
+	},
+	{
+		{0x97fc19ad3f27d4edull,0x7abd33b02ddb4805ull,0x4e2cbb2f3926a12aull,0x03bc91a73ddef102ull,},
+		{0x2d2a308a551bcfeeull,0x452e1eb2f05be450ull,0x59e4302eb3a84779ull,0x08eb1ba17115c07cull,},
+		{0x357b2f0d8a17eb45ull,0xa172f38a97352c6bull,0x677583a4f3344730ull,0x0c7d6ae5a91d30d8ull,},
+		{0xd5e2783452183581ull,0x60ec5733fb688201ull,0x4ac9f1385ba195b3ull,0x0efc09aecdd10450ull,},
+	},
+	{
+		{0x1277c7ac25d1e92full,0x3af8889b7dc22582ull,0x3a247770a6804adcull,0x13ceed085f4d6f8aull,},
+		{0x5b8548cc8200c63cull,0x81af8edcea96fc2bull,0x7cf8a6ee31d6f852ull,0x20cb9f4305fc22d3ull,},
+		{0x75e2fadb8b1acfcfull,0x94b4de715eddf09cull,0xcc8ce6d9efe7f9faull,0x0a39aad73a4fe457ull,},
+		{0x7e21dc55e00d770dull,0xa77de2c43dad0636ull,0xaf06a9c9e470f32cull,0x0242e4b7e47613d9ull,},
+	},
+	{
+		{0xf307e4706dab8426ull,0x7db51b144d7fdd02ull,0xc544e01d174c7dcbull,0x184b83e8dcdad830ull,},
+		{0x8a28809c5c64af86ull,0x068bb9259daa149bull,0xacffbd1e7c8b0177ull,0x054c21fbd40413b0ull,},
+		{0x6830dabbcc2223c7ull,0xa3fe06b5a31fa804ull,0x3f616a161c9e780dull,0x06c2e2b2f1abd0c7ull,},
+		{0xa1eeece535199542ull,0xe012b48312a61831ull,0x678ab9b3f973dbcaull,0x015399342a30c0b2ull,},
+	},
+	{
+		{0x8afb3e9b62535266ull,0x65cda2663d7144caull,0x4987ab51623c5a8cull,0x01f8279e6bf46d9aull,},
+		{0x6c648a3aea35fe76ull,0xa7f3bf10d7b49b33ull,0xcdc7faa3f19b503bull,0x225fb292d130af03ull,},
+		{0xa5419d8652675ce0ull,0xf3464204fdbd6ee3ull,0xee1f79faedb1a8fbull,0x1cc93228b54dfe6dull,},
+		{0xc1d5f840d6462e73ull,0xd2ec08a235aaaf0eull,0x5250b414c6a9cf14ull,0x14d011e6ba08b67cull,},
+	},
+	{
+		{0xaf920994e12e25f4ull,0xad936d6376c4fb0bull,0x0f0b147e2e450eebull,0x1b76bf6079b6213aull,},
+		{0xd5ff72f9fc395638ull,0x4fc20b1818a9d456ull,0x9bcddbdee2cca47dull,0x089a756515b81f3eull,},
+		{0x2824de37da4d0728ull,0x9257219c0528d815ull,0x61196894e583ae97ull,0x0dffc26d9eee7c74ull,},
+		{0x85f034b67e107425ull,0xedaebf64b9ae2e2cull,0x8d36bee774d91658ull,0x10c515007789d770ull,},
+	},
+	{
+		{0x8c8eb896400707e8ull,0x4f482d79da88398bull,0x740fe279c5d97a20ull,0x24384304c20f3cecull,},
+		{0x2942cbcf1f846f1dull,0x0f10b6d3c7706e3cull,0x4d428ccd29403c78ull,0x1436a3dbeaa4ce15ull,},
+		{0xaf94dec97baf60a1ull,0x37aeb275cdeb1929ull,0x800736371c9501cdull,0x1e08ad2c2892814aull,},
+		{0x65559449a637add1ull,0xc2185ab50a42993cull,0x7b03f16ddc954b22ull,0x1abef405dcae4862ull,},
+	},
+	{
+		{0xa7b08f40c18522d3ull,0xc34b33518f4630abull,0x27125b0cb6c5f899ull,0x011663ff609febd8ull,},
+		{0x960e1ced2e079962ull,0x04dc5492d0ad863bull,0xd8f1b42fd7a3b64aull,0x08051f4098738799ull,},
+		{0x904a5288fa17a47dull,0x186a2cfcb30c1b0bull,0x6acff3f2f1ce2a1eull,0x20605ea09454f267ull,},
+		{0x512794b4084786b9ull,0x7010e7f21f739946ull,0xdc9c7c2523641714ull,0x2309d469c182c875ull,},
+	},
+	{
+		{0x372b527f9994e097ull,0x6eb78cd08e998eb6ull,0x715ea548f2643fbdull,0x20299b17638628aeull,},
+		{0x88dd6ff54e305ef2ull,0x0cdc38dd2b669c75ull,0xa332ffe19b45c692ull,0x14679a0321003867ull,},
+		{0xe8d5dbbb271ac611ull,0x5e32f7c42bb7c89bull,0x3f33ffcc12bdd5a7ull,0x14fb6203ed81ddaaull,},
+		{0x24766635e3af74a7ull,0x2030dc9dafc175a5ull,0xc126d3507d75d804ull,0x1edac89d21714468ull,},
+	},
+	{
+		{0x6a62252830b44089ull,0x7503af07d447d984ull,0x4a47acec95a67998ull,0x085d3e535c39d6f6ull,},
+		{0x0d6c7d768da9eeefull,0x7b17c63030a6221eull,0x6d880f66e44f2ef5ull,0x0990603bcf498706ull,},
+		{0x086650154a91a2ffull,0x439a728cc7768d6bull,0x988cd46f4af8ba42ull,0x040afa52d5f477c3ull,},
+		{0x4859696dfe4908adull,0x1faf4fb0f2b184f5ull,0x8a5789c5dc2b4ec5ull,0x1e64c8a968164285ull,},
+	},
+	{
+		{0x927bc43b9c24199full,0x62ce03eaa8fc7456ull,0xcc56f2cd9362dedaull,0x1e73009cfb5783d2ull,},
+		{0x093863366cab816dull,0x161e1d0b1aecb7c4ull,0x22cd920bd507780bull,0x17f71796d8eb5783ull,},
+		{0x168956e668fdeb18ull,0x58a9eb93a44bc21full,0xa67883d26cb49a79ull,0x1f75ba66da85e36eull,},
+		{0x96ce5ffa9a44bdcdull,0x50428c19c7b2aeabull,0xbee193c53732c51dull,0x1dd9c7386d9ceb98ull,},
+	},
+	{
+		{0x89daf33c3a04be77ull,0x44fef5859ace6b6dull,0x81ee92dc441d0c6aull,0x122b6e496705a699ull,},
+		{0xbce809e96a3b297eull,0x0766ea7b4c669939ull,0xf5f64beb939eeb51ull,0x0c6be2b4af5d1d0eull,},
+		{0xace12159a7951b5eull,0xa67c88a395b91cacull,0x6ca3bfb5523f769cull,0x133cf205e3bacb56ull,},
+		{0x02f5a63d72db350dull,0x6c989a9001ff78aaull,0xf421f504287c9a47ull,0x0ec0b743c6ed4ed0ull,},
+	},
+	{
+		{0x7f72e2b72a0dfbe2ull,0xb4e8f65fad5d3d68ull,0x1523bf7e9de0d85dull,0x15e0105443bb845full,},
+		{0x8cc4fe00aa9e798bull,0xe55a73a98a2737deull,0x9715b9e341ac423aull,0x249607c9d7801045ull,},
+		{0x992402e97a1d13caull,0x7511974d116a9810ull,0x89125b90fb36c70eull,0x189fa31f5901feaaull,},
+		{0xadf97c636ef35b9aull,0x890c2e36cfa3080dull,0x8a1dc19c0e7adfecull,0x0e8c17b6e77b8c4aull,},
+	},
+	{
+		{0x34207299f76bd7a3ull,0x90faaac0bd009f5cull,0x366f2f65922954deull,0x2482c2f2eda33a2dull,},
+		{0xe7cc3adfc14783a0ull,0xdd7c4e7f9f7c89b1ull,0xceb9f3ca3d52c5d8ull,0x201ce4463ec368ddull,},
+		{0xa20c34798d5dee29ull,0x0583b079f9b8d342ull,0xb508791ce6a35d7eull,0x191a6805b8e23e9full,},
+		{0xb99d720e5f752186ull,0x3bb0062216616284ull,0x52f521a0457287a8ull,0x09b1ba3a33f33e31ull,},
+	},
+	{
+		{0xc94e2b945cab0c19ull,0x1f7a9e934cbcaa9aull,0x4c28fd63a4ea309dull,0x1b1bafb31af6d37bull,},
+		{0x6a5bd5f729b9343dull,0xc1a7f6015bb87367ull,0x8f6127d316b787a9ull,0x1ffd41438d87022cull,},
+		{0xd9397a6e2e1dd684ull,0x6a7b5dfb2f962e05ull,0xe70631bde057e984ull,0x1d9498767a152b4full,},
+		{0x5e81fb08be46d9bbull,0xa12b5efa761e5f9cull,0xb0dbd2c5aec5aa2bull,0x0c9cfaf58a90814full,},
+	},
+	{
+		{0xcb32034de7f34805ull,0xcc6f803940e250a3ull,0xdc0fdf5abd25b277ull,0x09c2af68b283844eull,},
+		{0x334663279caf8db3ull,0x6f4887f0e15e85a8ull,0xd582d5f9a7a688afull,0x154b59239b4fd6aaull,},
+		{0x7c69815af5f8a310ull,0xeabd4b8ba50968d4ull,0x56e68d35397ac5f7ull,0x183640f4959df671ull,},
+		{0x8cef0033a9409aa8ull,0x93c389a951f9ef0bull,0x75f2adfafc902465ull,0x04837852b8c5dd2aull,},
+	},
+	{
+		{0x4acf9ee105af5f3eull,0x6687c6dadc310c6eull,0xd29fe3e4b0f58e86ull,0x1a6cfe3d0eed46a1ull,},
+		{0xb2df9a5acf8e6d6bull,0x586b24fd2fa0b86eull,0x8e1b4372ef2d8563ull,0x1af3f9c7dad71ff7ull,},
+		{0x61ffe3d78c27d58eull,0x9f9ce49917efef17ull,0xa26eb739da21157dull,0x0ea047f6a0b7e7e1ull,},
+		{0x33cb532fb00e4700ull,0xf59e0fe7c3d9f6a4ull,0xe43524f8ea30d298ull,0x03a16985a7b9b26aull,},
+	},
+	{
+		{0x688cef2ae9bc1572ull,0x5b357c7f0eedbc69ull,0xbd13f6cf94cfac34ull,0x17a008f0d41f20ebull,},
+		{0xef0bf368fbff47b0ull,0xb3eae6da63f2e8eaull,0xfc317b6f3a01c661ull,0x004ce1a3e12510faull,},
+		{0x2bf755e183f4c695ull,0x29a39128a58e6f4cull,0x96fbf421c62917b3ull,0x0258e7cf81a52ceaull,},
+		{0xd7514db7415489f7ull,0x9c7ef69a1f3ff356ull,0x59f0548c37b0ef96ull,0x118be77408dab3b0ull,},
+	},
+	{
+		{0x983a3f30133d55b2ull,0x2e69073abf50c357ull,0x3da7651acbd9aeadull,0x234162a6551bc2dfull,},
+		{0xe8a0fabf08ff0fdbull,0xe8f0edb698a11d0dull,0x7882ffc9dc586549ull,0x1c08be7fccc2582full,},
+		{0xb92c21501abca674ull,0xd72fedd7bef46ef1ull,0x78b2aefae73f4bffull,0x20fdbabaa77ef81full,},
+		{0x59aa51ccd7d52700ull,0xbea1c70c9ab0487cull,0x6ef88958433807feull,0x200f0fe2dea078b1ull,},
+	},
+	{
+		{0x467be8cde518d8a8ull,0x31784221cfce08c6ull,0x594146bc6a45b6d8ull,0x02ac3894cc1d3ee5ull,},
+		{0xd614903d755643c8ull,0x966d6857fab89dfeull,0xddb992f8c66a4400ull,0x0db6c5c715ce679bull,},
+		{0xb53cac4101c6e3feull,0xe477642f02a79ecbull,0x76d7e134c4cc9f38ull,0x228d5966bbe91a8dull,},
+		{0x43607c10e190381dull,0x952749ea701f20eaull,0x8ecd319b06fac07cull,0x186a9198e7bbdf36ull,},
+	},
+	{
+		{0x4320e3139da3fbbdull,0x2a784b268c01d766ull,0x7cdf18d0c3c79cb1ull,0x1c731041d37f8fefull,},
+		{0x275af9b26ddfa9e6ull,0x6e76ceb556c379d0ull,0x5c071f0964f0c783ull,0x164575422914fd5eull,},
+		{0xe63f6998b39aaf25ull,0x50f3418c6221f62full,0xfba95655f1481773ull,0x0db25169eae8007full,},
+		{0x4c2ecb98ae0ec055ull,0xd95e6d3b7cfee072ull,0x4e4b4cba52c52076ull,0x1be752cc2f998798ull,},
+	},
+	{
+		{0xc9fd8789bd258bb0ull,0x6273a4fdb9075d28ull,0x023ec81714135e31ull,0x1d130520f526c9adull,},
+		{0x9acc123abe26b1f9ull,0xb4a70b353061d217ull,0x39b2ba699d7cf267ull,0x1846654e1cbc03f2ull,},
+		{0xaa91bd10dc28594aull,0xebce57a9e870b3d6ull,0xc7cdfe8dc1cee1e1ull,0x15febae161cd36ceull,},
+		{0x7a121bf5545feb93ull,0xc2a9dabcf06d9788ull,0xc70cc36f4dd9cde6ull,0x134df6fec066b3e1ull,},
+	},
+	{
+		{0x2aca887c9270cc11ull,0x29dcd5e6cecc22d3ull,0x34d116591ad82e95ull,0x097bcc694351eff8ull,},
+		{0x65a8d88a503b8d52ull,0x630a809065d06539ull,0x3d899e63f8459765ull,0x12e827696e605050ull,},
+		{0xbedba0c316c02424ull,0xf955b0ea79c33381ull,0x911fe13f265c9cc4ull,0x1115478ac02745b4ull,},
+		{0x6216283164ffbbe6ull,0xd76bdf83f7477e42ull,0x013159ab3d355cbcull,0x0db8e7860ba642e8ull,},
+	},
+	{
+		{0x9d5e8e17ca615787ull,0x89bf3fb6ec0048a8ull,0x6297951e57cebcd1ull,0x23fb4fe554444dd4ull,},
+		{0x46191efac4ef422bull,0x934b18ac5b43a0d5ull,0x56e081b9a38b8bfaull,0x125c16bf8ada2290ull,},
+		{0xd0e83a8b3ef132c0ull,0xf9f0b831100b6078ull,0xa0eef63da66253a0ull,0x101353daf42a701bull,},
+		{0x3abe51e75796209bull,0x1a0c3c62b1b44019ull,0xf1d6fc127f5ac017ull,0x1c5b889681d6dc17ull,},
+	},
+	{
+		{0x5d78df95515fe5f8ull,0xc729ba925febfbf4ull,0xc24028c7da38dfa0ull,0x031c3d19fb9570c4ull,},
+		{0x19566e08579da4c6ull,0x7a6ba18e556f10dbull,0xc57e4c45dff53032ull,0x14acb1340773012aull,},
+		{0xf42e00767dd5bd40ull,0xfb98175d4586cd7full,0xc2a5fe25b0967021ull,0x23e4e99e0d338ee3ull,},
+		{0x3bac92abc84b8debull,0xe4c4261863ddd661ull,0xbd5a58b7de2c9b03ull,0x0ffeeaae2d0fa890ull,},
+	},
+	{
+		{0x4f49fb75930c8580ull,0xcc4ae9447fe7c546ull,0xb7a7cf147bf5ce89ull,0x1616a34c7a003030ull,},
+		{0xd08109208eb1d892ull,0xd79df2b2f4ea3c03ull,0x8054ecdddd683626ull,0x135d3017da9afc25ull,},
+		{0xe8d3b45b5e588f5dull,0xc252a293d6efeaf7ull,0xdb8beb979fb59176ull,0x008412cfa4f98836ull,},
+		{0xc0a61914fd473f65ull,0xae9ab1968a837495ull,0xd378935acc7f013full,0x18218346c5420aedull,},
+	},
+	{
+		{0x1aacffb8e7c35c88ull,0x3676aa6328e93e97ull,0x3324042aefe26bbcull,0x164d52a4ae231f90ull,},
+		{0x6f9a77f2d6044ac1ull,0xbeb1c32034a1cb6aull,0xbbe91b3d00d155dfull,0x229c9f1d838a9763ull,},
+		{0xa2f1bd41cc6172beull,0x061a859ef822f12bull,0x12a041fc0fecf2a7ull,0x21c9474e28afb80full,},
+		{0x941c932009b682c6ull,0x46ab6726a1df54b1ull,0x450d3de787469cc4ull,0x0bfaf71ddf28be87ull,},
+	},
+	{
+		{0xc059e72884aaa8b6ull,0x30ef76b2fbd34da8ull,0x4545f21aa01d646full,0x1f8dadd2a7d19661ull,},
+		{0xb112ea6ac440c53full,0x09581ee422ee1f94ull,0x8a334858cce0d0f9ull,0x18fc1e20b114da5bull,},
+		{0xf7a447645d218e87ull,0x4dffd131505bdc85ull,0x40463115b627e8a9ull,0x1b15c9279ebe1ab9ull,},
+		{0x6c5dcc6b0500eb66ull,0x8d7cef6be9ebbe9aull,0x7bb59230b7b4efbcull,0x1ebf207c8646534aull,},
+	},
+	{
+		{0x7df8d192a198cbbeull,0xe782bec35ffb7c6cull,0xd26414c5b1d6463bull,0x005d588f7ab02c56ull,},
+		{0xc0b826482c1a8d89ull,0x600b4b04f48b75deull,0xa05a0da653344617ull,0x1263a49a880d475full,},
+		{0xb9fb5ad62b45003bull,0x0fad8b8aac1beb5cull,0x6e20c2f452aabeceull,0x1845cfdd249b589dull,},
+		{0x4e161e983fbd4911ull,0xd712e83561b8920full,0x3146acdb274c3707ull,0x24cfc44c77ac5424ull,},
+	},
+	{
+		{0x5eda82d49ec2e63full,0xce78d399731b0b3bull,0x9148dcebd7f45ce4ull,0x20484712a29b93c7ull,},
+		{0xbb40c72859893124ull,0xfa99c889c2edd82bull,0x48b9cd9b9659efe2ull,0x07ca91c139161b32ull,},
+		{0x474b6cfaf40f966eull,0x1f39797ac094dfc1ull,0x44cb401f0e7c1716ull,0x23ac14425893dbbeull,},
+		{0x938432a14636dd5bull,0x8af5a8246b1e9d43ull,0x97cdc35ab65b77b3ull,0x151340f82882b65bull,},
+	},
+	{
+		{0xe625046ab95cfd43ull,0x1da873919a944a29ull,0x40121555804716d0ull,0x06daf858dc6c25dcull,},
+		{0xe9efb7c3b8681e70ull,0x36b941e033728904ull,0xbd90da6c8833c5d0ull,0x1a369845ea839da5ull,},
+		{0x14b2aeb319fdb1f4ull,0x11588be536082028ull,0x066074b470abf9b1ull,0x20d8f1154869ec85ull,},
+		{0x0ce2686426c06342ull,0x86401dd6cee10715ull,0x301aaf5fb829b92dull,0x037c035df7441bfbull,},
+	},
+	{
+		{0x9f3f841aac62f547ull,0xbbc741fda7eb5250ull,0xfdfa8d7b3eb9c56full,0x100234e376e081eeull,},
+		{0xbbc31313152f981dull,0x67689778c4b513f5ull,0xea7269aeec5bd845ull,0x04d9b3e3213bcb12ull,},
+		{0x7702131b947501a1ull,0xd184ae4cfbf26ad3ull,0x935ec812f81e3a45ull,0x1945dd7781c81adfull,},
+		{0x4387685e3d03d9beull,0x3641720835d4ddf9ull,0x97ba42863d76016aull,0x1b25171736cce667ull,},
+	},
+	{
+		{0x09e8eee0cc8ae301ull,0x05261a120a1c64a5ull,0x51d4ac948ccec4afull,0x112cb7bf6f3c625dull,},
+		{0xd7751bd8a3ce3bacull,0xe6278d5d40090248ull,0xb1bfbaf96f30da48ull,0x02d3b910c2abfb47ull,},
+		{0x57f7387efbe1a99eull,0x3da96bfd35c1af86ull,0xd4bdcace8415cf50ull,0x07da7f8641f16a97ull,},
+		{0x0f44c21edb8ef663ull,0xce6535ae251034ffull,0x56fe91b7f59d78b6ull,0x22a07bcf1f66c52aull,},
+	},
+	{
+		{0xa57cde71263f64caull,0x278902698a3c023eull,0x90b4d08e4afdbff3ull,0x08c2ca44007f8ceeull,},
+		{0x59c330187cfc4013ull,0x37fd40160f2c21d5ull,0x762edf98d389e7adull,0x1971eb190190ca50ull,},
+		{0x02fb3e15316ead29ull,0xf66cf11e50b18642ull,0xabaf6bc380ff9d8aull,0x1171aba5c686c69full,},
+		{0x8bb6b4981485c26full,0x324f49ea6947e5caull,0xf855ce5acd7d10a3ull,0x0032f4a2b10e6017ull,},
+	},
+	{
+		{0xf817612adde5c185ull,0x1dc9217df456eba7ull,0x1cdd9492c644d141ull,0x1861a303e8cf5263ull,},
+		{0x2568fb7b5e245e9eull,0x3c3fe0a41bcd5f99ull,0xbc16376c1238de19ull,0x0a643b3700911f5cull,},
+		{0x7834b489d736f3cfull,0xe658b0952cf7ea54ull,0xa870246a1520fe57ull,0x1fd91235a4c4d35full,},
+		{0x6eb14edfaa0ea606ull,0x6f6e397a130858b8ull,0xb5fc554d7fff4297ull,0x1c2a68196d3c69d9ull,},
+	},
+	{
+		{0xdf1d95057d856083ull,0x7ecee0689ad1a4a4ull,0x7466ab64f7ad8db7ull,0x145697db76b258baull,},
+		{0x8356b3275e9e98afull,0xd415afd8d96e6b59ull,0x3b11133196680656ull,0x1ec9e055bb257566ull,},
+		{0xd0fbc95607ff1d9eull,0xc69ececfee1b3bd4ull,0x90a563404b78d3ceull,0x0d1b57f181dd0957ull,},
+		{0x59cd051b21029462ull,0x8607b61daee42ce8ull,0x27b83612c8128440ull,0x13010aaaad7f58a0ull,},
+	},
+	{
+		{0xa3a389129f310186ull,0x94dbe35a1eab4df4ull,0x973d93b94547fd9full,0x1f3cefd862dcf8abull,},
+		{0xb8f666f2c0ac35bdull,0x1a270dac3e7d45eaull,0x734429e958a9ea2dull,0x1b60d1af0bfb5352ull,},
+		{0xb1c77012e695d5d4ull,0x8e89ebb8876d38daull,0xc2eefea72203dcacull,0x13afd4cd56801abbull,},
+		{0x02d960f721a2e240ull,0x0176304a6b9557b7ull,0x588051d2c672c50bull,0x13b55cfda0514284ull,},
+	},
+	{
+		{0x2a23331fc8d7c77dull,0x9802629845d3e01bull,0xbad976b0431ecf5bull,0x1df7dad033902f21ull,},
+		{0xaca0de319c822808ull,0x3e8eb332e32fd1ebull,0x9d42cb63a02a171full,0x0031d1fc0bd39cf0ull,},
+		{0x19017fe5afc12cc7ull,0xeb22667f5d3dedd4ull,0x9fafe17009bd841cull,0x036ad0d38d1aca38ull,},
+		{0x6b9e806590dc00c8ull,0x549aff4f416887fcull,0x9c4dfbd6beeed011ull,0x22717e95ba3cf3c5ull,},
+	},
+	{
+		{0x0650c322fdbaeb9aull,0x9bc91cdbd23861dbull,0xe6dac645dc8465b4ull,0x2002b3e5cd007046ull,},
+		{0xf132c60e0ccd4920ull,0xcd0f3618a30a53a3ull,0x1f4d335bcb505a48ull,0x0cd5b8cbd6843294ull,},
+		{0x51e935e8a67ad298ull,0x3087c59b5a064485ull,0x84903855c644f5d3ull,0x1e7774b3cd8c79d9ull,},
+		{0x294aeb9c8e0fd2a4ull,0xc3b57e48321932f0ull,0x6868b8397215554dull,0x09c1cec98c6b5b5full,},
+	},
+	{
+		{0xcbcf163fa14e2ecaull,0x3feaf0195dd78658ull,0xdd5ce70bb3a105d4ull,0x1d1837a5780cc58full,},
+		{0x42b04c03ff4ae9d3ull,0x32da1ed341d15139ull,0x2bb4089745aecfefull,0x1e99aabff1bc7599ull,},
+		{0xcdbace9a248dd77dull,0x99d267789099fa17ull,0x3177e83040f628d6ull,0x23dae18f89870877ull,},
+		{0x946032e571b317fcull,0xb029f32d6a1ab6efull,0x4fdc76f3681cb466ull,0x14f852a7f1aced7full,},
+	},
+	{
+		{0x315133409e32b463ull,0x2c5f1774de2650ccull,0x7f2951dc544ad147ull,0x0379a2a509c4e44full,},
+		{0xc751d97ac3b8cec2ull,0x3212a0962f5fa1dcull,0x4a70f526d5087b96ull,0x0e5439c192034706ull,},
+		{0x311af932b5987e34ull,0x77ad02b7b1b2ff35ull,0x8f98cbb22fd369d8ull,0x227b2c7f5df6754full,},
+		{0x2ddc6c568221a68cull,0x7262ca4f5d07e4fcull,0x71e4b977bca284ebull,0x10195c6b20c74bdfull,},
+	},
+	{
+		{0x8365b306c8b43825ull,0xe5c2a4838922477bull,0x85b4c3971693af63ull,0x10f22d7b7d1b3dd0ull,},
+		{0xff0f6ef7cf2c26eeull,0x9468e85c7269c5b8ull,0xf62997dedff380eeull,0x243110a2838e9639ull,},
+		{0xa6eea7cacd0d7441ull,0x9a2e7b3dcfed5823ull,0xdc38bc8daeb7a048ull,0x025056425a1dd643ull,},
+		{0x7185ddc347822afcull,0xade7995dc0d39047ull,0xa3caeebee3db92a5ull,0x03f4f06fc21397b6ull,},
+	},
+	{
+		{0xf5d3a3e3c0e9c718ull,0x1afd3ecd62c25981ull,0x995ea6266a5b8614ull,0x1e8461e484e98f4dull,},
+		{0x17e9789931bb0fdeull,0xc3c0478796cccac3ull,0xe19b879821f402efull,0x00d7488edfc2e36eull,},
+		{0xd99758f87f35d9dcull,0x44b2c496365615c3ull,0x0d0acd6901bf0090ull,0x201c81e677ccae28ull,},
+		{0xf5b4f41e9088c0c9ull,0xdd74f9fd55e1f8f2ull,0xc3ab058cf2accdb7ull,0x09e4255f5c693c80ull,},
+	},
+	{
+		{0xa60576a8603d393cull,0x696e558ecf35e89aull,0x90d004b039613139ull,0x05909d0e61770972ull,},
+		{0x3b29d011ee2f12c4ull,0x0f9a137acc96e2a1ull,0xcd06a34a61bbb614ull,0x098e8c90b3891c8aull,},
+		{0xe7c67754456df8c0ull,0xedb051374d558e89ull,0x552f91320f184113ull,0x15fbe0f60008067full,},
+		{0xb434fc44ffed0cb1ull,0x678dcad2d1ddeccbull,0xc1aa155ae2867b6cull,0x0e1150f873722e90ull,},
+	},
+	{
+		{0xa6dff683d6c20ad8ull,0x99ca7f2b58f4800dull,0xf209753ec03cb62full,0x127282f0ead6abcbull,},
+		{0xb77bd36c5a358864ull,0xef94c276dad26290ull,0xb7e45753ac3a6eebull,0x02ab79e67e6c8ce1ull,},
+		{0xa559e28601974091ull,0xb785d5bea4803a35ull,0x0c428321b026c872ull,0x1f55c6af03ce57a2ull,},
+		{0xeacbb839628d9782ull,0x25ddc25306fbcebbull,0xf8c7415c0de0ec5cull,0x2378ea24bd73c270ull,},
+	},
+	{
+		{0xce34ec11dff866aeull,0x5bb2499811a2ca1cull,0x66412f50e4235d63ull,0x0902bb1f21e76433ull,},
+		{0x64d108ce28e54026ull,0xb9884672d33fdd3eull,0x7ad1478de54b3a92ull,0x206009dfa74f4efdull,},
+		{0x2ea779ff57ced9baull,0x32a0f12e6bc129d7ull,0xe6864eccfa4b1ae3ull,0x20155561db1e11f3ull,},
+		{0x22cc254312688333ull,0x151b3f1133334ca4ull,0x3c5291467427be49ull,0x051593c81fe03e92ull,},
+	},
+	{
+		{0xa8f4e50dd5a23b23ull,0x24d7f9bbc95b1d6cull,0xddde38a81832ff64ull,0x107aedaeb656eb63ull,},
+		{0x9cbfdfce91966512ull,0xe3e07f950a00ff0full,0xd82c5d6b51bd16b2ull,0x1a308e01a00bef7eull,},
+		{0x388fa2bf46820183ull,0x4cface3232df6bcaull,0x5534e97508634f17ull,0x1b02a9dc994f8b3aull,},
+		{0x42b4ed065e15f641ull,0x1a1470e6c712a710ull,0x70a4379be214d323ull,0x076d4201e80b278aull,},
+	},
+	{
+		{0x3f5825b94a276a68ull,0x0e8b1d0818abdf5full,0x5e495732ba709db4ull,0x04c38b7332021d51ull,},
+		{0xf78548676e684ce9ull,0x25ad06cd70c23e35ull,0x8ded2a449de43858ull,0x1195ab6bd0fdcf1eull,},
+		{0xb36b8484841b0268ull,0xad0b440519629cb0ull,0x5c79aebf9687d64dull,0x0754fbce292b271cull,},
+		{0xeb92743e88db4401ull,0xadef97a03f3a358eull,0xfdd33d35dd25c9b6ull,0x2227db54fe2864b1ull,},
+	},
+	{
+		{0x8df24c40bc00d163ull,0x368782803217a0b2ull,0x8a57abaafd810f40ull,0x01266d469b5c6436ull,},
+		{0x2f980c5d957ea8e7ull,0x4fb7e695d2ca6513ull,0x6ee155c04dcb83e6ull,0x11bb96df803117e3ull,},
+		{0x31e57a2f9de81324ull,0xd3c6b2fc48b38295ull,0xeb7874083e420909ull,0x17928de252ac5f4aull,},
+		{0x3b773c61eb3f5651ull,0x8c42db8cbda9a5c4ull,0xc893ab85ca6019aeull,0x197dcf68092d980bull,},
+	},
+	{
+		{0x12edce5301a4f2f1ull,0x3dae04463f46f0e5ull,0x4dfbb5a6f9a08905ull,0x15aebed64ed627c0ull,},
+		{0x23e4265b01ca47c1ull,0x8cc29a644a7f4accull,0x083437d5de1c8817ull,0x0e3f1ec3d974e18dull,},
+		{0x249411ef2df3c4d4ull,0xdf796733aa2aeebaull,0xb611b40ed958289cull,0x071562431713a574ull,},
+		{0xba194be4b09fc504ull,0xf1a7acbe7aeaa1bbull,0xd9bf1fc5057f52f3ull,0x22d2276b9e4c4cd6ull,},
+	},
+	{
+		{0x6abb3ad9873793bcull,0xdb7c1b24ed4efd41ull,0xf6e7f49ed29470daull,0x1f8da95ea2372c0eull,},
+		{0x66cf173ce2b9b61cull,0x5ca927401f4525c8ull,0x1532e80eabfc31ccull,0x180efccb3cdca51cull,},
+		{0x36ffa2ba597e697full,0x22d2a54a3be19638ull,0xcfb83d72403012b1ull,0x051dd2dd3ef6e6f6ull,},
+		{0x66ed5bb1a7d67831ull,0xc24e64970b3acf3dull,0xa3bc5afa33ee3d39ull,0x14fb29ec79a49d02ull,},
+	},
+	{
+		{0xa7abd1cda0bf5815ull,0x77b399208264b5b7ull,0x7f3d6472d8232077ull,0x0fb977e8d2d83016ull,},
+		{0x7f05912a9c6d297cull,0xce62c8506f4ebdb4ull,0x32411513a50af1a6ull,0x067d4a2163fa58f3ull,},
+		{0x13900cdf50b72d9bull,0xdfec3acdfd323078ull,0x9c809854c46c57ecull,0x235152580e8215abull,},
+		{0xace67a05e4d6fd96ull,0x63c9532037d1a48aull,0xced7284c51b8bd47ull,0x0be3427c3075945aull,},
+	},
+	{
+		{0x68f2ccaa8329e095ull,0xf3e1490edd431522ull,0x3306a971ebecf2c8ull,0x01d7df200831e849ull,},
+		{0x831e21acbd09b70full,0xdb24f26717c3912eull,0xe8a83b05a46df11cull,0x22d04e4e25b2c6a9ull,},
+		{0x88cc00ff30a07d54ull,0x504ec1d052d702c9ull,0x18499f32ae0e2155ull,0x1fb2385c65ad631cull,},
+		{0x54cffd02952dd287ull,0x06819ff79d0f7cadull,0x3abcff6c18745987ull,0x03b27d1636dfd125ull,},
+	},
+	{
+		{0x429fdad6971beb29ull,0x2e7c5bb9f8af407aull,0x094d6f122c997ab2ull,0x0f425a9521750cf7ull,},
+		{0x71c7fa46255274dbull,0x0c9e85a072a567e0ull,0x4c431c9a8bfb9d67ull,0x052472a4d71283d3ull,},
+		{0xcc2d7621bf4cbb27ull,0xc4271e553cceed82ull,0x2205116c8742cb86ull,0x1bc2d6503cec0493ull,},
+		{0x17e31cea55124941ull,0xa3fbf0f8e0356053ull,0x2d8ec3847f1f31f7ull,0x08fcf71f70ce277eull,},
+	},
+	{
+		{0x73a704de3b21062bull,0x23bbeb5d27630710ull,0xaabfd0f7684caeb4ull,0x1698b46a7b2118e1ull,},
+		{0xd4d86f807a18ab59ull,0x5d893ba646471e5full,0x3a895debd4ebbe53ull,0x09fed5fbfc2bb8eaull,},
+		{0x461c4d2a4ff29f86ull,0xaa40ddf8ed2ffd45ull,0x0f3a6b41ea952abbull,0x0bb720bf2f6e69caull,},
+		{0x71aa3f564ac7da1bull,0x4d7eb5334a63b313ull,0xa7cdebed98ae0aabull,0x0ec7316a380a45d4ull,},
+	},
+	{
+		{0xb493ec063c73f2a3ull,0x0bbd9a10f35e12a8ull,0xee51f14d7609e108ull,0x23745353f50d0b0eull,},
+		{0x09fd3a8ffff04e51ull,0x98e5440a80cb6fdeull,0x4480181a5ac164e3ull,0x132ce8a609c982bcull,},
+		{0x0cfc26175791e17cull,0x1e103eb38fa2e374ull,0xd834fd18581a0dd0ull,0x0e3058641d97d585ull,},
+		{0x69a7b00aa9690249ull,0x278f49f292cdc074ull,0xd9262b2d9b7d0f26ull,0x02cfac0f39cb6edbull,},
+	},
+	{
+		{0x08e5941d23f42c63ull,0xe0fb09ee2f74dac3ull,0xd55d37474527ad67ull,0x1f7ad02e2a4410baull,},
+		{0x6c11c3005623e96aull,0xe3c0f4fb4efc6b6dull,0xbf3c0ebd28eb9c22ull,0x09e5e5d4da6ad301ull,},
+		{0xe3321adac5037e3aull,0xf6ef80f5d03d5601ull,0x563285b5e4e0a625ull,0x224616005a9dd94aull,},
+		{0x0cc9f9b735e4d691ull,0xc8a87da2d9a6c45eull,0xb21915e93b8151f6ull,0x04860ff8683948cfull,},
+	},
+	{
+		{0xb1a295b12c07852aull,0x8ab5bc491fed1d3eull,0xf832c94142515f4cull,0x0da7bb798f8029c5ull,},
+		{0x56bee27985407d9cull,0xb0f771243cdb20d4ull,0xd316d1a2b35471c5ull,0x0f89ed0c0e685895ull,},
+		{0x2c2af7cb255352aaull,0x26950430ef23e5d2ull,0xd6bb7c966b69893aull,0x225f0982a7e8f470ull,},
+		{0x7048773d9fcbef51ull,0x0bda35380d91225eull,0x74edfccafda8e396ull,0x09313e5457aac37dull,},
+	},
+	{
+		{0x9e9e2b7a8a5e92ceull,0x74fd9c82a6996d1full,0xf2bc26359bc85b80ull,0x09a6afc1dabf5a72ull,},
+		{0xa4e2a91e3fe4bc21ull,0xbbd8ed9c45b71caeull,0x3635d74075f80fdbull,0x031145c54159804full,},
+		{0x808bcfce4bc35026ull,0x5bcc26fd78e0053dull,0xfb92cf02695462a1ull,0x04dfbfce11163f10ull,},
+		{0xf64952a119b08fd5ull,0xdaa158c028aaee4dull,0x995fbec48b6a8d0aull,0x0818b8a68b937082ull,},
+	},
+	{
+		{0x21cf770990ef9e87ull,0x7533e7a02d95f608ull,0xc10e0c559d54b89bull,0x10981af782694b1bull,},
+		{0x8b7b1493bd2850afull,0x2de84d46fea996c7ull,0xf6d0c16bdb5ae8d9ull,0x030b766a7e00400aull,},
+		{0x2d6f8ce9a9f09d11ull,0xf8000885a045ca66ull,0x257c3b43dd714945ull,0x22ac79b63b323c04ull,},
+		{0x61abe245c44ae6d9ull,0x6145aaa55d89dc8full,0x8363399c4fc703d3ull,0x103531472ca4c9d6ull,},
+	},
+	{
+		{0xbc9e4750e8297d0cull,0x87b24fec59ae2684ull,0xc54be8f4ac11a7e0ull,0x06504060a744758dull,},
+		{0x93841a36489cb1bfull,0x6d20fd9a482f7066ull,0xc56a5aa6c96e9bb4ull,0x0e45414722f4d435ull,},
+		{0xa88e9dc7688e91deull,0x8c69ceaa9e27044eull,0xf9a366169ba4a716ull,0x0be00de04ce2589aull,},
+		{0xcef5c00704c55f36ull,0xb098c95c277ee6deull,0xfcfd80ba0ecb3f74ull,0x229721f0a22390feull,},
+	},
+	{
+		{0xbfe5e50dc1ee6cebull,0xddc0d2faff337382ull,0x6dfc40eacf5305d2ull,0x11105d0c6fe61314ull,},
+		{0x62f81e1796b42accull,0x2cfe411aff5f660aull,0xfe6c7d094f8e5817ull,0x093494e8325dfa9eull,},
+		{0x62a891fa24086ee5ull,0xbdca6645956a9001ull,0x35edc33fcdf154f2ull,0x04b8f1385b52c8ebull,},
+		{0x669bf502fac10540ull,0x5b198e004c70266bull,0x9a7411e8bfa62596ull,0x161433fb84683e40ull,},
+	},
+	{
+		{0xa14b41f274fcf285ull,0xc37149f90cdc6998ull,0x0b58dbcbf08e8298ull,0x0f6b05d059a35483ull,},
+		{0x76c592e6605d8631ull,0xb3b66579e0fedd0dull,0x0fecce358e4fc4edull,0x09f2da58b5824c47ull,},
+		{0xe75c8f81ac15021dull,0xe27e5d7f621c4c5aull,0x753420dff8fbb979ull,0x009fa20255788b3aull,},
+		{0x9fa3580b2543b6e1ull,0xe6cd2c449a736866ull,0x06c15a02201c9b06ull,0x08245899125e8b31ull,},
+	},
+	{
+		{0x9d1057af1e4822b5ull,0x6c2a8a08e4546dbcull,0xe21efb3e155797faull,0x01256dd403711adcull,},
+		{0x34aa9eb92a19d5f9ull,0x6ecbfa67fed28b03ull,0xfc613a393bb36257ull,0x1e0938f1bd1118efull,},
+		{0x74ca84c7cff9f801ull,0x52409370bf986f0aull,0x37462fa1b7ce6404ull,0x148f4150c2addfa2ull,},
+		{0x624880a26a5a8fe1ull,0xe2ee37b3511c9b9aull,0xdd9cb68fbb6d2465ull,0x16ccd2356ece40e7ull,},
+	},
+	{
+		{0x003400f656312ad1ull,0xee1a9efaf40fc558ull,0x3f1b87f21ace97feull,0x1f61217eaa9f39c3ull,},
+		{0x8dd473744558ff6cull,0x3da70409f29d43bfull,0xaec2989c331c8bafull,0x1f62b6b75da1f516ull,},
+		{0x8583f64c45c09feaull,0xad75e3c2fecb60aaull,0x129ea97510804f34ull,0x1f5010b5778cbf4dull,},
+		{0xa0a568113b7c821bull,0xffab30b7ff9be75aull,0x7c89897dc736d995ull,0x08bbf96d23db6c01ull,},
+	},
+	{
+		{0x09b42e74fa4f910aull,0x4ee4f6fff04f79fbull,0x7a498c38d51266f9ull,0x05196cade51eb939ull,},
+		{0xde0bb30b3ffedc47ull,0x14b67bb4db062fb9ull,0x003bf13dc6068f72ull,0x19066e6caa0a16fbull,},
+		{0x7c200ff5652ef0a6ull,0xa32484545ad12517ull,0x4477f96f6b4c88e7ull,0x16123f8d282471b7ull,},
+		{0x685cd944a79ca2fbull,0x5ef1ce822441cd5cull,0xdc0b9649c2970277ull,0x078bb45be02e8d92ull,},
+	},
+	{
+		{0x2ff58218cecbd016ull,0x7e6f58501d4b4b95ull,0x23d9e5db954898c6ull,0x08f0d43746ec5538ull,},
+		{0xdf999b8ac0f656c1ull,0xf234837d47c62c16ull,0xcbcfd61614d45a56ull,0x10e753001eb1155full,},
+		{0xa12af4a411b04dc2ull,0x61e358bf299422ecull,0xa67178cd5609ccfcull,0x1b673d93c2044d90ull,},
+		{0xdb6e11a2de3f2157ull,0xad70a64620f33038ull,0xd048dff600ef9631ull,0x122e117eb43c1d65ull,},
+	},
+	{
+		{0x32051205ef6c3ec1ull,0x428415ffeaf5c101ull,0xe44d7c3648397851ull,0x1a8043ea6c25e110ull,},
+		{0xeec256f1eb29ca15ull,0x1a85eef76b6e06cdull,0xc401f5575a081803ull,0x0d87b754dc9b64a7ull,},
+		{0x704c256b4d7df075ull,0x8ea3f5d39a89fb48ull,0x0660639326fc6890ull,0x23051ec668733fecull,},
+		{0x1e34d8761b7430e3ull,0x11abd08166872ef5ull,0xa29480d99ea73509ull,0x1231a0fcc720f761ull,},
+	},
+	{
+		{0xba805f08e60c6048ull,0xfd2624c0c201f6fdull,0xd6edfd7f9075e151ull,0x23233c3bf72b7a2cull,},
+		{0xbbcb650930055efeull,0xcce25256c4705549ull,0xbda6ae202c20b289ull,0x13b76f823bdbee0eull,},
+		{0x4239f4b1a3ae65d4ull,0x3b39a0db59ea4e54ull,0x3149a91e9504447dull,0x0509faa99e0eed16ull,},
+		{0x0b5cae4c81a7a03bull,0x2ff85b7a86e29eeeull,0x8102394d08422967ull,0x0f54809447183c88ull,},
+	},
+	{
+		{0x40651a21226d5d3cull,0x32eb6ad4f170a3edull,0x643cad35d125c502ull,0x144f10e7b8e1f15dull,},
+		{0x56d1d4d62e969737ull,0x4726ddc8ae3a9063ull,0x1cc197ed7892a6edull,0x10988c78f8ae438aull,},
+		{0xb95057e3d77d2ebdull,0x0fb17767c93dabcbull,0x57b871e531344569ull,0x1a3da90da7f8e759ull,},
+		{0x1c213c8889053322ull,0x84b29065b812a5c2ull,0x1d206d3d2e1c8b44ull,0x0253b00c65affddcull,},
+	},
+	{
+		{0xfd5460e8eae44b84ull,0x0fbf90f5b92be815ull,0xbccc810c33f54b21ull,0x0c0cd6257ecce196ull,},
+		{0xa8c876e4fa033390ull,0x34ba9c4659a5d08full,0x93cd92ffddde1120ull,0x1f251d3d1c3ba311ull,},
+		{0x07961644080e502aull,0x440edf7d576588c2ull,0x485e82519fc8cdecull,0x0099f02921b2f84cull,},
+		{0x190352aa53035d24ull,0x1ba0b3b49a55893full,0xa03329b2d896aa9full,0x02542b0d3002feceull,},
+	},
+	{
+		{0x86dd48513e953aeeull,0x82ff5070588f3c28ull,0x009f01d135926640ull,0x13b7763beee5cb0bull,},
+		{0x0c1d263ece67fa20ull,0x591e97873ceb6fd0ull,0x54d9e9fa7868b7c1ull,0x22d83e53fc4573d7ull,},
+		{0x0b6d92e179966d73ull,0x46cd131f9486e781ull,0xb49c2c86bf90a044ull,0x0e9f5fb255e90bf7ull,},
+		{0xa65d93cc37e2f5d6ull,0x716e3acefce6e9e1ull,0x7e05d52ca461eb4cull,0x0d13853fb2202152ull,},
+	},
+	{
+		{0x276a392a3b69a200ull,0x6a1779415969de62ull,0x6cceef85bdd5eb30ull,0x0fd4b44707475ebaull,},
+		{0xc38c3d9a57f2fd70ull,0xb5a4c8670b753c9bull,0x4ba9c5b0412b8393ull,0x03acc47a8ebd32cfull,},
+		{0x30470513b3335b88ull,0xd7e812c2f3a0110aull,0x84eeb69c2d9500e5ull,0x004b74b7cc4d781cull,},
+		{0x5916d3cda50c73aeull,0x5f618739aefdcd8full,0xfd717500a7291129ull,0x19cebadeecfa7c22ull,},
+	},
+	{
+		{0x22e28ac6297bf859ull,0xe6d68fa02b917717ull,0x9362524c1d122288ull,0x0353e0eda5161c23ull,},
+		{0xea1d291d8ee2a6d4ull,0x2fcb7cce23562651ull,0xd95e69cbb8850ec3ull,0x0c2baaf62d5d869aull,},
+		{0xa63c310155cfe5faull,0x214a8fb4a241ec36ull,0xdc8104145da7047cull,0x2073c1439c77032full,},
+		{0x87dc142822bceaf8ull,0xd2e5fb376f4f83a8ull,0x67e223ada314d177ull,0x0636ff1d68b578faull,},
+	},
+	{
+		{0xa4690242a87ade22ull,0xccf9179f6d3eca9dull,0xbae4ca353ccb8919ull,0x0d93284f11bf43deull,},
+		{0xe973eb2fc3c16e8dull,0x1f8dd4be38be5bd7ull,0x8a8441fdbd0547efull,0x0bb004c07c7d0ad9ull,},
+		{0xca97fb9c45acc8fdull,0x6866b52dccb3cc38ull,0xe21939fd587a0444ull,0x238e4fc5af60c8bbull,},
+		{0x914b550c993ca0b6ull,0xf1732310ef1ac6a9ull,0x72b32e3cc1dfddd8ull,0x15c79a6747788dd8ull,},
+	},
+	{
+		{0x22bd071aee3409d3ull,0xe434b1ec2d966f25ull,0x4c00103af9cd965aull,0x08b4e6fcdc2f09ebull,},
+		{0x443728c244235b95ull,0xf9171768899c704eull,0x02f5c89d7e4ac46dull,0x0eaefb04491bce3full,},
+		{0xa479f8b81289b43full,0xd446dedfab9c4e8aull,0x76bdccee956d1dfcull,0x0b8891c92fdd42e5ull,},
+		{0xd644e2ab7ff513c4ull,0x4bf5e9b5008fe64eull,0x3226d455e598b579ull,0x0178aa896d87fc35ull,},
+	},
+	{
+		{0xb5ea55abc6b5d2b6ull,0xa180d088d992f932ull,0xeec30697ab9339d1ull,0x0c405ebe41557d32ull,},
+		{0x56c74dc68b083b51ull,0x986055aba46943d8ull,0x3a9e8456832cd7fbull,0x004ff5caa2f53956ull,},
+		{0x8734b5c62461bd42ull,0x1bafee9ad391216aull,0x0a2b479ec9e7ab32ull,0x2130e4dd1980fc66ull,},
+		{0x55cbaa300417c053ull,0xac04bf3b5d4023ecull,0x749730dbc48a8ba5ull,0x0df4709126b64ef4ull,},
+	},
+	{
+		{0x13b6a7d414916cc9ull,0x63aff91d785569afull,0xed3185d6667db006ull,0x1293a7f503cfe298ull,},
+		{0xd477d80a9361494eull,0x3c04a20a47d4e7daull,0x656e4a34bdff911full,0x1d5389e090f2bba0ull,},
+		{0x3fea7a11197c2cadull,0x4e878ce5e7c11db9ull,0x28f21574651cf45eull,0x138ec5a8981bcbb2ull,},
+		{0xba74364126fd409bull,0x22556704f14df27dull,0xe051d1e88cc7f95cull,0x07d740193f24be1aull,},
+	},
+	{
+		{0x1e7977909ddbb709ull,0xeddf8dd7faaa8d07ull,0xc132d38dcb25601bull,0x1c5a18d7c936892bull,},
+		{0x5c4868b899f65c23ull,0xf9c8967a657122c0ull,0xc23bd0b9fa8850c9ull,0x009930de5fb990b0ull,},
+		{0x67516d6abc8852caull,0x3d5dbc8c0631ae10ull,0x94723c1c9effa14aull,0x10a0b28ce453f9a6ull,},
+		{0x6db515e55ff2165aull,0xf3e4b84edac40349ull,0x245b9b67d1ff9309ull,0x2475c2fe52b456ccull,},
+	},
+	{
+		{0xbbc4ffc949ad9232ull,0x4b69b5744b6d4a7aull,0x7029d4f2fa3746b8ull,0x180a598043d323f9ull,},
+		{0x5b8280de924a935dull,0x8a11f615bc2a070bull,0xf5578c40ca05651eull,0x10ef68abeaa71367ull,},
+		{0xe2063480b55e17deull,0x302195b5c564bfe7ull,0xe2111e992960c37aull,0x04c36dee8d84f9a6ull,},
+		{0x93cfae4c1a06a3fdull,0x37f2fea53700b85aull,0x0ed2c5897e0026a6ull,0x1d88cd924d39be9full,},
+	},
+	{
+		{0x267b6750474462c6ull,0x7626c6d14e3f4578ull,0xdb22ea8e19c538dcull,0x1828fd8b1545147full,},
+		{0xa5d1bbb381d4a62eull,0x029a63b5d637156full,0x3a6d85002d59f2a9ull,0x0773566d0e12e6e1ull,},
+		{0x561232f2a111be64ull,0xb10f7a2da9534e3dull,0x18120fa5de8ce524ull,0x0dd2fa5651ca825cull,},
+		{0xbc96e6742276bc8full,0x24f2203dd2117da5ull,0xc2daa70c44738917ull,0x1632c993580350aaull,},
+	},
+	{
+		{0x8bfb99f8e74e3b35ull,0x4490a920f67f0848ull,0x9ec4b27562633d20ull,0x09ce8abcc2be8eeeull,},
+		{0x0b11fc48fa93ad43ull,0x67cedac29b76b462ull,0x611bcc4a72df296cull,0x0c04815ca8b5222eull,},
+		{0x8bbbdbdb0f0affcdull,0x96788d1bde1b9852ull,0x4ca449a92dce1165ull,0x0871fabee26a0128ull,},
+		{0x9a7997937f9d7cd7ull,0xaab24aa097c3e9b9ull,0x0a468cbc0dfc55ddull,0x22a6b46ea3bb8814ull,},
+	},
+	{
+		{0xcb706e7957ead361ull,0xd15a94f9c2e8c987ull,0x2b4208cefc096d36ull,0x0d3dfb537a4b9bf0ull,},
+		{0xbfc68e87b46a8c63ull,0x7a87f0ddaf2db82dull,0x6279f56fc5c2d85bull,0x0cf9dc211b4896c0ull,},
+		{0x0c25fc7074e8fe63ull,0xc0f97cce8942625aull,0xcdcbcec673fa47cbull,0x07c24493e9a8186dull,},
+		{0xedd839f588ece374ull,0xc67b6d36d99b60d1ull,0x44d5cac0a491958bull,0x069a91ccb31b08e7ull,},
+	},
+	{
+		{0x00bd8d5b96ed08bcull,0xe3ecb844ab74b082ull,0x7fe552d927c96af4ull,0x05e4a5fad6f7a8c7ull,},
+		{0x7ca8652312fb7791ull,0x096f142f3f29fc84ull,0xdcbd6eabb4b6c742ull,0x19f30b000a0529b5ull,},
+		{0xa2e4435fb92c2eb4ull,0x11f4a4a6541a2739ull,0x47632eafd9d35f1bull,0x182c3df8ab03b41bull,},
+		{0x3e5dd1d336596810ull,0x4a6fa1081950999bull,0x52a35d8999ccb99aull,0x16a4ee059c2b4bddull,},
+	},
+	{
+		{0x735a6df236eefcb1ull,0xd48291760cbac40dull,0x405a3a34e810a6e0ull,0x015704333a07c7b4ull,},
+		{0xf13bd40de7efe96full,0xeb5cca54d52f485full,0x17a637dc37094d1aull,0x0f435f98b2a9731cull,},
+		{0xb78994dc4d7c846cull,0x790a0743950b2035ull,0x48e803015193bf06ull,0x136d488acddf9781ull,},
+		{0x1e216c1c35102807ull,0xa3b8d53c6d7273f6ull,0x273e3652ec7ac0b3ull,0x21acdaead05c2471ull,},
+	},
+	{
+		{0xb54ba460f63685d1ull,0xbe4c1929f490c556ull,0xfe3fabc80231b1d8ull,0x22d7218fa8dbf770ull,},
+		{0xe5d16c7a15fe98dbull,0x3f4cbc7110850b09ull,0x5e127dcaee39811aull,0x128dbd5d78bb847cull,},
+		{0xb73f68df15598138ull,0xa65a93c379107d7bull,0x9bab38c48d7c4187ull,0x011e9cd28c749f6eull,},
+		{0x98e3ef312b4ef7f6ull,0xdf5d599ea472069full,0x8c8d2ac9c7730581ull,0x233e27743e7100ebull,},
+	},
+	{
+		{0xd5904da506451145ull,0x778bf5206a34aad9ull,0xbdf90b3c7d6f5d87ull,0x175380680bfdcbb2ull,},
+		{0xcdbdd8bb2166a512ull,0xf58bbc87583e4879ull,0x762b4ee6cb2090e3ull,0x20fffe93f1e0d9e5ull,},
+		{0x5b577479a5a53a88ull,0xbcacb92ce4549fbfull,0x659da9c37697a3bbull,0x12aacc7504da422eull,},
+		{0x12e39cb43ff67e62ull,0x7d3f1b2dc1005d51ull,0xb9da2f9dfe6ff3cbull,0x0ec562c226e9d7edull,},
+	},
+	{
+		{0x3a4b358b984f8db5ull,0x3f69b87f1cfd665bull,0xfbd5a5f9a09ad0f0ull,0x08adf8837cd314baull,},
+		{0xc6d3ad497a482c9full,0x8519c4aaaf43121aull,0xb2c38e132dab5351ull,0x1b0ac6d2d4725415ull,},
+		{0x5f6f742aa43253eeull,0x790a55dbb1040a01ull,0x4a21bfc7a8f343f5ull,0x18bc530f28422eacull,},
+		{0x8f508f80870eb370ull,0x43231d32d7f47fc9ull,0xc991e410fe346089ull,0x02bdffe3c28aae5full,},
+	},
+	{
+		{0xa4d4f838ddbfd408ull,0x605a2da7397bc23dull,0x791a4191f22cec2cull,0x163a697652d416d1ull,},
+		{0xcd47c0137d4f54a1ull,0x47daad9805a5ef56ull,0x7c86949c3be366b9ull,0x08f20a56b8d81222ull,},
+		{0xb744a202ac79ef20ull,0x0876745ce0b81732ull,0xfe7c22c6b2fb5722ull,0x19f4a70ab834b26dull,},
+		{0x9d44345707d5f035ull,0xe2cb1e741743825aull,0xeedeb35ed7c20a2full,0x1e2aa905911ef773ull,},
+	},
+	{
+		{0xba719905a0ca51cfull,0xad9e5bf91439ea2cull,0xa5815131907293e4ull,0x0990db4f4ffc7f39ull,},
+		{0xfe5411db5a9e5b47ull,0x739e4582c07da3f0ull,0xbd9afa994eccb34full,0x12a1a2b9bf4a8219ull,},
+		{0x5e0dac6ce64b0a9dull,0xe4e860d5978f0c21ull,0x59078a43b305d7a3ull,0x23ab66a40b97dea2ull,},
+		{0xad4f764bd1ad5511ull,0x3296161509f06b0cull,0x129fc468755f3928ull,0x0306ddd8d7d7602full,},
+	},
+	{
+		{0x1792f1a379ff2d8bull,0x97760fffbfc3d893ull,0x7048639473eda9a5ull,0x14e7a802aa341c5full,},
+		{0xbc65e033ef1744e1ull,0xb66820803a7115acull,0xe7893b42b0c8d00full,0x22131b3e3a6f295dull,},
+		{0x9af775019dd30a72ull,0x7f141fec867b2290ull,0x0c2eba37c282132full,0x09e4aa7191638c4full,},
+		{0x6e9865428561f7ecull,0x0bd57cfed5971439ull,0xd29057450a63269eull,0x1b25fade682150bdull,},
+	},
+	{
+		{0xa510291c356deb2cull,0x17799b3a019d199cull,0x32bc014a21e5292aull,0x104813b8a9d21e99ull,},
+		{0x09f0a79c49653242ull,0x5b5813b64701e26dull,0xb719b9e3da5ba0d0ull,0x0b7d63b6eee608c5ull,},
+		{0x28c72ceb83cb59daull,0x71356900d408cfdfull,0x0528b2fd80d806cfull,0x1799669a64833425ull,},
+		{0xc438b402c3502f42ull,0x9c58c7149d3d1425ull,0xab243bdcfd0684d3ull,0x0743ef8c063b945full,},
+	},
+	{
+		{0x233d45002bbac68dull,0x9825761b46e978c4ull,0x5685d67a76448e0full,0x0ed7b15e18d1ca3bull,},
+		{0xd7a789d7505fd97bull,0xbc8ad31190467995ull,0x2e4d7954564a0e24ull,0x098fd595350320c8ull,},
+		{0xaabc75bd024abd1eull,0xb733b6c15cfbbd7cull,0x94282c585b0a6c34ull,0x1c8f0f38a3c81525ull,},
+		{0x2a942149ef097883ull,0x64f13938d24c70dcull,0x3dfd3005bb200e57ull,0x14ffb65bb00634d5ull,},
+	},
+	{
+		{0x7e18f8d8c60fe732ull,0x7ef3ef800981b90eull,0xbd632886b151fb73ull,0x0b92fb0a47ead11aull,},
+		{0xabb12309cf3d02eeull,0x8fac0644553cb58full,0xb55708c0a3fd343cull,0x049c28160fd86550ull,},
+		{0x9404d284e4ce4099ull,0xadf59b1008d806ceull,0x25fea2ad1d7e8db9ull,0x23103ae473397fd9ull,},
+		{0x5b4fa3ef8edc0704ull,0x76589c23501a902aull,0x7a9184bdf9052eeeull,0x12408f1b2de7fb2aull,},
+	},
+	{
+		{0x9b877a18406957a2ull,0x2dc501a72a9ab7b8ull,0x933a2e78f9e30da4ull,0x04319f9648dbccd4ull,},
+		{0x9903afb61f790c41ull,0x94ec19a3367c6fa7ull,0x7305a8923ce21e3eull,0x084b1239501d78efull,},
+		{0xe4ca7d53f6674f82ull,0x3cdbf0e3a93ee03cull,0xa59dc3319eae7a83ull,0x172a3bebf948bbc2ull,},
+		{0x3ab4a95df4dcba45ull,0x0b592e8f03bb12baull,0xddd3624c7108261eull,0x1ce964543b55dc55ull,},
+	},
+	{
+		{0xb2e8502bb10e0779ull,0x57bb9fef1ef125ffull,0xd455a0c06a64ef57ull,0x22bc310a1a976872ull,},
+		{0x01d3c6bea1506206ull,0x5b7700949a08a4a5ull,0xcd4f3b94d7e1ac46ull,0x1c986fe73c12b463ull,},
+		{0xb19b37b6c95c98c7ull,0x818d856a24a4e565ull,0x3398e8265281533bull,0x0a1be6a63a44bae2ull,},
+		{0xc8ae05fe8aac8168ull,0x2eb05331b0087d94ull,0x560f20f245561618ull,0x150ee55feedc44fbull,},
+	},
+	{
+		{0x5a27be6fc1ae8167ull,0xd5d5072b56a6641dull,0xf6bbe3ffc516a300ull,0x17e71d6a078fb693ull,},
+		{0x3123cd70cbd75cb3ull,0x5932dc73c5c96b90ull,0x7cf6f68e47def4e7ull,0x13a5f871d5504704ull,},
+		{0xa1fb03b6e4601159ull,0xb3e4b0e676f5f809ull,0x711efc6642d0cfecull,0x09b21c6d6b0aa763ull,},
+		{0x6055fc0b3f2ec97aull,0x30c0a02575ab6878ull,0x7d73049962c972adull,0x23daedb591c9d408ull,},
+	},
+	{
+		{0xcd047d67ea36bae7ull,0x49b13e5ca8a4eabcull,0x567c306449f30ec5ull,0x1da7827253856e65ull,},
+		{0x3dbabc39e3253f17ull,0xdbdfb763a8800651ull,0x74c1a82336feb331ull,0x1489f759e8a4fc29ull,},
+		{0x094e20aceb1851c4ull,0x55e788cd11f12e94ull,0x40b887dd93c54755ull,0x15447b3950e72526ull,},
+		{0x4a6abef326aab286ull,0xf37a0f7a7856a642ull,0xc3a5a906afbc0159ull,0x07a3fbde01f321fbull,},
+	},
+	{
+		{0x1d90e6ef9ed7e64bull,0xab0f39da4cab5af0ull,0x5180b26dadcf711full,0x0861c424c086a90cull,},
+		{0x98cb611b6f818302ull,0xceb26b82eb111f7eull,0x322677c1d10f9c18ull,0x1a05056f6043af41ull,},
+		{0x467cb6dd2ea26e4aull,0x6d22e9fadefbed33ull,0x137bd86613ae9392ull,0x1a09d62f50aafa9cull,},
+		{0xb2b0db033d8b09eeull,0x2e11858cc7dc7a00ull,0x2e079c8d46986235ull,0x1f7b48dfe4bc09b2ull,},
+	},
+	{
+		{0x0cc04a0f8b187e70ull,0x4f2543e53949472dull,0x214c6740f1907ebeull,0x1a39d373feee7b0cull,},
+		{0xda9763be41f0c8bcull,0x6214e19e2812121cull,0xf9afbc73b1637dd7ull,0x1ae3772e775784a3ull,},
+		{0x57bfbf31d760ffcaull,0x1b157bbde48b3facull,0xe4bd2f564d46a97full,0x057a5ba577e6cae5ull,},
+		{0x54b45ccc3ab2973cull,0x0bf6103a34361529ull,0xb023c72a70303ddeull,0x1f7ead900d0000d9ull,},
+	},
+	{
+		{0x73e8e4cb09818b7eull,0x5882be9cd5e72431ull,0xdb08f2ee192159feull,0x1e4d6d435270f664ull,},
+		{0x119e4703fc3dd608ull,0x550c7506147e2b3eull,0x01e8a375b29508fcull,0x20e80d2c15ae9fa3ull,},
+		{0x5f6a7f507e1f66a5ull,0x9bfa5b0755252b68ull,0xb6c380251e01eb41ull,0x14afe385b2f750afull,},
+		{0x29f8d676ea55855dull,0xaff10f33effb55e1ull,0xe8483dc36c426249ull,0x0c9a84ed6323f70aull,},
+	},
+	{
+		{0xa9ed5b881a825513ull,0x19522f30d07eaf7bull,0xe32bb0626d904482ull,0x15ac651bc934dca9ull,},
+		{0xf68e85b948bd5398ull,0x60e7019f5e6ca60aull,0x70575a70bfa24bd5ull,0x01b3836aa7bd5a35ull,},
+		{0x4aab2cf59c86c961ull,0xc6de4f1ca726d714ull,0xc9fbad0f1f0ce115ull,0x01ee86644b71b248ull,},
+		{0xe04ed6546cbacef2ull,0xf3c5fb247126114bull,0x870d3a5562f5e351ull,0x2128b60b870eca95ull,},
+	},
+	{
+		{0x24f9da119c6d4eb8ull,0x9b6d9f0b9b2ca22full,0x3fd2c413cac31003ull,0x03765285e60f9edeull,},
+		{0x14298ffcc5f75555ull,0xbf75db2e8576bc14ull,0x93c6ddd442999ad0ull,0x0b70710edd56c72bull,},
+		{0xde2b1979dad1cc12ull,0x431f78243224d191ull,0x4c635df7518b921dull,0x15f43dd53fa33c35ull,},
+		{0x7dc6fb894ba704a7ull,0x926856f24360fa9full,0xc07635a1feff4fd7ull,0x1d77d237825eb31bull,},
+	},
+	{
+		{0xee5f7ebeca9e0d20ull,0x6c2b4b9968adba8cull,0xdf00de49fb18cd96ull,0x009fd8302e48f3abull,},
+		{0xeee03d62f42271c4ull,0xdf9a47cc1b831592ull,0x69a1c2f0907da03dull,0x0c5ba9483ce6a503ull,},
+		{0xe7d50091b6f17aafull,0xc595207267540d9cull,0xd01f01f3836b0d7dull,0x155789249f9408beull,},
+		{0xec3ad68d70f39852ull,0xa51648aed81fccd8ull,0xb78247f001b67a31ull,0x1ff13fe684c96800ull,},
+	},
+	{
+		{0x0bb5d8a01043ec8dull,0x0c390ee3d2328bd0ull,0x4f562ef6398848b4ull,0x078a36500aab7388ull,},
+		{0x0587cf9e3a5af137ull,0x6231f3b4816b14e1ull,0x6a7250cbb0a45191ull,0x00cce8baefe90b7full,},
+		{0xdbc5816918a6c180ull,0xbdfe67c74bfca628ull,0x1c68fdbd6baed364ull,0x177da513715cd8fbull,},
+		{0xbdd6a48e1975f081ull,0x764bc54b6eeacffaull,0x9c7b1157128c3178ull,0x003c86d16a982a64ull,},
+	},
+	{
+		{0x105dcd3778ba5392ull,0xecfb11e1b2e5bdbfull,0x9ddc4b1277a99db9ull,0x1d14e47e9f08026aull,},
+		{0xf4c8695afb65d38bull,0xfb43addedfa489ecull,0x98185f595e050d18ull,0x0843a28c4ddfb40aull,},
+		{0x1c37798e6d6f7927ull,0x7620b756ed59487full,0x21b1161c1fea4d5eull,0x00a2c920a392276dull,},
+		{0x568ea66210f30f9full,0x3249fec3781dcd7cull,0xfaddb0ae378558f4ull,0x11f14e486364ce4cull,},
+	},
+	{
+		{0xa9008a76ad8f3c20ull,0x5f9d6bfc9de13ed8ull,0xb15d553a534e34e7ull,0x0fd65015601e30b4ull,},
+		{0xebdbc2fa3edb00acull,0x219a1db8b01862b6ull,0xe95558eac8eb6f20ull,0x17dcc335089b61c6ull,},
+		{0x21e0ceb5137b1623ull,0xfa7f2d11b5ee207eull,0xf60d70904ba8f7ccull,0x05f18ba775e3f151ull,},
+		{0xd99ad322cfe9b77full,0x08dd64f3f54af018ull,0xd2576b3d37c469f0ull,0x154e3b30ac0895b8ull,},
+	},
+	{
+		{0xa628c7f7e2e1636aull,0x8492aba84df04af9ull,0xf7d10c026f2758ddull,0x00ca8418d856eec8ull,},
+		{0x307308fb7de42b91ull,0x392ffecc2e077c69ull,0xeb78fe5bb916499aull,0x00693cd76efa7299ull,},
+		{0x3df13f2a682f6fabull,0x62e1a31680693db9ull,0x254f58db9874fb04ull,0x1af776ba5fe902b8ull,},
+		{0x240d6332bad9302aull,0x6f0ea02e78509d53ull,0x17553d3f96522972ull,0x159eeaf0ed979624ull,},
+	},
+	{
+		{0xd386e5878ad55eb4ull,0xe790a40d2587dd50ull,0x3e378e258dd9eb46ull,0x15038ad049080a57ull,},
+		{0x7bdcc51a3578391dull,0x1aeb7446c36eff84ull,0xe2c222b5a397aeccull,0x18b64ebe338b81f2ull,},
+		{0x67f840fa4464fb06ull,0x1e9aba5b5647fc8aull,0xb2c4331d916909f7ull,0x0e558e5ead5b2582ull,},
+		{0x1b5da21c816f3cd6ull,0x978d0026b2c3f3d8ull,0xf0ab564de684cec8ull,0x0bd7555a90c4d0cdull,},
+	},
+	{
+		{0x42fa17edae54544full,0x8ab0ac8d16833148ull,0xa5defccef9d576a6ull,0x05d378b39773d930ull,},
+		{0x7e0a6364ed4d63f3ull,0x9dd186fbbc759447ull,0x30136e7e755f10c1ull,0x13a1c7e0f62d2621ull,},
+		{0x238f72d63324bb2full,0xc2ed7bf2e4bdb482ull,0xfcdeaa31351fc225ull,0x100806239e6e3565ull,},
+		{0x300f8b8aaa465ddbull,0xfb9efa515542bbf0ull,0xae4d57e3ca9deb67ull,0x2425ba4ab98f2103ull,},
+	},
+	{
+		{0xbaa863deff1aaa04ull,0xcaeb3b8c12f9170aull,0x86339c8d330ee53aull,0x176cfdf6cc3e9f6bull,},
+		{0x60c17a0c0ca7cdf1ull,0x79926bfe5e7cde5bull,0xf1d69566dc1d4304ull,0x05b349d2d31b958full,},
+		{0x27a5250d44d99d29ull,0x44585996561768e5ull,0x46cabcd33275455dull,0x0fdb2c18bc065971ull,},
+		{0xcffb588f218627ceull,0x05baf462f91a25c7ull,0x4971458df327a0c4ull,0x115f8a2067ee691dull,},
+	},
+	{
+		{0x43b6e4cd6e207f7bull,0xcb29dd5e04e63219ull,0xc58b854335114d97ull,0x09a9fcee16a0686bull,},
+		{0xbbc5f3d04ec8fef3ull,0x6bdcfd412cc037c4ull,0xf35d881083220e0bull,0x096acf87eb577807ull,},
+		{0x7b6f27204ed8d5b7ull,0x8b6fbb6b0c8c1199ull,0x4cde9829f694257aull,0x0005b41e0aac57d9ull,},
+		{0x372113e8c4e1d0d8ull,0x8abe1a55155c9533ull,0xf5328e8143a999ddull,0x06018597816be4beull,},
+	},
+	{
+		{0xacad5330f019c3d8ull,0xab96149f40f4551full,0x4b8de0901f8425a0ull,0x04a8afc836f5fc31ull,},
+		{0xf632cb43a9ef7cc3ull,0x59dba12626c97e93ull,0x08ab533ba3903d05ull,0x05bc1994b9b175f9ull,},
+		{0x53ce09f8035cec1full,0x8f78340fa7be7a6aull,0x8ae2adb6bc66c3d8ull,0x2041bc7c7b13bb2dull,},
+		{0x734fd764265e02d9ull,0x9ed70311b8374661ull,0xa6ee0f2803f8e83dull,0x18d3a15790ab019full,},
+	},
+	{
+		{0x2a39235a60502545ull,0xeb7eb6b7d7846c63ull,0x089d2261373f3421ull,0x16aead42e4925da9ull,},
+		{0x1e64df3d4a96cadfull,0x2ce485e60469b171ull,0xd51a1333fe0f53c2ull,0x0c7fce85b5e8a000ull,},
+		{0x7f8215e165d636faull,0xd7cc1ae0e93ff100ull,0xe8aa3aded7cf2b4bull,0x196e9d827fb9dfc7ull,},
+		{0x8469bc2844118d63ull,0xaceb40000ee1c40dull,0x24649cf96313107full,0x0f8849235ca85d6bull,},
+	},
+	{
+		{0xb30a54e16f228ee3ull,0x8c36db0289b48fb9ull,0xcdc57d7d505062b2ull,0x154262d767d01eefull,},
+		{0x99473de6599500e2ull,0xf8700729d023a4c7ull,0x072fd3a3dca3ffbbull,0x05591ae8314bec56ull,},
+		{0xedd370db79a62d15ull,0xde268e28cfe30e9bull,0xe1d27d1837efdbd2ull,0x18ee3e35beb6b467ull,},
+		{0x74f671cfdd769f3full,0xaa368851a3a6407full,0x472d6f93b59d05eaull,0x17352f75d6510e12ull,},
+	},
+	{
+		{0xf86e8fc4a5b9f83bull,0x7d7079b6ae000a01ull,0x6fe7498097e61904ull,0x087377374b7a95cdull,},
+		{0xc95bd590adb9fdb5ull,0xeb965002aabdfac9ull,0x157ff0759ca98072ull,0x14f2ae825f4b7b68ull,},
+		{0x762f92e9079650e5ull,0x6d7a054e0501c6d5ull,0x484d52df57c9b34aull,0x08101d281ed46356ull,},
+		{0x8f2dfbbfaa40defaull,0xc9de4016032a0087ull,0x74e1ab01f97bccb7ull,0x0d8ba4a331aabe0eull,},
+	},
+	{
+		{0x0c3f710c9910cb69ull,0xd91b3cb48c3ca37bull,0xfc5a5f8779a2b08full,0x2509b6665f55f558ull,},
+		{0x143d51a2d54ece9cull,0x5d9226c8e5dba214ull,0x6a154e318ed64243ull,0x1659b8ac804d1c8aull,},
+		{0x377c3308fda65831ull,0x2cfecd69de232dd1ull,0x5abc224c42ef3d6cull,0x01f60afcfbc826a8ull,},
+		{0xc56e2a582e4b754eull,0x9275b770c50bd6f8ull,0x1481a5ea1b9b6458ull,0x013dbe6215601729ull,},
+	},
+	{
+		{0x038266a1da323a29ull,0x8c8844700c3ea03cull,0xabda69fc30eb9f11ull,0x22dd4d0719f8a529ull,},
+		{0x08f554081ac8d733ull,0xc6ff6b994018d2f2ull,0x4e4a908c3520bb09ull,0x100114631393e6c4ull,},
+		{0xcf5ba0a5ccf6f375ull,0xf05fcd10df19d178ull,0x07cac2ef15614c63ull,0x21a0567c5c2efafdull,},
+		{0x2fe79a2eff5e51cbull,0x6d5b7edd0f1e0e7full,0x159cf0e1ac169197ull,0x07727154267d94c1ull,},
+	},
+	{
+		{0xe9daad6e627e90d0ull,0xd1246dc7fd6c6862ull,0x68a847388afc2e41ull,0x24ada5e9066f1304ull,},
+		{0xd863f3f65d3cf3d9ull,0x0dd07c1b9563bd74ull,0x144279610d6162f3ull,0x201e1fcb04183a21ull,},
+		{0xa6ec021b5be42cb0ull,0x36f40a4e4190536cull,0x4bb9c6972c9d0a88ull,0x00c1cff2bf160a3cull,},
+		{0xf8997d355b3a246aull,0xafc08fa6760f96c7ull,0xc91f1babe5c3db22ull,0x0136b583da47baf7ull,},
+	},
+	{
+		{0x19bf0e1b4c24701eull,0x3256e89817ff1302ull,0x304ff87618d2ab6aull,0x239a0e9adec4f830ull,},
+		{0xc08dda8d3d4000caull,0xb4d473bcfb24a1e1ull,0x398f76b7f3c215eaull,0x1a652052f4b8bc7aull,},
+		{0x2c210da8a60f192aull,0xc110813d063dd1b7ull,0x1ef464d3ec88ec98ull,0x0527561de669e238ull,},
+		{0xdd221655c39b387cull,0x48f79d5bf58d1af8ull,0xd330df48480b6134ull,0x16e90e75dee02cc3ull,},
+	},
+	{
+		{0x1dab0eb0ca36b2beull,0x73956cee8678d391ull,0x6f653f8c5bc7c600ull,0x1ffec28ad56702b8ull,},
+		{0x8294727e471f97b8ull,0x8e18f0a7eb927afdull,0x67f23f7361b8a652ull,0x0faad74734a086bdull,},
+		{0x41e87900a871ebc2ull,0x1b4bfbdf484d0bc5ull,0xbed1edcc21cedb32ull,0x13e5aa3374d2f07bull,},
+		{0x2ab7b739d6136593ull,0xf1044f811f2c505bull,0xa43a674b03546717ull,0x070c03ee11cd3e93ull,},
+	},
+	{
+		{0xb7ab2228fbac28acull,0x0abdd68ab9849891ull,0x3b99efdfbbf94f69ull,0x05ecd0703fa56815ull,},
+		{0x535f3e09836a4db1ull,0x73569b085cd5487aull,0xc8ee53e27234f2f9ull,0x073ec20788658f32ull,},
+		{0xe496a60370cd33b4ull,0xc5ea6c74ffb79510ull,0x55d65b9e5b7a5aa1ull,0x06a8faf83109dd81ull,},
+		{0xe97118bbce2d2b6eull,0x526e2e242442cd82ull,0x57dd4d87bdc36fa5ull,0x22e31bab32cfd0cbull,},
+	},
+	{
+		{0xa0deba362e0ef98bull,0x2fb6a5e80b7eb299ull,0x9caaea415968567bull,0x20a53434822f0f23ull,},
+		{0xe214e4f7e8196dccull,0x4b504b1670bd5916ull,0x4817154b361abb5dull,0x1e316bd114d487e3ull,},
+		{0xa5f6a866cf189ad6ull,0x9228b2e3076cc09aull,0x595d188774bd3527ull,0x20a37e059c1cea4eull,},
+		{0xc210a27fa9c657e6ull,0xbc25088514faefb6ull,0x7fd9bb93e577c3beull,0x0cd127f5eb1e9236ull,},
+	},
+	{
+		{0xabda14f6c798db29ull,0x97c89ead958d7c5bull,0xd3c7fd3958accac9ull,0x1771e0252f4a214aull,},
+		{0x0f44419a6b170989ull,0x5c509f2b2de0a319ull,0x26118305ad62cc41ull,0x23a08932493e1cf8ull,},
+		{0x505f1f9236d2cc55ull,0x7c2653c968d72e04ull,0x821fcf1a6c2670acull,0x1ce147d92d8f8fb2ull,},
+		{0x8aceb0b9cf54e940ull,0xaea9e53eff283c93ull,0xdb6c284b308b07ddull,0x1dcff04bb6da0850ull,},
+	},
+	{
+		{0x20f599344a038b85ull,0x0473f6c8645dc4d4ull,0xb31367538981194cull,0x2461292ee250c478ull,},
+		{0x6fc224c9bacafe33ull,0x432f197d6dbcdba8ull,0xcc17e74eb44f36dfull,0x063942553131e792ull,},
+		{0x09959cdddeaa7015ull,0x49f2f2205b9f4133ull,0x9c04bfbee4eee9ffull,0x175d9772bcb28b5cull,},
+		{0xefb633ad882899f6ull,0x92d517062e163d3aull,0x71f3630921caf9efull,0x20809681e20338d2ull,},
+	},
+	{
+		{0x79832654da2cb813ull,0x3ffcfff46e7bb7b5ull,0xaab45ea6abd8baa8ull,0x0b31e18d5ab210b8ull,},
+		{0xcd10cf423500f2f2ull,0xda6e3c3d46817538ull,0x89b405369f424438ull,0x1d7bed6eb9e13fd4ull,},
+		{0x88c627487ffed8a3ull,0x50d5332280b1a47aull,0x97a4389b74a74bb3ull,0x03269069c9da5b4bull,},
+		{0x06cafc04f90e0d59ull,0x51614e7cac4425a8ull,0xac95962817a4db01ull,0x07429d273dc21b58ull,},
+	},
+	{
+		{0x7a41acd03cd54ca8ull,0x760f4f51d28a6a88ull,0x492cf0fea339cd3aull,0x09e2aec07d555a36ull,},
+		{0xfe2f6a7aeed354a0ull,0xdbdcf61419ce2260ull,0xc20bcfd9e198e665ull,0x1933efe63835a2c5ull,},
+		{0x0189d4b07861e3fbull,0x522cc302835aca3full,0x59d12d85e58b87b0ull,0x18e57eddf9b9583dull,},
+		{0x5b680089cafa43f0ull,0xd65eebad2b9d843dull,0xde29ef0c7e088dc6ull,0x0c9ab777ee413c7bull,},
+	},
+	{
+		{0x2de2541e40b0d660ull,0xa382ced25d3e7338ull,0xdad95c019603da04ull,0x0f5aaee566c64e6full,},
+		{0x3a613c2b2c1e5698ull,0x80ad95635614442full,0xcf2ad50ed935eeb8ull,0x19a56e2debaacf26ull,},
+		{0x977122652c46a843ull,0xb11e19d6d53210dcull,0x20725771f256dc73ull,0x1de5a5fc7a4394c0ull,},
+		{0x10d942c5fcc3151eull,0x9c6ebbfba17664dfull,0xe346ece8031e2482ull,0x21ac551aff896f1cull,},
+	},
+	{
+		{0x89d7fbe75eb91581ull,0xc7355a74ef7912e7ull,0x4e922b9392229a68ull,0x0eeae078d923103full,},
+		{0x4b7ae09cd7e884e5ull,0xfed64485fbe1dee4ull,0x19a45ea006c669efull,0x1e0ac3bc2a6b2395ull,},
+		{0x4a8c957781ebee96ull,0x4b0da0feeadef156ull,0xf04c167a2f332cf9ull,0x06382ca4c0f94c09ull,},
+		{0xfbe25c9b748f280dull,0x356eb63a011e10deull,0x323f8fe4b1b2f77cull,0x21d2b287487a565aull,},
+	},
+	{
+		{0x1f88a22cb993b511ull,0x427abdf0cae6ed5bull,0xbb7b6aa74e53a19eull,0x02de43f05ffec460ull,},
+		{0x40dcd405e6d395cfull,0x2b344825335f7042ull,0x1a436cc4d99c09b6ull,0x1d7389eabf4c2be2ull,},
+		{0xb47f58a0780daa9bull,0xbd547a5d8f113dffull,0x41e881fceb7601e2ull,0x0db64e6c5d5cacc7ull,},
+		{0xc46253d28384c7feull,0xad5f0d664a995b0bull,0xf707e763939264beull,0x2461c52f7a373aabull,},
+	},
+	{
+		{0x990ad01b9d8e2ff0ull,0xb59a4829befcb145ull,0x2b10c6d2ae313637ull,0x0b605902c6e61e29ull,},
+		{0xf29484bc2bc677b0ull,0x1514c3490c4867c6ull,0x0822e6538579c595ull,0x241f810ec123818bull,},
+		{0xac10d7576df11355ull,0xff4edc06adb0844full,0x73324a9a324978aeull,0x190720cbe53d3d6eull,},
+		{0x2fd0636e845a660bull,0x3088db86329f6294ull,0x82a0d71cd5f32cdaull,0x0edf878236dd765eull,},
+	},
+	{
+		{0x12f6e372fbd11a4bull,0xd34d22c784bd4cd9ull,0xfa8bc9e255d4f131ull,0x0bfe117ea31a0250ull,},
+		{0xaa010b07673bd25bull,0x00a0b1c68c819643ull,0x688e47961c0ebf5full,0x1aec2f4eee652535ull,},
+		{0xb029b876e21c869bull,0x7c12f3951c698089ull,0x71233403c66e7783ull,0x2152826c30307ea1ull,},
+		{0xaa5afdd56bde8fa1ull,0x9ed248272865201full,0x553f13acfad1276full,0x202ffd39a89adc1aull,},
+	},
+	{
+		{0x1ff2fb4efcdb8a36ull,0x3ec203194f50fba8ull,0x51323cfd19df8afeull,0x156ec362fef8aa30ull,},
+		{0x2c044a04072608e2ull,0x662df3d9e97917e6ull,0x348feb957564c7c6ull,0x1ee3023ed96aa98bull,},
+		{0x362583f2fe8a6136ull,0x89fb0c65615649e7ull,0xf36acbd09be49cb9ull,0x2303bfa75274509dull,},
+		{0x32986ea0eafbc4b9ull,0x14d27ff272b66280ull,0xe3a6c2a0ebd85c1dull,0x0bbad2db0ad115a6ull,},
+	},
+	{
+		{0x56cf91c5253e53edull,0xca8866a0877b1f6aull,0x38429f7da258ce8bull,0x06f95c527327ac41ull,},
+		{0xb72c43d012546504ull,0x12e3f0a702ccce05ull,0xebf4b60f64ad19c1ull,0x0bded49aa87188dbull,},
+		{0x87e5dd785b6e4d93ull,0x19417900131a63daull,0x7145d6b5a4979bc4ull,0x03bb33cf55d95809ull,},
+		{0x52000d33ed6efb11ull,0x8ce828f9cd47c3d7ull,0xd8f862fb72944bbaull,0x1c716818b924c07cull,},
+	},
+	{
+		{0xfefb620277c51698ull,0xd5604c7abc9f2aa1ull,0xf576e95d3567c80dull,0x1645ddd32c142ecaull,},
+		{0xdc9562c36200f5d9ull,0x3a76d74d5c4b37c1ull,0xf14d22b05a5e78b4ull,0x034c9ad776de7cf6ull,},
+		{0x34404956eee29c66ull,0xdf45d086b1226b1eull,0x3c414ef30145b67aull,0x04fddaeace8858d6ull,},
+		{0x1fe989de9b643029ull,0x54b213da80ea6995ull,0xb749bbc22220dc34ull,0x047b1820810681ccull,},
+	},
+	{
+		{0x780029781c1b973aull,0xc90c7f3bf3e4fbddull,0x33ddfe21bb2ac646ull,0x211a1034ff753345ull,},
+		{0xe9e34d59c3c29052ull,0x179578f512263f02ull,0x6c17f06adf9066faull,0x0212d6b381ef10a0ull,},
+		{0x2040aaa6428ea922ull,0x65c5f0444927f992ull,0x4e137ebe96232178ull,0x1bf44100b2e7287aull,},
+		{0x7c44805262f26abbull,0x52aa28d074951f3bull,0x2b8196dffb8865e1ull,0x113923e854a314e1ull,},
+	},
+	{
+		{0x7b7f582ef7892bedull,0xe76c3be71cc8870cull,0x9f8a51a9307fed05ull,0x10b8f9ecaa2c5f03ull,},
+		{0x4df3bb8c4d556670ull,0x81d3b4b1adea64f8ull,0x6674d8b41001b8deull,0x09ccdcb69ea57d05ull,},
+		{0x2ebadc5f2411e7c5ull,0xa149f1e423e9520dull,0x219feeb2042d7a6full,0x096e587f5c100db3ull,},
+		{0xd880a76067f520b9ull,0x9f10e230670c0944ull,0x5b8447f6a86f4909ull,0x22a05d15fed1c07aull,},
+	},
+	{
+		{0x235c4e4dd6146066ull,0xe2a28ff6d0d7d2f8ull,0x8fd729e833f16fd2ull,0x0c8f78f9e2ee71c7ull,},
+		{0x09531216f6db0e8aull,0xd2804e46be6a6febull,0x2dcfcb6bd149c11cull,0x148ed4ccb2ce7b9eull,},
+		{0xdf41e3a6c0c371a5ull,0x13bb6e8eb12d4cbeull,0xd274c9a4f0761e7full,0x1528b912dfeef2d0ull,},
+		{0x6a79dbf7f4d3847aull,0x4a33fd7d71bae4a0ull,0x9a45197ff639bbbaull,0x24df4fa277990dbfull,},
+	},
+	{
+		{0x249fbba8c7f32e60ull,0x4a821e31ad9e51d2ull,0xe58a5622cc0f0898ull,0x178f2d3e76028b50ull,},
+		{0x9cdf3d97bebc8585ull,0x41536b80c9ce2985ull,0x239aaf700d087064ull,0x124908455a36eb3cull,},
+		{0xf020d6187a91f260ull,0xd9b6ab247936733aull,0x41851dc124676383ull,0x1daf144fa722a425ull,},
+		{0x0649a9e32edb480eull,0xf5632d0ca45c2a99ull,0x3a2af261767bc395ull,0x14dd503fba140768ull,},
+	},
+	{
+		{0xc5c6e00fd17ab2f5ull,0x71e9fcbfe8b649b6ull,0xda17a4dbac8d28c1ull,0x05a98a1535f2a59cull,},
+		{0x83d4e94e5d9eb5e1ull,0x2518b3a223d4b1a1ull,0x09b7d7e0627b5dfdull,0x107ee631c141ed9full,},
+		{0xaa4cdf384ca63928ull,0xd90f105032b7c39aull,0x8f494d186e33a125ull,0x0c86d8bb0633882full,},
+		{0xcc7efc31cde134b0ull,0x405275ae3a903d74ull,0x1d2c31183fa09867ull,0x1c31b37fc0b69abaull,},
+	},
+	{
+		{0x26f06393a98d7e72ull,0xd7a49955aec38217ull,0xee059c0c27431ba9ull,0x1b0b6b5fcd51f50dull,},
+		{0xb96d93d2825f1126ull,0x34f4d4059606c315ull,0x77af034cba7350d1ull,0x1cf4fc4eafd00c46ull,},
+		{0x366f4596f757d61cull,0x5ad49a82ef14716cull,0x0c663d4492d4f974ull,0x091a84a857b6b711ull,},
+		{0x1f78b4489302a852ull,0x1b8cce6e9611b567ull,0xe7196cf560228794ull,0x23411226353ebbd8ull,},
+	},
+	{
+		{0x6a1128e3bd521f6cull,0x487d2f739adbb261ull,0x0828281f0e8cb799ull,0x04cac16c39c08420ull,},
+		{0x09e0a5658341ba28ull,0xb85ea4f19cecd348ull,0x4ea5a4ae1736becbull,0x1a4837d58d52bf2full,},
+		{0xa3928963389c947full,0xb8f057a9cc4ff4efull,0xaae0d55d3151b659ull,0x00191eb3b531fba9ull,},
+		{0x0a935bd98e804b96ull,0x95c2298dba09ac1bull,0xc3cc016c1f223537ull,0x188afa5477b2f80dull,},
+	},
+	{
+		{0x40a83f83a23e1b17ull,0x491bf066875037b8ull,0xdb2604f7c47dad90ull,0x1992cdb067a7112eull,},
+		{0x1664ddf026e4c292ull,0xeb829c71210ff72bull,0x3c7b7c4bf197ad52ull,0x17b23a613170be52ull,},
+		{0x2d247d9b007a05ffull,0x3688e8ce41a1649cull,0xc76b1ff5d3bdd11cull,0x0cb5c566b5724cc1ull,},
+		{0x3d47cdb7e8ad7045ull,0x805889b7d1e48160ull,0x46921df276da0cddull,0x1d8b09175b7ffa6cull,},
+	},
+	{
+		{0x2d93da253a866788ull,0x4b541d240a57f25dull,0x3d09736b713fa23bull,0x14bf46ad49d36c3eull,},
+		{0x29e1bb015d50655full,0xbe020d09318fec95ull,0xb56d91cab86a980cull,0x23336cc941942b4cull,},
+		{0xf4e0dffc8e8c7f6aull,0x311c69a9e4eecc7dull,0xace24b363ba5aecdull,0x21ffb3b23fd7f16aull,},
+		{0x435ce996bd8a0672ull,0x4215e87eb689c108ull,0xcae250c8f8f51865ull,0x013523eb8b76113full,},
+	},
+	{
+		{0xd4f7de4ca9d52df7ull,0x75fe647f5475085dull,0xf15da9f785e0c10eull,0x16ede9bb3c357309ull,},
+		{0xedc54654e3830270ull,0xf15105fed3c896e1ull,0x2cf837a1a3a7e9e2ull,0x1dd6dc94abf4654bull,},
+		{0x15881d7d4c0d2f18ull,0x01d72b388da8efbaull,0xd4ff54c88a1c2864ull,0x1ed094e14bdd6f56ull,},
+		{0x0158fcff83363762ull,0xa168db560631fcadull,0x97fa0a88ff59a3c7ull,0x0df05b6349c5389full,},
+	},
+	{
+		{0x2eb30351cc34ec65ull,0x808216602e947e2dull,0x84a3480ae6156356ull,0x1c980393271270cbull,},
+		{0xfc80821d461e9191ull,0x7a105dc20fad2eedull,0xaa74c1094436de42ull,0x04b36a435f3b5825ull,},
+		{0x4f6ed200472df18eull,0xe236440692515771ull,0x6e5eed3f9e4d932aull,0x091b5ffc0ee9f147ull,},
+		{0x7ce7a10ce283bfc1ull,0x9789fe6194b07f50ull,0x91ecc73152e06733ull,0x208b9d924be7dfb2ull,},
+	},
+	{
+		{0x2aa4986589b4de3eull,0xa729ade0b4126b94ull,0xb75d9d65103e2932ull,0x16056eaf22e12124ull,},
+		{0x570cd747a646200full,0xd903d6c3cd991054ull,0x37aa5a533484dbd1ull,0x0922054caacccfd6ull,},
+		{0x1af02876be2d3995ull,0xac1410fad65bf717ull,0x4e17a19a9d05970full,0x1382a3a3617089bfull,},
+		{0x6d1e2142669ee6e0ull,0x30d5c70cd9a908efull,0x2a9b125f53ae915cull,0x203c3f3897f6de0eull,},
+	},
+	{
+		{0x68040cacabdf4bf7ull,0x0eb42e3c5a5d94ceull,0x3d578534b6aaf16dull,0x12acb130dde8ce7cull,},
+		{0x680d7a29dbf3bdd1ull,0xed3052b70e65189cull,0x7610fb9fe5915edaull,0x20fcef537dce94b0ull,},
+		{0xe307d48210e5fb9aull,0xe7acdc073948e3a4ull,0x1bb35e85e630466aull,0x16cd6a2b314301c3ull,},
+		{0xa59fabf5eab13a23ull,0x6e2175f6f0993284ull,0x446dd812e2488b4dull,0x0fc456fe2da74053ull,},
+	},
+	{
+		{0x7c7fb2674c203cd4ull,0x55a1b9df3afc4a7full,0x9bf5e524c7d7f17bull,0x0b390959590a3d93ull,},
+		{0xab40ea927f63ad58ull,0x7ef86bceaffc8b56ull,0xaa1c8826c7f741f3ull,0x1c598f18e608b948ull,},
+		{0xe38fdc2890716f36ull,0xba4d19cf8ab6b80bull,0x6acb80a3b18ccd27ull,0x2078238128b85e76ull,},
+		{0xab39db3e122506ebull,0xbace52d6acd46e0eull,0x922def905344f7a8ull,0x1344ef6b7d7af528ull,},
+	},
+	{
+		{0x5d5c7abc3dd36511ull,0xbf937412f0b119b7ull,0x2746b08ae3dd3dadull,0x1177162da24d013aull,},
+		{0x35e00601ad90e632ull,0x9f3c9723b1acf874ull,0x9c050965da8f4d02ull,0x0a5401710c08f418ull,},
+		{0x2de719ace1ee9d56ull,0xb47cb8977ad356c6ull,0x308d29375b04a835ull,0x222d702f20d5c607ull,},
+		{0xa9d227fc0285e63full,0xf01485c204ef9f12ull,0xf5eecec40deb55f4ull,0x1e56f84469c406bcull,},
+	},
+	{
+		{0xcace982a7812acbcull,0xe84908aa0c953950ull,0xed4f00344f020fc4ull,0x188df6cb9eb856e8ull,},
+		{0x0b17b73757c759c0ull,0xe4265598446d3743ull,0xd3caa8e8b2ba46b8ull,0x1dede38418c20419ull,},
+		{0x7274e1281e48bc8bull,0x0a6a06ea6143e5fcull,0x3861b3d487fdcb70ull,0x1e02a2ab313785f1ull,},
+		{0xf6839fb679735a9full,0x21d61a0390e3b1fcull,0x04809da8fd4ef68bull,0x0cf7559d9e7d4f71ull,},
+	},
+	{
+		{0x911315c6d089eec0ull,0xaca30aec7f60f6bfull,0x4974695e82056553ull,0x25187ebd890d7e73ull,},
+		{0x49673d0b78ac765full,0x65d1d3b1db5d1cb4ull,0xa49a7c7ca51a2e43ull,0x053e67387a46ef80ull,},
+		{0xfc67638c119000d8ull,0x7a2184f56791b755ull,0xa877a11430eabf10ull,0x20f7c6c300d63587ull,},
+		{0xfcd6b6725afcb040ull,0x57d1003cb7c9a2d3ull,0xd2223a8d926a451aull,0x1d24f30e955cd333ull,},
+	},
+	{
+		{0x1b7b5b003f46be80ull,0x491bb660602349e8ull,0xfae1a444f2bb7966ull,0x01d23d3668f2972dull,},
+		{0x245ead9c19bbe76dull,0xc1c707f6793be61aull,0x85bf4f546abe3d4dull,0x148ebe8ca25c8632ull,},
+		{0xba59ad1d7888432bull,0x6cbe76392d71e10aull,0x0462514d2e56db47ull,0x1a6e10a9adc14711ull,},
+		{0x7efda3c43f74a6f9ull,0xad9c382e50d0cc2aull,0x7076e40da179ec93ull,0x008f3ed4f82fdf55ull,},
+	},
+	{
+		{0x858bcea09e781ad6ull,0xe7b825ccb166bd4bull,0xb9cfd04926519047ull,0x0c07797e4b3a6c74ull,},
+		{0x1e24b43536003081ull,0x27c1e31fbae9800eull,0xf3d7e7f13f85c1ceull,0x1e0a1cdd12e7d9e8ull,},
+		{0x473edfcc54c4310dull,0xcd263a28f09d4cc8ull,0xc4247f2e2245dcc4ull,0x03c04eaf9d75d1d5ull,},
+		{0xb85474807a25e89bull,0x0f4beb71d4cb5b78ull,0x0daeb85112108081ull,0x242d68f82ee4d8e0ull,},
+	},
+	{
+		{0x02fbaae021c7b212ull,0xeb16051348b8b639ull,0xba3d6ee93954bc8eull,0x0ea147f45a758bdbull,},
+		{0xe15a024a1a91d835ull,0xa9e2eac16a4f648bull,0x7626988f2bcb32f1ull,0x1e338feb3fac769bull,},
+		{0xd4f20e35a84b0c39ull,0x4fe2c2d4be392cccull,0x5dc58e1be257f8b7ull,0x1e7f5182842af533ull,},
+		{0x4fc3b07d8ae34d87ull,0x012e2ae922fe49f1ull,0x9fb1de8d4bc439f0ull,0x20fd48c3798dc8edull,},
+	},
+	{
+		{0x93d7d534f7ad86a0ull,0xbec5829b364c5a40ull,0x5eea8d7dc04d63e6ull,0x240066b801fc72e0ull,},
+		{0x28ec72b77e7f62afull,0xbe3803cfd5585111ull,0x59baa661b211d58aull,0x087045ae39f59a96ull,},
+		{0xddb8bf2a64f3051full,0x42c5e3e8ce0b7d20ull,0x486e162ef920e903ull,0x249c0512e33f511bull,},
+		{0x951ff3e665a64accull,0x44fec6b5463d5ae9ull,0xb9b71a5e57b8f822ull,0x20b9d066bd16c352ull,},
+	},
+	{
+		{0x855bfd13123a5170ull,0x9cb3157da254ec51ull,0xab9b395deea9cc7eull,0x07693fb623180e09ull,},
+		{0x1885e9ec39c1e28cull,0x3a8a6753d44151ddull,0x93ce6af309d2facaull,0x23aa2df0ee88c93eull,},
+		{0x3bad15262127d69aull,0xbcc54963b2d38b87ull,0x489ecbfd40614fc6ull,0x0a6ecd9d32ad3b48ull,},
+		{0xaa2508a1662d0f62ull,0xec3fb8ffd44be871ull,0x5b9ef2523d01618eull,0x0a3bb5e815ee9152ull,},
+	},
+	{
+		{0xea766df17f9d7ab6ull,0xc19c8d27ec4bf4baull,0xc6329f7ce2db81e2ull,0x071691e0718e6932ull,},
+		{0x11e670a023269db7ull,0x98886dea4b768160ull,0x72f45c39609e69aaull,0x028543ed1aa8dd87ull,},
+		{0x7ee2e31d7d634c78ull,0xf9cf24de74149b81ull,0x41fa71514eacb542ull,0x18d3a37740d3c962ull,},
+		{0xae78b245ae33af84ull,0x9369316572e34954ull,0xe4c93b843e295904ull,0x09b29cdbc9830e38ull,},
+	},
+	{
+		{0xe9244490f50cf569ull,0x8d970e8fb49bc65full,0x51916b784dafd89dull,0x0da0023769304f18ull,},
+		{0xd23b864d8a72ef44ull,0xf31bcf6f3d7106ebull,0x82d3519957404372ull,0x022be1bc62403949ull,},
+		{0x38b5ef80b069a28cull,0x495fb54d2b7ccf45ull,0x38c128fcaaf69ed5ull,0x2146275367d51f5full,},
+		{0x49b97c79ac13c18eull,0x30257093a02f5f4bull,0xf87b9fbb21072f64ull,0x06e0007ef73c5173ull,},
+	},
+	{
+		{0xa9ec1b8efdaf8745ull,0x4035e2ee3f34d774ull,0x23b921c142922e1bull,0x11e37f1f40216569ull,},
+		{0xed968193c7a5c636ull,0xf8192f1688470fb6ull,0x2d3c2f14c20f769eull,0x07700bb5dd3198c4ull,},
+		{0x28aa0d79f59e985eull,0xe5615a583dc522c5ull,0x04f79cc88756f709ull,0x119ee05116aaf3b9ull,},
+		{0x5f1e702cc44c6a1bull,0x8712b2ee8c8be1a1ull,0x753655c2ab2134ddull,0x24a3db2be7d7ebefull,},
+	},
+	{
+		{0x3e45255de9aa1bdeull,0xefbe0849de885dc3ull,0xd689b5764ab7c1bdull,0x080c5c466d6acd4full,},
+		{0xa60aa77d75149ec1ull,0xc3dd5c8fbaca0185ull,0x800608aed31b131eull,0x243c5841f5fec8c8ull,},
+		{0x0e7fce68a4baac87ull,0xdb4f841109b16da7ull,0xd66e5e1c454bc06dull,0x1e61df692322bf18ull,},
+		{0x68946a995a9940e1ull,0x2e03ae2720dbdb82ull,0x32c170fd0ce4acebull,0x1f98b6c333e83783ull,},
+	},
+	{
+		{0x9754471976fc08a8ull,0xc4870ba933c0f686ull,0xcfc322ff56953554ull,0x23ad69fa545939b8ull,},
+		{0xc60c2e3b15324118ull,0x01a58669fcdf18a0ull,0xaafc386f5228e423ull,0x14ba1d0058e5a449ull,},
+		{0xa32fca5f0379bc39ull,0x8d1c1d95da096c5cull,0x29d017974602166full,0x0d61d9cb973fffc7ull,},
+		{0xef117a3263242ad9ull,0xf78159e4eafc1b2full,0xf2fa33dcd8c2a8baull,0x175af89203905966ull,},
+	},
+	{
+		{0x6c0eded3b6a7a7b8ull,0xe51e3002bbaf8987ull,0x703192e69fa3c687ull,0x01a182f2184cc02full,},
+		{0x6ebf67b4c92d4056ull,0x75b68efb0209ababull,0x02fb46d0499d82c4ull,0x113116da046608bbull,},
+		{0x0699565476b1503full,0x34c45bb318022a57ull,0x26dccdd8effa112aull,0x1f40fc5a5752ebfaull,},
+		{0x45b9322b48eb2bc1ull,0xdeecfb307610e6d0ull,0x8eb16606deb36e20ull,0x08a327642ff515f1ull,},
+	},
+	{
+		{0xc813a456c504b8eeull,0x532f354bb8974ad0ull,0x93fe148d3129778eull,0x22a2f58c4a323890ull,},
+		{0x24d2d6476908f177ull,0x6e07954e774900d2ull,0x8b2c54daa9055f2dull,0x056abd33e4498156ull,},
+		{0x8a01a9b2585e7e77ull,0xd0d2bf12c3bffce1ull,0xb96ea293cb266edcull,0x0c098a81c417120cull,},
+		{0x4effb6b488226e65ull,0xb118449255f6096eull,0x6fa1840c070dd176ull,0x199e2bf35abb1910ull,},
+	},
+	{
+		{0xbd25b93b35887472ull,0xa4b092662a1af299ull,0xef6884f5360a28a2ull,0x00a12f852e8fbbcfull,},
+		{0xe82e43480cc8feadull,0xfa280e72ce69d0ceull,0xdfa4415122ea4a5bull,0x11e1d2b704f1f582ull,},
+		{0x853696bfff50ed5cull,0xa0f74bd1cc08663dull,0xc2f797096041de30ull,0x13cfcd1fbd9691ffull,},
+		{0x9d6ac8943715fefeull,0x3136a9e24236f9b0ull,0x7499485c95a72831ull,0x0e9c2e4fcde00c32ull,},
+	},
+	{
+		{0x39c62e6d335022ceull,0xe9c8db6e98544e44ull,0x6846f2349557b49bull,0x081c783c579ed8f1ull,},
+		{0x0076b5842bf1a65bull,0x5eab802511ebfe28ull,0x84774c9e193b9d8bull,0x23ac08e729e26b60ull,},
+		{0x736063a00b892564ull,0xd8c5544aaf1592c7ull,0x11f40722e8214721ull,0x160a33199c8d138dull,},
+		{0x016230065908b500ull,0xd9e1caeadfe23744ull,0x002c050ff0174904ull,0x0dc7ba5bf53108dcull,},
+	},
+	{
+		{0xf09726d0d546675eull,0x1b4d45e7a1820cafull,0xb7445f3094bd1289ull,0x0d890688fcc60f13ull,},
+		{0xd1f56b1c0a744a0full,0xf0c62ae34ec690ecull,0x45faadf61df3bb25ull,0x18c2fd6cc639067full,},
+		{0x3495ead0ab1306b8ull,0x9533755b554af28eull,0x76c38791c0fc60cbull,0x024c6f33c3f1b494ull,},
+		{0xf6495c42761c217full,0x8c9399eeaa9d34a4ull,0xdd6711f796147aacull,0x1999fa33be07e3e1ull,},
+	},
+	{
+		{0xecb58f0f317450edull,0xcbec5f2960239867ull,0xdd7ac70ee3249e25ull,0x1599eccaefa03182ull,},
+		{0x7d8899809e24fb78ull,0x5ad943e7cfe403d6ull,0xd7629533aa10a48bull,0x060bb74fb5396a58ull,},
+		{0x4bd06469abffca0dull,0x3a5a7789159f2585ull,0x9f971b85ada64df0ull,0x03ea334be9be5c9dull,},
+		{0xd485189d38eeb123ull,0x340c5dcb78fee5f1ull,0x7f60baa4e3c4a9bdull,0x021a0d46d3c20e42ull,},
+	},
+	{
+		{0x8b987c8a3b490351ull,0x58c74f82f737b11bull,0x5903253636471a05ull,0x2122c2e7f9b860b8ull,},
+		{0x9b0db1ee822d6254ull,0xc0b40770ce5e9f2aull,0xba4abd6a88f7a767ull,0x0df1971444c6ade1ull,},
+		{0x7703c63ca5507b42ull,0x5605506722d35d45ull,0x03f2b184f3f0fb82ull,0x1306223415b8a017ull,},
+		{0x764e8cacce666930ull,0x296350022538db74ull,0x6042799c69b05c31ull,0x0005e75b8f4da22eull,},
+	},
+	{
+		{0x5df2318101c833fdull,0xfecf6ab645adf556ull,0x5f3f96a4495cfd2full,0x21c2effff7b94ceaull,},
+		{0xa6e7442c9d7a8738ull,0x9bf02ea314bf3d4bull,0x58a18dca551df1aaull,0x197f7acfc04eb193ull,},
+		{0x58d619766ac57b91ull,0x67ebe311b55048d1ull,0xbe08c1018cb15f0bull,0x0ca2af20db75a2e4ull,},
+		{0x9e47a967f5d02b56ull,0xe40a9756ed1b402eull,0x067745dd54042bffull,0x01c518f7dc60db80ull,},
+	},
+	{
+		{0x5359a1da9db188c9ull,0x1c78ad5cdd37a5a1ull,0x0573217d49814d20ull,0x0d859190a8436253ull,},
+		{0x699f61b3edae239aull,0xa6f2666312a54f10ull,0x2fcbec20188c6144ull,0x18ed1fc8f4fa709aull,},
+		{0xd990fa55c76e07edull,0x70aabddfc9400d63ull,0xb1bbf675285761feull,0x0e692b7086d4abfdull,},
+		{0x83e19470d300d9c7ull,0x5e8055726d388fb4ull,0xe7360d853f1a5120ull,0x0ad8472143837e0aull,},
+	},
+	{
+		{0xfa4c3a0c23f8cff9ull,0xe9ac1bae349a643eull,0x4ed066c5e443066eull,0x1a7dd8278d346c6dull,},
+		{0xa54b3f9c717b374dull,0x6faeee33d2d90b04ull,0xba5f784dda70161bull,0x1cbc3f8f6b6a48eaull,},
+		{0xe8a406b375a4b73aull,0xdcf0c3a3e801c4e8ull,0x9912abc296945681ull,0x2483261d5b5b5a77ull,},
+		{0x9b93327940db2f43ull,0xce46155c18dcbc63ull,0x3d052360ca92ca17ull,0x1fb99ba1a9114550ull,},
+	},
+	{
+		{0xb5fd77f540aace77ull,0x044364063fa2caffull,0xe7873cbedc9f0030ull,0x24501adb58be9749ull,},
+		{0x47b538c10415ab02ull,0x84c7e77ff876a876ull,0x3fae6c44d60d3074ull,0x160ddadb78b6202full,},
+		{0xdc6325824a679ad4ull,0x12dee70c79c348eeull,0x654468a71dd01cf1ull,0x0e4602c442538d6dull,},
+		{0x5c24bd1add2a2186ull,0x3a680ab34b78fe65ull,0x3da22259e482f0d1ull,0x00551316cf3aab35ull,},
+	},
+	{
+		{0xcb4bc7daf8be6006ull,0x252a623243a4ef64ull,0x54bb96dd79c759ceull,0x1c524d3b5bbc19c7ull,},
+		{0xc0ca82389048a95aull,0x15e5b1a8dcced81dull,0x5167d0b211840a7full,0x128e507a812b71e7ull,},
+		{0x17a44e3e6d7d86a2ull,0x72e1df750cfebda7ull,0x29f68054a4e20ee8ull,0x000333237d5d27c9ull,},
+		{0x320cff20120511cfull,0x57db513d6d08817eull,0x54559b085edb799dull,0x0e61920cba294df6ull,},
+	},
+	{
+		{0x1357ff236de15e50ull,0xc554b4ef66f155d2ull,0xafc26357a0141fddull,0x14c7b670a0716ad8ull,},
+		{0x07d38074c86630fbull,0x7be1b0ff78e742b0ull,0xf54c172577f0b9edull,0x0c12b01a0dda5da1ull,},
+		{0x68e3f1300e600f95ull,0x4d709448139832d4ull,0xca4a8a8b21f98fbeull,0x11a3706c5a498367ull,},
+		{0x01d81ce86eee177dull,0x520c07d70c130147ull,0xff3dfb3c501e8275ull,0x160c52d7519abb5full,},
+	},
+	{
+		{0x9a8bbbff28c670a1ull,0xfc49255c356eeebeull,0xa347ceefdc1ba0b7ull,0x232e6d1088bd4630ull,},
+		{0x65f41e10dea429cfull,0x29447401fbdb3b6eull,0x27a98db9761cd8eeull,0x11f37343e4c314e1ull,},
+		{0x7470e9d1820ad791ull,0x61bcf220ea58eca5ull,0xf2716ef934ea77d9ull,0x16edbcc2c0385a5full,},
+		{0x834f2150c024301dull,0x47dd105e70e25b77ull,0xec1d07e74389501full,0x10f475ccee01d346ull,},
+	},
+	{
+		{0x13d7b1c903fbee28ull,0xbdce35db48d29b85ull,0x131a43549c7fba44ull,0x131132a3c45ce4f0ull,},
+		{0x4445da023925491dull,0x03f0df7ccfd655a5ull,0x60fee98a6e70c948ull,0x1f7caa4e2feeb2dcull,},
+		{0x9526a08c530a6909ull,0x84409c315ffc209cull,0x59736a0cc8438f5aull,0x1e4934f502ee610eull,},
+		{0xc8e6b95279167ccfull,0xdc7b6b3c567a1229ull,0x2e9b566d115ec5adull,0x0d15618c6b8e9fc9ull,},
+	},
+	{
+		{0xf6bcc9b0772c5f01ull,0x09886edbf1bd46c2ull,0x466f85180158cf07ull,0x1d6105768850401bull,},
+		{0x55768ad078f503b0ull,0xfacdfa1f52e8932eull,0xe0477fa24dd0988bull,0x117bd4d941a2267full,},
+		{0x3914f400684d2917ull,0x28507ec8df21440full,0x7d892b33799a868aull,0x18caeead79cddeceull,},
+		{0x296d96bf4e575b9dull,0x780ca2e50441bc83ull,0x06d891a1447b91d2ull,0x23700edcd5faff2full,},
+	},
+	{
+		{0x4f8387d286e0a583ull,0xd1ddca521debe64full,0xbd24acb482fd9465ull,0x03736eab77f4d1e7ull,},
+		{0xe31e13f78ad3bb1aull,0xce06bd4c3cea2bfaull,0x31132e479d528bc2ull,0x247b4c2b7f1aad5cull,},
+		{0x030908ad1b15d138ull,0x7bd2b99cfde78771ull,0xf655dfae8265e891ull,0x10bb4e289591a9d6ull,},
+		{0xd67ab6916b33f086ull,0xdb38647f6adc31f0ull,0xed1451d8dd0c7615ull,0x0edda4ccb1e3eadfull,},
+	},
+	{
+		{0xcb33e3cf96b81659ull,0x172c0f00bb48edbdull,0xcf30f6026fe581f8ull,0x12da5a42cb6516e2ull,},
+		{0xca62a5872d3e1206ull,0x0346408c0757c3d0ull,0x617557bd055dc755ull,0x20f1480f18481d11ull,},
+		{0x86513d39e5c274b5ull,0x42e8a046438466d4ull,0x1c73f6bbc7b60b33ull,0x0fd063c7ff0d880eull,},
+		{0x789ac9c2f765e06bull,0x4d26ede0b3059bd0ull,0x349fe503449827cbull,0x207f871c49630976ull,},
+	},
+	{
+		{0x3d7dae09311e6772ull,0x6144aa4a7c81f5b5ull,0x5855fc72ace89a6cull,0x0baf23e64838bd81ull,},
+		{0x5b6b24170866f531ull,0xb03b66b50a5bebe0ull,0x59adab14ed27f760ull,0x230bbceec583f8d6ull,},
+		{0x45d3cbf3a8842577ull,0xa0f50520b782e7e5ull,0x2d6746485fa3c169ull,0x03cf5a410b34c8a5ull,},
+		{0x02c196a23762a184ull,0xb80d8236af50024aull,0x4445f5d3331b423full,0x07e990b7be024731ull,},
+	},
+	{
+		{0xaf64cf6707920064ull,0x5761c39771cb6c47ull,0x5f3e8a48e7648412ull,0x005dfbd1cc2dc43eull,},
+		{0x041a7bf190186079ull,0x4008374c9094fe68ull,0x06cdc2baf314decdull,0x21caf8a33df246d3ull,},
+		{0xb854382fabed3b00ull,0x5887acf6a6174c08ull,0xd5e1f9f91492261cull,0x087c6c9aefcf74c2ull,},
+		{0x2cd2d61341fddf3full,0x25c29af430089db3ull,0xa5528f8297e074f6ull,0x0a2e3ff9b2625fc6ull,},
+	},
+	{
+		{0x40b4d3f6fcd9ef63ull,0xd5dd49c943d60a11ull,0xc9020a5c88db318bull,0x0cb8372028cd176cull,},
+		{0x54285030f3575be3ull,0x161b8df00d6a954dull,0x1898772f461a7cacull,0x12eea333d14c3442ull,},
+		{0x2a82fe4a74b0a804ull,0x0cdbe9effef2e583ull,0x1d5b13c9a668bef8ull,0x01c214a06d264d5full,},
+		{0x2e23b563a827c1c0ull,0x5b8b2c7a14be1883ull,0x6860a6bb60d97c37ull,0x23f7076ef5379f74ull,},
+	},
+	{
+		{0xe34a814a44280094ull,0xcfe8a52bb7b73829ull,0x345d9454a2565a7eull,0x0c6b7b7a6f6f7217ull,},
+		{0x2138485e80f9e99bull,0xc42eaf0de9c10797ull,0x32277b571bf7888dull,0x17e1434e18df7916ull,},
+		{0x463449af55f7d356ull,0x1bc5c6a5986cc971ull,0x26e9ce32f675776dull,0x1c312c43cfcc8e12ull,},
+		{0x7c6e1715ca76fa46ull,0xa071d2ebd5c26d15ull,0x0d528ab7ba29abf0ull,0x044a0b839ba61fdaull,},
+	},
+	{
+		{0xe7c5c72c7d916057ull,0x5feb9d7b28ab0a66ull,0x769f6b1594c805b5ull,0x16443b1bf22af131ull,},
+		{0xd395f5225c28ca87ull,0x3e024fd731a29fe5ull,0x0ec2577c98b21de8ull,0x0d5a988002223673ull,},
+		{0xdd6a5797d0adc657ull,0x7175778169d082c1ull,0x49d223a70f026e29ull,0x081a19f468c800ccull,},
+		{0xfdc7acd4c5c6fce8ull,0x0977ef6df9b9d09bull,0xf48328e59e7248d4ull,0x17413c8cc10530e6ull,},
+	},
+	{
+		{0xcecc5b24fc3cf531ull,0x58d1634746c05831ull,0x89ad30cc3d783002ull,0x0c2c482d300e9fd9ull,},
+		{0x50d85bca3e29ac94ull,0x4740c664b7c8c43dull,0x9da073fa9a330262ull,0x00620100a53af738ull,},
+		{0xb0d02448b933e042ull,0x6918e41ae345eee7ull,0x1623a66ee9b1ae1bull,0x202a39c93ff21dabull,},
+		{0xba705bd0523d8c43ull,0x1a1cf7d7091661daull,0xb28974a8c3b33926ull,0x2230a8916dbc65fcull,},
+	},
+	{
+		{0x5909ba89ed4e3011ull,0xcae8a4d5d54ce260ull,0x0f4359ec8b7f368eull,0x19a4c99d6e4a3220ull,},
+		{0x412d284bc10d802aull,0xee1086b762b3db8eull,0x633ec3f498175e4aull,0x19cf7245c251b1acull,},
+		{0x95522bc5232eb322ull,0x324bcef21d038389ull,0x4ed78c397378fbbfull,0x188cf273fe92022dull,},
+		{0x0fe280608a7ee5d4ull,0x670c3883f508061cull,0x13a0b04e77af114eull,0x198efe92ae4d0ae6ull,},
+	},
+	{
+		{0x102b432e3223ef6bull,0x4f69f5c79341180aull,0xac7425e3d14268d4ull,0x03f707e7e57f9425ull,},
+		{0xac628d252944fef6ull,0x6df7505399d37fa7ull,0x86636dbefd6b65e5ull,0x118ef52e3e6fe751ull,},
+		{0xad9c45bd9459e600ull,0xbe08dbc89f9056e4ull,0x7707b36c6402da33ull,0x00e1e75f1f7ae000ull,},
+		{0xa79f45d63bee770eull,0x6f8c1c6982bb0a91ull,0x6462c3592e33a1a3ull,0x1067b18c6bbd98f9ull,},
+	},
+	{
+		{0x680eb9a0fce9fa8cull,0x1c6d52eec0b4660dull,0x525bc2ae8c8e988aull,0x043a8ded59ca0d1aull,},
+		{0x5df2d697ac2ca905ull,0x16962d2eaa7313f2ull,0xd7872b7326afd743ull,0x0c821f3c43a3b830ull,},
+		{0x26cf89a0192e3654ull,0xe02aeea761a27c42ull,0x47f96addca2cd985ull,0x02eb6e048914c470ull,},
+		{0xcb894e0b4e37d341ull,0xb11c71d78e37d3c4ull,0xd34dee60bfccff36ull,0x06c85c74b1acde14ull,},
+	},
+	{
+		{0xaa548b24b6c55114ull,0x004f633dbf191368ull,0xb2e00f95162957b2ull,0x147dbc477db1e84full,},
+		{0x4faffde86e7b765dull,0x45284f38ad028244ull,0x7eb0f09c211eea1dull,0x0049c2ca7fdf6511ull,},
+		{0x7969af21c06c2aa0ull,0xeb75f8c3464966e2ull,0x347f14df3a59989full,0x0014a420ed3be9a3ull,},
+		{0xa4dc4818a50e6281ull,0x2bafecb386f61d30ull,0x50920a4a22e77120ull,0x0ee09fdc99933caaull,},
+	},
+	{
+		{0x980b53a5808b58b0ull,0x96a0daef430c5d10ull,0x0e6af494bf43546aull,0x061b2381c4a5295dull,},
+		{0x713fc22873cde83aull,0x2a080b2b06211e66ull,0xcf86c35e3a54c805ull,0x0d7d714996e67679ull,},
+		{0xe49ba3a6ff5dae5cull,0x7f33cd86feba787eull,0xc1dd30a372c4b19full,0x14b0404914f96c13ull,},
+		{0x7d80404cf33bb120ull,0xc12d3203752189f2ull,0x533c80943cadbe9bull,0x1c5e398db4ffa0b9ull,},
+	},
+	{
+		{0x9f3aa1b4d43cb999ull,0x340efd7f25101949ull,0x25ebb23a72c9c5baull,0x1915069e172cda7cull,},
+		{0x2de97b389f87f886ull,0x9a2e3f58a3015797ull,0x8f5c12e106e732d2ull,0x037469ee793e75efull,},
+		{0x5b193b5ab9747d3full,0x156596cf6ff7fb3eull,0x76766e0d7881903eull,0x1adba75f7c2727eeull,},
+		{0x75dbfbb190769e4eull,0xba89a5a9f1c3a748ull,0x20b740c6e1481a6dull,0x1e0b6b7aa5ca38e4ull,},
+	},
+	{
+		{0x5ff4cbbd74f1b5b3ull,0x1a5c03ff316edf5cull,0xa70d27f6832296f3ull,0x194eb0611394ec98ull,},
+		{0x6a08fe623206676bull,0xd579741b89441bd2ull,0xc5ecd5cfb2b6756cull,0x022d3a02dfa0053full,},
+		{0x1140e17097922e6bull,0x621ad1a40c7ce6f2ull,0xcce907352667f97dull,0x19c526f47e7b2042ull,},
+		{0x95bdf774581de605ull,0x59f75c60ffcf508cull,0xb53dc47883b56c1aull,0x01fc123ba315101dull,},
+	},
+	{
+		{0x78462d8d7ab18b25ull,0x14824626499a678aull,0x436b7e48a2008081ull,0x1cc480bf6fcae773ull,},
+		{0x5810ad458ad7438dull,0x357c566d0e5bd5deull,0x47373cc68115b887ull,0x10ea6b5318c9da36ull,},
+		{0x200ab2d356d3358eull,0x5c64b7bebd4a022dull,0xa7c35ad9a7a577eaull,0x101718fc526a3677ull,},
+		{0x1c04f36307bc27f6ull,0xb234e17e2b136930ull,0x74b841432bea31adull,0x0050f1b7c4147073ull,},
+	},
+	{
+		{0x2ea235fa6477907aull,0xc5684d08e3974d89ull,0xb9f276d2643567fdull,0x17d2409022d0ba7aull,},
+		{0x8f1e208fa87a6d30ull,0x4f41058442b6197eull,0xd4c36d9bd21f824bull,0x1634f53029cfc5a5ull,},
+		{0xcc41ab9b90abf2fcull,0x553597edae94247aull,0x4ad086273e4a31d2ull,0x0877ee2c48cc0f97ull,},
+		{0xd80be21edaac4830ull,0x99e08f25ae862183ull,0x2760b23576d7b08aull,0x11e9b8f97f7cc3d0ull,},
+	},
+	{
+		{0x94bdb7f9cc4c203cull,0xc085757ea527679eull,0xa4913d058af7facfull,0x19cdf38691762bdeull,},
+		{0x27a1eb00913d1f35ull,0x40ded4da94d0d150ull,0x04571fc2c0488cfaull,0x1c98f361d3f6bffeull,},
+		{0x0eadfb0acffa4304ull,0x271389b4b3a3d38cull,0x02d374b0eeb8745bull,0x17459f94a75f9d0cull,},
+		{0x87f5d8441b7e1309ull,0xb456a3ed9bbd6888ull,0xeec8d2085ede9fe3ull,0x0facf5f7a831508eull,},
+	},
+	{
+		{0xbeb5f910911021f1ull,0xb8769e903c8b867full,0x1478e339b9cb2fd1ull,0x099634fb937b00f8ull,},
+		{0x56f5b03cf4d73701ull,0xef84bda0293b6e61ull,0xdcebb03f7bd43e65ull,0x007909759bb4a3aaull,},
+		{0x5a9986ae7a9c61b7ull,0x1ae4b163ec6a6a4eull,0x4dfcd48ed1f151cbull,0x094aae59f4e71958ull,},
+		{0x3b3e7f1b926ec702ull,0x1bc892e08f29547aull,0x92b962a74aa8b27full,0x0bffffa89dd51ee3ull,},
+	},
+	{
+		{0x6cc90defc47c86e7ull,0x2f9bb3d9727446e2ull,0x39bf312cb3c44625ull,0x23bec2d51f78658dull,},
+		{0x0f50756059649dd5ull,0x86bd3387a65c263full,0x47e156347e866e63ull,0x23a5e01551e5724dull,},
+		{0xee9be410a9d4177bull,0xbbe0972c861d46f0ull,0x91b59b1a87e8de44ull,0x22f5c569b87c6991ull,},
+		{0xce9e89d00521892cull,0x263f7a1d27d4b46dull,0x45d31fc3dc750edaull,0x14e42232f0128c02ull,},
+	},
+	{
+		{0x500b9fece0809a07ull,0xf5a76896cc270b8full,0xb85ae5b0d44a141full,0x135912aba1961736ull,},
+		{0xbc6ea74cf2dfc425ull,0xab8a32061c74dba2ull,0x20fffb17c71ff64dull,0x13618dd823e3dfc3ull,},
+		{0x2c83de06630dff7cull,0x0c4896883bf36e55ull,0xa7313f518a0f2bffull,0x2025d1d9c20800c6ull,},
+		{0x34b0498fb816b692ull,0x10bfe6eabe6f0a2full,0x1c56bb41b0dd4d74ull,0x0334a4eba5d56574ull,},
+	},
+	{
+		{0xad5bc42490d95c93ull,0xd24688159f80bba6ull,0x51db9caf236aecbdull,0x147a7dbc4b7411a9ull,},
+		{0xb5393310a797cbaaull,0x739de1e05a56efb1ull,0xe7d785f0a8e78f28ull,0x1f7a9fe509d5b19dull,},
+		{0xcd1c7007c02c3ee1ull,0xcca073c12fc1d057ull,0x6e8cf15a37759d85ull,0x0b1479afa40c037eull,},
+		{0xda1e295d88480ab8ull,0x682f73bd4e744e6full,0x2369fb88f8d4e19dull,0x1129d70aa8aecc19ull,},
+	},
+	{
+		{0x9e7ae3fe254e256eull,0x12d4370a7bcf6abfull,0xaf83c6a4bf988260ull,0x0f65de6869fc0957ull,},
+		{0xacb41d12a633961bull,0xc2a9a1cf920db7bbull,0xc2821fef240565caull,0x1109c5570d163309ull,},
+		{0xe9d1fc23515993a6ull,0x15a24910f27c67f6ull,0x496dbeec72e3bfffull,0x24733db7f4272e5dull,},
+		{0xcdb55cdf7907646cull,0xa1c54853eb7dfc81ull,0xea571636a8ffb14bull,0x06a5b6079370bab6ull,},
+	},
+	{
+		{0x97a2abcdf358d3a5ull,0x420cbc375c21dddbull,0x41fb06bd7054caccull,0x09bd6505a914555cull,},
+		{0xf15b28a4b4bfa383ull,0xa99e22f61dea99b5ull,0xc5876da64a7ee070ull,0x028999b35359dde7ull,},
+		{0x9ad1317e8e60f900ull,0xa890d6161a981864ull,0x52f6f908d2159ae2ull,0x02556152e1f4efbeull,},
+		{0x265aa028e345793eull,0xa28cb5f3a39df8d8ull,0x079f594221dcd89dull,0x1defeb67a3fcfbbaull,},
+	},
+	{
+		{0xb5cc244f5a9f03cbull,0x6baead8bc6570d45ull,0x6d1e76ea847eabc9ull,0x0dce307abc182ad1ull,},
+		{0x3283d782c6cd63edull,0xb9af2831b795b981ull,0x4ea6c4c94b226693ull,0x086b2e9ab1d077c2ull,},
+		{0xf5c4ca231bd295f4ull,0xbca27edf03daa525ull,0x0362d7164996202bull,0x09907a377cc9fce4ull,},
+		{0x7b60d234bca94c31ull,0x5cc7b5721475846eull,0x921a27f84876df44ull,0x06f4131d7ba6f84eull,},
+	},
+	{
+		{0x46152568fcc0ed81ull,0x3a63a85eead094bcull,0x11070da9585ede25ull,0x12ff6b16c2f48322ull,},
+		{0xea844d654f859907ull,0x6838a6b4e0b4006bull,0x2b41ef4212327114ull,0x204a2d3955141ec3ull,},
+		{0x9f2c358d1b2457e1ull,0x93af7d7ceeaee3eeull,0xc86a7598c117cd91ull,0x1056e2439d4195b5ull,},
+		{0x473e1c43e906904aull,0x6e8fb4d7f44591d2ull,0x1ff116f0961089b4ull,0x11394c28c26d1b0bull,},
+	},
+	{
+		{0xd253f6ac43f5c4d6ull,0x422044504e5405beull,0x26ab442d40a084d8ull,0x02660ef3880ecfb1ull,},
+		{0xbd87dd782fe428bfull,0xb2ef75e3aa4c74a6ull,0x5891d0210f5774b5ull,0x09abb479b371f234ull,},
+		{0x133283389bc2b2f9ull,0xcf344ed2f8be1bdaull,0x9a847dc611fa0cb7ull,0x0a9eedd3f95c958cull,},
+		{0xaf8e504219b0433bull,0x98685d6a1f049836ull,0xd528076bab61e1adull,0x13056b415e616aadull,},
+	},
+	{
+		{0x49583f0f7f230c4cull,0xff39b21d343be5d1ull,0xfbefad64ef09befbull,0x24cb4f5893d4bac5ull,},
+		{0x8d4ddd9369ccb24aull,0xc132bc119713a546ull,0xea56f31b67bea15eull,0x0f23349717c9b6c5ull,},
+		{0x4e16be6cdb1489e7ull,0xbaefdb24f1adc9d1ull,0x8bd11d846d3cd91aull,0x18e6578a202dcd41ull,},
+		{0xd860e13f7ecde8f5ull,0xc126ea32505c977eull,0xd7ac0f10c979a80bull,0x1a872cb2f9a8d331ull,},
+	},
+	{
+		{0x0f132cf16549c284ull,0x19e09f48ba261c8dull,0x0f4c7da826d42e8full,0x1d254c7e1814adc7ull,},
+		{0xb451d98521f1e338ull,0x00c3ee04c33a1232ull,0x91b899766b978552ull,0x06c39cdecb23c001ull,},
+		{0xb483138dcfd3ae7cull,0x53ae2db29442cd02ull,0x118c8fd7eb40bfe2ull,0x2196703e6faa2a4aull,},
+		{0xa8de47168d048323ull,0x1d1c785eafe2ba86ull,0x7fd6748672e5a35dull,0x1341317ef16f4c5cull,},
+	},
+	{
+		{0xa355e41f4d7007d6ull,0xc4ee14792d18a31eull,0x716a277b2d26c87aull,0x0e497c158a0d084cull,},
+		{0x739f71f6364ffa44ull,0x192478ba62ddd0eaull,0x81dc24cc81233293ull,0x00bb360c741795c6ull,},
+		{0xa36e50f278dcd251ull,0xa6bceb69cd30267full,0xb3c103008c09df10ull,0x07cb95f5512f403aull,},
+		{0x28ccffc59eee29efull,0x7e7f6fd31d1947afull,0x44d63fcccd5a6baaull,0x01ccf53ae9b7de8cull,},
+	},
+	{
+		{0xc3bc34b55033fb52ull,0x7ed6d30d117cf749ull,0x73de3aa928adbc56ull,0x086b6f23a1a2fb56ull,},
+		{0xea07593c995a2092ull,0x1d95702fcfc1e78eull,0xd0ce3acd5d614a77ull,0x0dcc6452f8b5e882ull,},
+		{0x73118db97bb259d2ull,0x4a84665a80599a35ull,0x1c30c101fd9ecf82ull,0x0d7885f460e194ccull,},
+		{0x99dd08bff865467cull,0xd68738a0156857deull,0x6f5077aca7b73306ull,0x04bcc62d52fa7471ull,},
+	},
+	{
+		{0x48da6b79218bd04bull,0xed2bce19327a82c7ull,0x6b74e4fd4fa92116ull,0x02c0651ba1e813b9ull,},
+		{0xf0ad9297742a4236ull,0xa2914a46786b70a5ull,0x2386da7aab70bb1aull,0x03151992a17c5367ull,},
+		{0x7aa289a8e9fa823full,0x7b38d4ab2e49fdf7ull,0xaab7bdbf2b429292ull,0x0b2aab265693445aull,},
+		{0x3be1fded2e998879ull,0x8240edb6b386ac33ull,0x4fb5336ba1f898c1ull,0x061ed23c8f8e84a3ull,},
+	},
+	{
+		{0x7145f84981efbcb7ull,0xf497db10a4f4904cull,0xaf9fd1ec8af6a8bfull,0x20165456955dc19eull,},
+		{0x7282d6f515dabd17ull,0xa3553a12d68d1ae2ull,0x792d9334a3a442f3ull,0x21feb9b8b3ea56a5ull,},
+		{0xaf4680ffd9c4a53cull,0x0e71c1b8dc018169ull,0x641699a8c9416de5ull,0x10d5dccdc3161910ull,},
+		{0x72d320ec66cf7258ull,0xcbdba9123f8a2731ull,0xa55ef5f8bfcf3676ull,0x0988da1be13b47e9ull,},
+	},
+	{
+		{0xea95f574e1ea26dbull,0x2fffa0ff5f4a3e1dull,0x78d36030cfc5a82eull,0x21cb66ac76b5527eull,},
+		{0x84718489a96516faull,0x92855c9b51f6b390ull,0xeee05bc11a1803f6ull,0x2092ec17bfd5de32ull,},
+		{0x1fa0e7106718c976ull,0x425f42118ff863e6ull,0x13651a84747d9cdcull,0x17dbd78bca975fe5ull,},
+		{0x9721ef19a7413797ull,0x4a80fc10b00bca94ull,0x1e9f4c0c24cef6a4ull,0x0d99506b4dfe2776ull,},
+	},
+	{
+		{0xee0220b75d93b649ull,0x31fe81a7cd09a014ull,0x9181c6f78e9516f6ull,0x2448015dcaaa703bull,},
+		{0x5ed72fe48d02c6b9ull,0xd042e2d02a5b89b4ull,0xff1ddb8dd4e59ae9ull,0x10a48edf90259fbfull,},
+		{0x74e8c7d41e003d9aull,0xca1074ca94039b16ull,0x52f4bf5cd28bafbcull,0x0e128cfa10482b71ull,},
+		{0xccc092eb929c469aull,0x4e3f358df0eea015ull,0xf4f3374e063cd196ull,0x1809d1fe690303e8ull,},
+	},
+	{
+		{0xf3ef86ed028c4745ull,0x0a44b97639c08409ull,0x38499e20b5896611ull,0x13d994b120bef2bcull,},
+		{0x250a215282c8d19bull,0x5bbbb25159e45c8aull,0x95a2c6b641a973b0ull,0x07fdd2dac9a6d7e6ull,},
+		{0x0a3402b6cd274049ull,0xe703742befd67bbfull,0xf8713abbc826be9full,0x107c23eae657e4a8ull,},
+		{0xdf01e7ec05e0cab4ull,0x5ba6f950ae4aba56ull,0xbf3e8a074154a933ull,0x02033530cf6f318cull,},
+	},
+	{
+		{0x1e42a02c69ecec65ull,0x1cfe4f386399a2edull,0x391cf4d99a0f8d43ull,0x0280c6a52d30887aull,},
+		{0x9f5e4859b607ef03ull,0x5aa94f5ff9e05b70ull,0x5e8a5ef7b0b1d8baull,0x14cd6fbef735ece1ull,},
+		{0x91c4a7946adda2e5ull,0x3131ec263b429113ull,0xabb19a057351c369ull,0x18637e706c2b90a8ull,},
+		{0x9c4eb0d6ab61b1baull,0x81bff5468f87b897ull,0x1b64aff158471fbfull,0x0f90eb74af988e57ull,},
+	},
+	{
+		{0x00e894e4b6d65a98ull,0x4c8ef96ed42394f4ull,0xb1f8ef40a15af72aull,0x10cd840180e93e6cull,},
+		{0x0870e89397ffefdcull,0x1f25888a505f941dull,0x2337f1297e3576a0ull,0x03eeb64b42f21ac3ull,},
+		{0x7c43219de2e300a3ull,0xd775559b60e33914ull,0xae2eec292c6f2e2eull,0x05c1ec340e6017bdull,},
+		{0xfca098f76abf1584ull,0x5ddda8b24e0dc09eull,0xb5f39f6c3ac64747ull,0x0ac2796805627f60ull,},
+	},
+	{
+		{0x6f6fe4a5d254a076ull,0xd0eeefb38fa96beaull,0x488d689b8bc3e68full,0x04996c5a4c20dc7dull,},
+		{0x179b5ebfbd3fdc60ull,0xbbc7b8a6f58a12c0ull,0x68e84551bbec9536ull,0x18d81a7c711e6a82ull,},
+		{0x5413411cb10f466dull,0x98be3017fdb052f7ull,0x368b2da2edcd19d8ull,0x0b7035054cc50cf0ull,},
+		{0x00d066c2405b6d47ull,0xd4fbb53774405d36ull,0x148ddb7e8c38349cull,0x04ba65809747e76bull,},
+	},
+	{
+		{0xfb02ae420c3dd0cdull,0x467e3405b6e39df2ull,0x2f062a2831382e2bull,0x0c03a6939f873250ull,},
+		{0x6253e3e6ba06884bull,0xaeafde6589651f16ull,0xedb6c74ade8631bdull,0x0d07bada694e725dull,},
+		{0x603b1cff474804a7ull,0xd2de3e4691d973e9ull,0x40c1b4300c6acf23ull,0x09034155be990541ull,},
+		{0xaf76bcdc65c008b1ull,0x54ff7fde3bcb8b28ull,0x5d353ba49bc43f4full,0x16e53ab6387d715eull,},
+	},
+	{
+		{0x2bfe06b921b25d1cull,0x013b72af6dfd6fefull,0x8b527986f56c6fc8ull,0x228715dbacfe3a12ull,},
+		{0xc30214de4132257full,0x644d5d9b142ce679ull,0xd8ebb32ccb4c7888ull,0x1f758f3bea413ec7ull,},
+		{0xc21a964237f88fd7ull,0x938fe42e839e66b8ull,0x23241e25568925caull,0x20d9486bf46b7104ull,},
+		{0x08f34d51850c6c06ull,0x57805f2d6fc70d95ull,0x61200a05d0f8db27ull,0x165af32ddcdac5e4ull,},
+	},
+	{
+		{0xcbc1bb3945e055efull,0x2d458005d9b1d0efull,0xc9248c7620441001ull,0x0fc61bb7612b6b9bull,},
+		{0x43e833897adcaa25ull,0xc11aab4df89ecc63ull,0xb7813757dd318f0eull,0x05273fdda512bfc8ull,},
+		{0x7e68e0a049b9bcdfull,0xb0adcc293f17cd2eull,0x83a8b7f4159f507full,0x1d21aeea9c18b82full,},
+		{0x3421df0c7a2707d9ull,0x1d1786a3ebdefd69ull,0xce5d2c9c4bb535cbull,0x174d811d71acc10dull,},
+	},
+	{
+		{0xdd4465884c41c069ull,0x8e0b620cc7aff6f1ull,0x682c4671bb54b6dcull,0x2515d772ed2e66b1ull,},
+		{0x64cf9a3de7b435fcull,0x226672671c319cefull,0x3898a556e0948a56ull,0x0d158ab371da1fffull,},
+		{0x2ce43bd539edd2b6ull,0xab1bfc095c805e51ull,0x176a56723663c6abull,0x10652501fb9e6726ull,},
+		{0xd4663e9569710fe5ull,0x32252a27dd09dd7cull,0xabe3e29c3140b772ull,0x236f30d448140bb6ull,},
+	},
+	{
+		{0xe5d2ba29912ee402ull,0x2f9032f9b9128082ull,0x598b1058451c79ebull,0x0eef6168943a1540ull,},
+		{0xaace44d48e38a902ull,0x4061dc4fdc93a24eull,0x8dab74d7abbb182aull,0x0b3c0cc8cdcf99b6ull,},
+		{0x09688b3990fe4cd7ull,0x9ed9f6fd60f81088ull,0x4f8cefe42a55d4e6ull,0x18f067141bf8627eull,},
+		{0xdba8eb4fdc645155ull,0x228421554643bd1eull,0x87ba26a3a0faf058ull,0x242b2ddff2a10b8aull,},
+	},
+	{
+		{0x6d7d588f11058a59ull,0x40454b8070a4a591ull,0x8ec57f9c83dc12f6ull,0x1a92b599ab44c9f8ull,},
+		{0x3672ec372d8a2066ull,0x7884f181f79cc904ull,0xfa58b6ec2d8fbccaull,0x23e3c83913c515a3ull,},
+		{0x61f4bef496aa14d1ull,0x29fc3828ac0b47d2ull,0xd5b57446a313c9a2ull,0x231b85f9493ffb17ull,},
+		{0x774297f31ea0d3a7ull,0xf0aaf72cfbc260f8ull,0xfc999abe808608e5ull,0x1d64d3604753d42bull,},
+	},
+	{
+		{0xa385136fdf7aa478ull,0x3a5b061c8ed1df3bull,0xdecb97021994fc31ull,0x0bde95c6775f28faull,},
+		{0x6c63ba96bd512d63ull,0x857dfc6840992511ull,0x730b7195b3a3bf2eull,0x097e31400796d1e4ull,},
+		{0xc399ac6db56c2bd6ull,0x30d61f30ede05ff9ull,0x762f4ab2abd56324ull,0x1feb4c9e9dc432ecull,},
+		{0x75d8f224fd809d43ull,0x8a57a7a1b6f82684ull,0x90b69ef10947720eull,0x23c9d1d71634d861ull,},
+	},
+	{
+		{0x2ce777a45507f397ull,0x04fe3b7116df5a9eull,0x379a8aba13d6f2caull,0x14ba58759e3f0891ull,},
+		{0x33331ab24315e056ull,0x280c7738f3dba55cull,0x88b9a3a456da9586ull,0x1cc0c809161dc688ull,},
+		{0x6fd1d079257a1980ull,0x651b4f7a3fa7b72eull,0x9be93b3d8afd1690ull,0x0c221160a1da3804ull,},
+		{0xe7ce02021d2923b9ull,0x970a156c6414ce4aull,0xff1548a4fcf832a3ull,0x1b8f076b51491c38ull,},
+	},
+	{
+		{0x0ba39f1d0d8b8670ull,0x7896f7603c74d571ull,0x50aed61c13b88704ull,0x0a0d3690cc335590ull,},
+		{0x4fcc776a0dcaf0f0ull,0xdd509335af225d63ull,0x880afc38c0602eabull,0x042e64f0157a7e97ull,},
+		{0x870245cd82b0f803ull,0x4955336c23c0fb17ull,0x6adf0776fa22c6bdull,0x191f0e694fb19482ull,},
+		{0x432d9e05065adda3ull,0x5d6ce76c64a4e36dull,0xee796d8f07142e62ull,0x051ce17fc1ebc793ull,},
+	},
+	{
+		{0x0f3532b5bd871776ull,0xd312598be0999deaull,0xca2d1c6274e54c62ull,0x1ee75376f7c68996ull,},
+		{0xd7c8eb123754dedcull,0x183bec0a0acaf042ull,0xafcdf11659cebee8ull,0x229d43451ce92bf8ull,},
+		{0x91e856e5d72a41d3ull,0xa47a6132048c8f0dull,0x868afe9818291555ull,0x199b053d6eb36943ull,},
+		{0xb4e0d59f3aae96a2ull,0xf235b3b8beeda508ull,0x9e757efe9d4b0be0ull,0x0175376aeeb98ccaull,},
+	},
+	{
+		{0xaa42e7952e7c91e1ull,0x490073eae16835adull,0x7e6872de8b47876dull,0x163ddafc551598d7ull,},
+		{0xda7d1b384cd0d55aull,0xf45ff8dc947cbd52ull,0xef1658f3816c4d82ull,0x11bcf22fba58fd7full,},
+		{0x4f079b1f4396e7b3ull,0x40f21051bc7fabb8ull,0x250b4cc26fc38f07ull,0x243b9c2ba0269588ull,},
+		{0x4cd3559cbfd044faull,0xb0405f50d035378cull,0x0b59f73441f980b0ull,0x0b666d86fcf03c52ull,},
+	},
+	{
+		{0xcfcc82d5aa6118d0ull,0x6b147078a9569414ull,0x3db6dc986397a08full,0x117b4992bd69fba7ull,},
+		{0x45807df070fc23e2ull,0xeafd4cdf457dffddull,0xb80dc348a33fc8f0ull,0x02d3e7a7d4de12cbull,},
+		{0xc418828e0eab77a3ull,0x23585e051af5e4e2ull,0x6eab58ba007c5b47ull,0x086dbf4f7e55a7dfull,},
+		{0xd9b5950f27ebe79bull,0x46b57c39c3c259ebull,0x35f60be7184303f6ull,0x0fec9eefb0223d9dull,},
+	},
+	{
+		{0xeac7632be7d1ff64ull,0xb9911651b991328dull,0x839773f32c82fb80ull,0x23e4b62f9b96d620ull,},
+		{0xea30fb611a8b8a51ull,0x4cbe8a1fd99010f1ull,0x2e53f28e0135d171ull,0x02366f83167b095eull,},
+		{0xc19d0b4752982b34ull,0x5de06bacc3589c46ull,0xde5f0fd0ef76cc2eull,0x0bc41936b22781b8ull,},
+		{0xd9a49db30b70bcbaull,0xc80c98a22237ced1ull,0xbc02903b7fb29901ull,0x1aa3b2c304e25d30ull,},
+	},
+	{
+		{0x9589979fc964294cull,0xf31fdf0f3d9bc70dull,0x1388d09a3a779edaull,0x1214087c52097874ull,},
+		{0x87e64adedb9efa4aull,0xbecb779bea87aadaull,0x48f7a4ab0235667aull,0x005055624f4167cbull,},
+		{0x945f3cb2908a6d71ull,0xaa9ce1add1284701ull,0x1b0e7ff15a4fc7fdull,0x052f7798871ba92eull,},
+		{0x4b6ab0f05f2a11b7ull,0xb5379dfb47866544ull,0x2ea538276ca7bfcdull,0x1611c73e6468978bull,},
+	},
+	{
+		{0xd53b8ce07f944f61ull,0xcb23d56e097620a2ull,0xade357fcce36a013ull,0x093d212514a90af6ull,},
+		{0x9ed8b0d45c34290cull,0x1a7d95b701c77319ull,0x87376f2a7172befcull,0x0fc687921708fbd2ull,},
+		{0x0d45450c3b2a86adull,0xc08e59e5c6d2ae44ull,0xa6bc5e6a565bfa8cull,0x0e355c3bdbc0d5cfull,},
+		{0x635b8b21e2c21e75ull,0x991863817028de67ull,0x8adbf4610af56f30ull,0x03af11e9dc89cdc4ull,},
+	},
+	{
+		{0x397f9a54b1e4ebe4ull,0x1376455802d0725aull,0x3832eab9d3d21b70ull,0x01a5aa9a8c0dbe8cull,},
+		{0x075a43edc087a0d0ull,0x3822ce8779078c95ull,0xd888ca9fbb481b3aull,0x0a764c8cd4dfd4c9ull,},
+		{0x4f100e22172070b4ull,0x33c4c3e9eccaa037ull,0x57ead8c84d119fb3ull,0x195ddf33b36d6f8eull,},
+		{0x22829b4170b484ecull,0xa66fb0fd367c17f9ull,0xf8a282a4a6950c77ull,0x0568eceec3753508ull,},
+	},
+	{
+		{0x0b854ccccd7c57d0ull,0x5eb63dbed4ea1e14ull,0x543bb3d229b2a14full,0x0c8c4534011478faull,},
+		{0x1726fefa210a6fc2ull,0xd855857b69e092d4ull,0xba93c0fabb94d85aull,0x137f676edbb6bfe5ull,},
+		{0xd02e6208dff6338eull,0xb756331918c692f2ull,0xa9c39227c5ef29c1ull,0x069eac77e91284e5ull,},
+		{0x322464c507e766b4ull,0x5430a09f7e0ab42full,0xb983445148749826ull,0x1b20ac95a1f5d8f2ull,},
+	},
+	{
+		{0xd79b961cc44eb9cbull,0xb510a36238e4bed6ull,0x7d548a247548a77full,0x18298dafa5f443bdull,},
+		{0xcf6eac3d5ba27504ull,0x893539f4a9adfdd3ull,0x155c3340ad8bac4dull,0x08ae5f2d0dc909ebull,},
+		{0x97c2eaf5aec8ab00ull,0x6f717b10425b0d6cull,0x175efcb46b22da9dull,0x02d250a330d53e24ull,},
+		{0x641ce825db47b38dull,0xd839ed4aad3ea3dbull,0xeaf1cb6db50ec2ecull,0x1faf84168c8a0b40ull,},
+	},
+	{
+		{0xbc6df25f5e1d41f3ull,0x2e8cc7dd2f695554ull,0xcb3bda44ff518a1aull,0x096f1b5d03c0b07dull,},
+		{0x82f6a6f3ace0601aull,0x591ee2a5e7c8f1a8ull,0x3b6f4959525b2719ull,0x09e69ba74831ad6bull,},
+		{0xdd95f50e6ca13fdcull,0xae894ea70fc34756ull,0x3776f19ccbcc5aabull,0x0498b6fe18eb0ef8ull,},
+		{0x9a985be45da6b5afull,0xa680ba339393b549ull,0x4dcd1d265de5a070ull,0x179c5c936a37da02ull,},
+	},
+	{
+		{0xf761798437ce07b5ull,0x6252ce653c8fb5c0ull,0xf7c8201b2526d15full,0x1566f27c0b147660ull,},
+		{0xd177ee8194557fbdull,0xbd892a578298c280ull,0x2ff03415f22140feull,0x0c0a2d41be6950b5ull,},
+		{0x63bff7745491ed2eull,0x28aacd3ac3264043ull,0x15616cb08a7ade8aull,0x1a394fd137b55209ull,},
+		{0x0b4edf9fd39813d3ull,0x65ff0fe54505602dull,0x3cfaa0b2bd0926d5ull,0x16621969c7163fd5ull,},
+	},
+	{
+		{0x711eccb399d331f7ull,0x6ef7c1d89c17e93full,0x69253c486ca0cacaull,0x12b6c453b6b88959ull,},
+		{0x5f9eaa5d35a31069ull,0x930562d50f1accf9ull,0x1f3154b0fa92f49dull,0x25206c96abc0cbc8ull,},
+		{0x0d9da322d494140bull,0xc1876a0b31974417ull,0xe85a6106ebc8c3b4ull,0x0223f7877436304full,},
+		{0xbd397a41a741d0c1ull,0x8fcc08482bac3699ull,0x373b45f6eeaa38e3ull,0x0c523b81f31aca85ull,},
+	},
+	{
+		{0xafd1b19b05956001ull,0x5539ac026dee703aull,0xbb221d724cd94e5dull,0x1793ca6f861f0528ull,},
+		{0xdc168e4da00c50bfull,0xb671a11b991ec819ull,0xe4dd9a5b00dfff63ull,0x1d510b5fd32f9aadull,},
+		{0x65b07ce9d5cd5222ull,0x737fd096371268baull,0x0e8970e974573b06ull,0x0296650d15d962d2ull,},
+		{0x7736e81050443fbaull,0x40e124f372498ac9ull,0xef422f37d9e5666full,0x24ea72f107e350f9ull,},
+	},
+	{
+		{0xefd0f42a4cee6892ull,0x3c46ee67d43c0e59ull,0x2f4826bb632cefd5ull,0x21d847bc24ea5056ull,},
+		{0x84cd5e00d1ef6b7eull,0x54a6e1053547338aull,0x2952e35c9598948bull,0x1941ff375aeb7ee3ull,},
+		{0x368a73189dbc8aa1ull,0xdd93c17ec74dd6f7ull,0x36118d4d4e0ac65cull,0x11a453dfaa821e07ull,},
+		{0x737e743bb2fcedd8ull,0x5b54c1a46895ddd0ull,0x8a2238f2c801b0f8ull,0x117b857614956985ull,},
+	},
+	{
+		{0x1a78fa93376b70fbull,0xbb26b3fb1399d6bbull,0x5e7a2632ce713bb0ull,0x162c2aea0e723c3eull,},
+		{0x9df825ee3b45a4d5ull,0xcf4e08dd5cb5da5dull,0xcb7c68df3bf12344ull,0x051bda5eb0d8aff7ull,},
+		{0x17d94e02affa6b43ull,0xe1f1c4c00a0d4b4eull,0x599d042b1bde42f2ull,0x194fff46da0c6e00ull,},
+		{0x340f5af07e7be510ull,0xe5cbd17e9d3df42dull,0x8ce4b18d1a36990eull,0x17226aafd594e79full,},
+	},
+	{
+		{0x2beb63b64b866b4dull,0x4782a685c10a5f42ull,0x607f888ac0c71681ull,0x2386a03ab655ba7aull,},
+		{0xbbc445b8f47bd87full,0x720dd159bc61c84cull,0xb6d23e84de1f9447ull,0x08729c544c99a8f9ull,},
+		{0xef564db759121f72ull,0xb2564773d330056cull,0x821c1c0e18d0ae14ull,0x14a9db4759200bf8ull,},
+		{0xcf3333f12918d677ull,0xee797a95e750392dull,0xe802199319ac5309ull,0x2372282fe9533e24ull,},
+	},
+	{
+		{0xa4b548d3b4c62055ull,0x1625cf429d038128ull,0x84c8b32179b3f793ull,0x0d81003595f2fafaull,},
+		{0xad08b98b774a3855ull,0x9446297c4af6e88aull,0xf0ef75e4a685923aull,0x167a01d4595524faull,},
+		{0x27bf4a2036e1d1a0ull,0x143562ab42f386d9ull,0xfff7a81f74711112ull,0x017d65715c6ba326ull,},
+		{0x4047d72c54de9484ull,0xb4c018a1a4dfadcdull,0xecf669985d20f41dull,0x0441867f9c83f86bull,},
+	},
+	{
+		{0x20e235f12cea9b00ull,0xc5565c0cb186117dull,0xc5ae7274946a8639ull,0x110068de14150fb3ull,},
+		{0x3ce06d798bcd3cf5ull,0x0705b03e872757ddull,0xe46314e1c583d2afull,0x17f59fa6b409f1fbull,},
+		{0x38aa95523991907cull,0x082c52625fa345dfull,0x0ad37bb64034c5fdull,0x181507a211d306f3ull,},
+		{0x2fa2a979870da20aull,0x1437d4a37ba89c15ull,0x2a5c978d092b107bull,0x118a770ffe12a938ull,},
+	},
+	{
+		{0xd0be53499f15d4aaull,0x5a8c42ee66616107ull,0x901e333442742645ull,0x12ace5fc5108d8f0ull,},
+		{0x904f761c07b4b94aull,0xbc26c5ce974ab600ull,0x9f3192c1ae7b9473ull,0x04c30e9bca8317f0ull,},
+		{0x94fb2da5c6b3bfc6ull,0xf3c9684b14abffc5ull,0x5485a8966ddf5b4dull,0x0502476761fa243full,},
+		{0x392419581525d68aull,0x10b70b6e1c13bf17ull,0xf79b7d7fd7dba3fcull,0x1b9cd9f736d0b8fbull,},
+	},
+	{
+		{0xbbdc5fefc3098cb5ull,0x3294745188564bb0ull,0x1c5fe51039bef334ull,0x02f9844e2d202871ull,},
+		{0x7a581dd4f224c0e4ull,0x85fd8001343c875bull,0x73401f9d3ee9bde4ull,0x04810f911057fa81ull,},
+		{0xb9f31ed75adffe3dull,0xe5a078bb1aa2cda6ull,0x5e78fb4c1126cbf7ull,0x1ec6829feae8b062ull,},
+		{0x35751dcc038737d8ull,0x97e9e08ee3d2766full,0xab46cd55eb012c05ull,0x24bfbdc26a983e21ull,},
+	},
+	{
+		{0x4ee3daa0842ead06ull,0x3ed70db4af3ec7afull,0xe623cb91d727bf0bull,0x128c9e65fdd55182ull,},
+		{0xbb66722fe41bf1bdull,0x774b8495fc8b04e0ull,0xac01dac84a2ac5beull,0x24c6b230ae47882dull,},
+		{0xba4a74b30642d3f3ull,0x6d7a7161c6c25dddull,0x939420d87cd48458ull,0x1174a90b8c0a865cull,},
+		{0x8c302ce994e2ad80ull,0x7c948ee05b2047a8ull,0x1f98191b40a1bc2aull,0x2070825d216ae4edull,},
+	},
+	{
+		{0x4901b65a3bfcc665ull,0xcf1106e00cade38eull,0x18053da2c84a268eull,0x0b667154cd91d290ull,},
+		{0x62c1ebd16797c4e0ull,0x94c8191edc712015ull,0x4c1a459c39722c28ull,0x23b2aa59fed33f03ull,},
+		{0xb2178d0a63473261ull,0x4054f5ed82117abbull,0x437f95f0164ed2b1ull,0x08a39abebec1baacull,},
+		{0x707375cde0d020e8ull,0xf39121f8d5c4bf31ull,0x42e6b858a36b517aull,0x014f658b2281eadaull,},
+	},
+	{
+		{0x76a59a45f7aa816full,0x29989c6d291c59faull,0xf3d42b2937eddad4ull,0x16dbdd8d283a96e0ull,},
+		{0xf2ff8fe96541c10bull,0xdc422d104edc12feull,0x84a75b406f71c6dbull,0x14e50f28f07339bbull,},
+		{0x1414da52029e416aull,0xe88e216bd3f1aba5ull,0x4f3fd0bbeb52a3f3ull,0x231dc4118e25e1c1ull,},
+		{0xc1cabff3f5e67b63ull,0x73497399437a8461ull,0xeab97c5929bf3113ull,0x03bda404f8f7d678ull,},
+	},
+	{
+		{0x47b642fe1fe01ccbull,0x7cf13f8b4b62377dull,0x6a38243b84c68c80ull,0x0c77546c3d0bf594ull,},
+		{0x968e355d77740711ull,0x331316ea3166f37aull,0x301b46d1e5bd396aull,0x1922ca06f542e3c1ull,},
+		{0xc4cb565e81d69c49ull,0x5fb8678c8934df90ull,0x3f275306095ee5ebull,0x246ed1156b7f6a63ull,},
+		{0x4e6c264ce668c62bull,0xe41e0c82d49ac198ull,0x12cf779f774b4efdull,0x0c851586184db1f8ull,},
+	},
+	{
+		{0x6ad4051523cc490cull,0x942e0abdca67327cull,0x7ac17f50b7e84429ull,0x113e8c976bb8c6faull,},
+		{0x3da4804f5bb26f03ull,0xd0d66290f35deb5cull,0x3e50f7a128e126f7ull,0x22d735aa8dfd7fa1ull,},
+		{0x3d1579cac12691d8ull,0x666620acff167759ull,0xf73282abdef89289ull,0x0383675df456a29full,},
+		{0x363490e88c280094ull,0xf07855280a85726bull,0x7f4393087414e8c4ull,0x0240c3c8f32cfdfeull,},
+	},
+	{
+		{0xc192e3b6e208b708ull,0xded925a800c02305ull,0x89d1b0bee8837637ull,0x1d3166aaba8e35e0ull,},
+		{0xc75be703cbd6b64bull,0x2ecc0f648e917dc5ull,0x5513483204085197ull,0x0622c8e561fcb90dull,},
+		{0xd4a74562c9841f25ull,0x5a545960b24392c0ull,0x65ac3ff9a09d5142ull,0x047335745ad04f67ull,},
+		{0x90436fec1950f12aull,0x0ffaf85aa54695fcull,0xee8f584bc8567724ull,0x1b277160de84e4d8ull,},
+	},
+	{
+		{0x2dcd086f50ee0641ull,0x29e01a3b1f4aaa5aull,0x6b398b45dbd8f046ull,0x1a2ba4cec052b257ull,},
+		{0xad61ce1cb31d036eull,0x3e43264ee88ad36bull,0xc405c73bab0d019full,0x19dae2bb7fab1d71ull,},
+		{0x2d38aba83a3ba58eull,0x741f779e9e4432c1ull,0x938426d4df108775ull,0x1d4e298c125c8dccull,},
+		{0xd3d5bf10cf672a36ull,0x653336d9ec7c5cc7ull,0xa64d2a74bf3a1dc9ull,0x12d4fae195fd268full,},
+	},
+	{
+		{0xa449da99e2261d22ull,0x9a06c768ff08dbd9ull,0xbabfa119acdb04f2ull,0x17a8f5aa142ff179ull,},
+		{0x529ef831126a9edfull,0xcf304fb99372a051ull,0xd94208686c412464ull,0x08cba0b051eb34f9ull,},
+		{0x48df24a02462c281ull,0x54ae9f24e9c00d7full,0x9897722c32281dabull,0x1296d19aad2c7a6aull,},
+		{0x1430a258f816b94aull,0xacc2c04deaf93db7ull,0x400f8afe2728ec83ull,0x0a1dd395ec050ac5ull,},
+	},
+	{
+		{0xfb9daeb376f372ecull,0x219289869ff604e3ull,0x3a0cebdc05556df7ull,0x0ae290b99a848996ull,},
+		{0x5433906a57ea622dull,0x2dde4fcb3d4e70aeull,0xd88206d8bfe3fd73ull,0x03e8927dcdc5d48aull,},
+		{0x23f14f46b6ce8f54ull,0xe43ff372fd528450ull,0x3e2aee47c612d41aull,0x07bf2ab2f54a12d4ull,},
+		{0x2a03732d01db2899ull,0x76e61b77802f8bb3ull,0xfdd60e480d03034aull,0x21e392cfc66fdd19ull,},
+	},
+	{
+		{0x13fc482ed3eaf24dull,0x12e90fe2cea9dcf5ull,0xcc3664a74d94580eull,0x1ca31e6d505659d2ull,},
+		{0xea1e472809e5c7f9ull,0xfea1c9e036451220ull,0xe13abd3ccbdf9895ull,0x17d1353cdfd8a949ull,},
+		{0x0b7e99199c4e8c8eull,0x6641e41cb0580e53ull,0x55feb851b188611aull,0x0b218284281ff546ull,},
+		{0x939d2d8ca4d0e99aull,0xab4d0c7b0b003ac2ull,0x8207619ced75cf8cull,0x0f3703a4062f31b1ull,},
+	},
+	{
+		{0xdfacaac7c54ddeb6ull,0xe7bd3322ca57c204ull,0xed6d832b87df7483ull,0x19e951f170c3664cull,},
+		{0xaf274caeb61137c1ull,0x94fba62c15ef1b4full,0x0ef5b4a64f7a37d5ull,0x134cbe8a961c1061ull,},
+		{0x3c7ae97e153c8dd6ull,0xb131a755ff10087dull,0x41d804b315085ad2ull,0x0807e1c7abd87e66ull,},
+		{0xbc27f134690aaae9ull,0x67476f00059dc6f3ull,0x082319d611d4f651ull,0x1cc187ee73c5d13aull,},
+	},
+	{
+		{0x92ca50e865776697ull,0x157f8325f1918d24ull,0x33e3bb569cd72d54ull,0x175e45f3b62761ffull,},
+		{0x1a6db9a4328d37deull,0xbf9b590b12c5c59aull,0x2bde97544894ae31ull,0x22c462e16e73632full,},
+		{0xaac33a5e5c1e8541ull,0x596e08f6aad1e5bbull,0x4869a3e5b5951d5cull,0x0e4b88167179c149ull,},
+		{0x20f09be3d672ac60ull,0xed8c228d5162c2edull,0x181688f8bbf213f4ull,0x1eff67271afe717dull,},
+	},
+	{
+		{0x67893096426a9a23ull,0xa4bb3fd6eef54a87ull,0x5eb76fc3bd3fde38ull,0x038b7c4b3d1c4b45ull,},
+		{0x018aa5cd5b152894ull,0xd2435a63e9cadcc8ull,0xea213141b614ad63ull,0x0b6b8c3ff0772c1aull,},
+		{0x94bbb47af885bc60ull,0x5f3697d194b67d85ull,0x81e6037013ba9869ull,0x012756bdc40b560cull,},
+		{0xa7d6713972b288e1ull,0xd0ae514ac11abdb9ull,0x855d8e0bda219e7dull,0x243b25af126fab1dull,},
+	},
+	{
+		{0x6e5e7621003630a7ull,0x75e798fb40a63eeeull,0x21fde63fd1a7ca77ull,0x1b2a4450fea9da49ull,},
+		{0xe278a109da3fd33full,0xbeeea01a2a2eaae8ull,0x02c7979cd43b4c3full,0x0bb79690c05163deull,},
+		{0x3eb3de162d1be91dull,0x5185a7ccd06bfefbull,0xd44d50422d2c0a13ull,0x1407c21d09f3e4e5ull,},
+		{0xdf0a7daa3f686468ull,0xc7fcaec54e5618a9ull,0x81b68d75d072a0c0ull,0x059045eccd6bf48eull,},
+	},
+	{
+		{0x1a43ce22b2b159e7ull,0xc02a1b7eb2852da2ull,0xc1dfac0c1c39e609ull,0x13d246a1bc669e6bull,},
+		{0x3143d7a13c801135ull,0x9af44d60593f276cull,0x7c118371d8a35b96ull,0x057c744143ab27b7ull,},
+		{0x66e10b094a1ecef4ull,0x0716e3fd63f51dd1ull,0x683cbcbae00b8af5ull,0x0708e24fed7eec2eull,},
+		{0xb80f9e2a788144d4ull,0xe4fae0392945c26bull,0x707a2a9d82cf72caull,0x00c9c680c1d1f97eull,},
+	},
+	{
+		{0x77bfd5a585088940ull,0xf1a14ac372fbcb09ull,0x801a8fea4bd40114ull,0x00fdbcdabaef0d60ull,},
+		{0x70fb0d7e2cf7033eull,0x9d4bd2bb6872a254ull,0xf2fb2372e1a65f86ull,0x2397053fefc064a4ull,},
+		{0xf7c81d8e697fd85eull,0x3df97b253f13a856ull,0x68a1a08838c2f917ull,0x13029bd102dbff2full,},
+		{0x769dd3f33241d367ull,0xac75400d8c8911f4ull,0x3a415ee92a09392aull,0x1aa7407b5777df85ull,},
+	},
+	{
+		{0x11a5c819fbcab84eull,0x60493a1bd603920bull,0xc95929dccaaec934ull,0x116516aec1d09445ull,},
+		{0x57968dbc0d0cc0ceull,0x25a09f42822bd693ull,0x3073ad9c127f3820ull,0x12daaf6cb0c5c428ull,},
+		{0x7ae01bdf6c1e31b2ull,0xcfdf9e73336ad4bcull,0x62b5796a3f0fb075ull,0x18908929af2d9c31ull,},
+		{0x0f57b7fcb2ded5adull,0x4a66c684cab95f95ull,0xf52d345c34001a71ull,0x12c7957bd4fa6fc8ull,},
+	},
+	{
+		{0xe7453cb63b66e3f6ull,0x05898a5c0d08a99aull,0xe07ad51930595f63ull,0x0e10627367e199d9ull,},
+		{0x2c1810069edaaf5dull,0x27973720b5289f2eull,0x3b32da90e76ac4b2ull,0x0f043c28f4cb4cf4ull,},
+		{0xec929831b7eefc20ull,0xa8353610f3335a3bull,0x17b66518c3939913ull,0x0f368c412b98248cull,},
+		{0x2f17a34f34b6f412ull,0x8166099832c67be3ull,0x272e953227d769dbull,0x0dd3c03e8a7f5070ull,},
+	},
+	{
+		{0x644a79e23271b141ull,0x708a5338c392fa8aull,0x440ce5c33daa54d3ull,0x0afaa6788ff90ee6ull,},
+		{0x19c06102a2abfd3full,0xaf484ccf70f8337bull,0x68fc13f3934bfe66ull,0x1a4da5c75b1238fbull,},
+		{0x35d61ddcdcae7988ull,0x85d99efdb71145f9ull,0x69bb26a22dbe04ceull,0x0ffe41fba3b41bddull,},
+		{0x7e3a975729ae0066ull,0x3f590f4589e5d1d8ull,0x43b36f953bd66574ull,0x027703f80416a98dull,},
+	},
+	{
+		{0x11d1efa492feef40ull,0x91bb3ac2543a9ebaull,0xd309488746e58078ull,0x10988358ea32035eull,},
+		{0x9b4bdad52c88159cull,0xc246b4550cd66cb5ull,0x66ee7b674a692100ull,0x1f96a383d94362a3ull,},
+		{0x66ebf106a6552481ull,0x3056ce67b0fa9013ull,0x5b8362ea9b87374dull,0x1a755d09eaf1ae5eull,},
+		{0xc6cda95d1ccf5c8aull,0xcb3e11430f909921ull,0x2ccaba8eea251f3full,0x207d6c7e62957f51ull,},
+	},
+	{
+		{0x4e524e4a85ababd5ull,0x0cf6f2d1236eb0aaull,0xc5e3ac8c45072cd6ull,0x1e9802491592c2d9ull,},
+		{0xa224892f55d9b1baull,0xe3fea299eff5556dull,0x23b86ba1d3ca9059ull,0x06a72c0738307f42ull,},
+		{0x2b910fc0517ff970ull,0xe2e90a1616178cd5ull,0x6c0047fd0712a9fbull,0x09e45a03f03874f0ull,},
+		{0xcc56f07bc22025abull,0x3debbfeb02b36646ull,0x72b884036def6498ull,0x127bab65fd841037ull,},
+	},
+	{
+		{0xd5ec596b4ce1b03eull,0x6b9e05b4293744e0ull,0x47be41b08ec3fdbbull,0x1899b6521864d8dbull,},
+		{0x95c2f7a09f3caf5aull,0x8dea06197ae38e1bull,0xff5398eb67a1110cull,0x1c5acb6f63c0a214ull,},
+		{0xefb2c023317f50d3ull,0x69fd16a4aa73971dull,0x548db35c03f8ce7bull,0x0f61d09a71910436ull,},
+		{0x8799811774bca9caull,0x45a682cd7368c237ull,0x7f6ef72d5442f24bull,0x1f46c2504a3e96d9ull,},
+	},
+	{
+		{0x1ca63978ccabe78full,0x2e80617e7ebc6147ull,0x053ebf9577cfdaa7ull,0x08f13e82c7da3562ull,},
+		{0xd6420961e0532fabull,0xfb31052ab2ef70a4ull,0x7c5b9923ddaab95aull,0x13b1f994066f1ed0ull,},
+		{0xe547176f94d79c15ull,0xff82a870832544d9ull,0xeba8c46bc931af05ull,0x1103c08e0353bdd9ull,},
+		{0x9709cff05507c4e7ull,0x8735900ac74fe314ull,0xcd6096300f76fce2ull,0x1f7b2dc948d83e17ull,},
+	},
+	{
+		{0xe424367aada687e8ull,0x9505b2a5e05f0e0bull,0x668143fbc2f0559full,0x07e0904a60e309dcull,},
+		{0x41ea945959923e61ull,0x329551aca689e567ull,0x6e818ba4a5dd6452ull,0x0f40252fca644f7aull,},
+		{0xb64cf0f6518a442cull,0xd2a57e7c8f789800ull,0x0883d6cc454f4cd4ull,0x1ef0786c924b90e8ull,},
+		{0x42137d8be4c0883dull,0xb6844508a50c90beull,0xe81ba5711b81f122ull,0x1085d29ad85261d7ull,},
+	},
+	{
+		{0xf58b8ea798f58fafull,0xa13deaaf11034c4eull,0xa15f5dacc6e8e40eull,0x1ec6ffbd3bec146dull,},
+		{0x956e591f9ddb2357ull,0x2b1dd7a1ada4fc9aull,0x8eb45ee9e4e974a6ull,0x07a913f29077fcc5ull,},
+		{0x4458a6fadde9d01full,0x2700d94032850cd9ull,0x2f2ff891beb0425full,0x05bc5e99861bc545ull,},
+		{0x83aef17093693839ull,0x7b057748743db697ull,0x61f0eae842c433beull,0x19b4d5fd4d756e7cull,},
+	},
+	{
+		{0x3796b90753054af3ull,0x7f395ba83d89b030ull,0x29a93d83941fff31ull,0x24f03940eb201d0bull,},
+		{0x9407448050038655ull,0xbb7e8715e8860903ull,0x3e037491a318f7deull,0x091fcc23abbf55baull,},
+		{0x0dcb659f3b2a4965ull,0x550c8788d21f7968ull,0xf750d3167085fe7aull,0x0c92f877f72233e5ull,},
+		{0xd5fd683c1dffff33ull,0xbe2079a70658402aull,0xf25ad8c6abb8c2a3ull,0x1922fc9abbb1e3a4ull,},
+	},
+	{
+		{0x0f71194b839488d6ull,0x4e8325d1329a2cccull,0x16f689c2b7df5c8aull,0x1a7e35121a0dc83cull,},
+		{0x29768c6969e054c8ull,0x6a675cd30211005aull,0x6eda98568faf760dull,0x0d5fbf20842d0b9dull,},
+		{0x0bff5728ad48874aull,0x297fdd77c9ad703dull,0xe43c32d5e6c3754eull,0x15f0108aae20b1beull,},
+		{0x7be2e3ddb150b9b0ull,0x1ad465c57005668eull,0x5ae72c044887033full,0x1c7b757e16300a17ull,},
+	},
+	{
+		{0x45bb928362470c10ull,0x0a2de1634eed9cf3ull,0x9973ad7bb61dc426ull,0x0891cba25dc7501cull,},
+		{0x247ac89f37524e59ull,0xd1ce504a64bc94a5ull,0x3a02579523c1986aull,0x0c5d34d12a4dadecull,},
+		{0xb1f6747c276a0ddbull,0x615d80334301c70cull,0x34fd037103a465a4ull,0x191fc618a63f357full,},
+		{0xdd53a2e63b39574dull,0x98074333967142b0ull,0x96d166d91db4f51dull,0x1a61d2a82133be81ull,},
+	},
+	{
+		{0xa5e9124370c2c7fdull,0x025defe715ad828dull,0x1b09890302209d53ull,0x00af8b0b52c3be26ull,},
+		{0x0f12ad6694aace51ull,0x1ed0c059a487ba1bull,0xc1cad9e9c3265a3eull,0x23917a00b9abac90ull,},
+		{0x0c4e4e50edf73036ull,0x47ec71cc965c1efcull,0xcb95371de0485e4dull,0x169ad760c448e60aull,},
+		{0x00e0889cd6b97e18ull,0x168e84bb46599c23ull,0x0950297dd998fd48ull,0x2097f47be7a14b2dull,},
+	},
+	{
+		{0x3949bddd4265afb6ull,0xe48f5536f20e34c6ull,0x2b9a46748e70a05full,0x06b908b402cc40e8ull,},
+		{0xe17dcc375b378832ull,0x26a1a9feb684245cull,0x66cc91efe7739df1ull,0x0c33ae652d7a943eull,},
+		{0x59084f9280f3bb06ull,0xad382f185d185890ull,0x5c77d313344c510dull,0x1feaa100bf640a0bull,},
+		{0x225cc939b73214d7ull,0xc6715e55f27d7780ull,0x9cf32babf2bb85c4ull,0x11c9dc50162ef9fbull,},
+	},
+	{
+		{0x229c7edccef0794bull,0xa3100824b71de70dull,0x6e1de645b89facd6ull,0x03817039118cd8ecull,},
+		{0x1934f52e58c9ee7aull,0x4cdcd1671d92d44cull,0xe29694667eded64bull,0x0c47e5e6dcf8d7d5ull,},
+		{0xfc970d8f644adfd2ull,0x03e7e2c138c65755ull,0x38027e19b4a2cc2bull,0x085ff94c8c0661a1ull,},
+		{0xbb8e257a1003cab4ull,0x3c257657a0c13115ull,0x32385a5ef7da6605ull,0x15a1f92ee74594a0ull,},
+	},
+	{
+		{0xcf231c1135e35316ull,0xbec56a38a5c6a731ull,0xb88ebb21c64bfb7full,0x09a2ee136046b2c7ull,},
+		{0x01eb461401307883ull,0x040837747195f16full,0xd8dbc51df16ec4b8ull,0x195e7abb6d2aa323ull,},
+		{0xc95fe137ea5829fcull,0xc8cd2b5756c83e30ull,0xa97ae9dc87b3860dull,0x230e98a0cba880a1ull,},
+		{0x221ea1ea47ebb7e3ull,0xaf20fa6408912b39ull,0xdbb60b45c13bef25ull,0x0a54a6401c2ece12ull,},
+	},
+	{
+		{0xca38d9deaf8871c6ull,0x64d90aec504e29abull,0x2041c55c22491543ull,0x1f62edb8dbe8c181ull,},
+		{0x2b40b317ebf0c8b7ull,0xa420f3ae46edf567ull,0xf1c8c5395777515eull,0x0387fae8e909c99full,},
+		{0x36fc0f879290d028ull,0x3026efe0f93cba4eull,0xad34ef1bd7fa336bull,0x0aea6b1035c86c0aull,},
+		{0x880c9d51757bb06eull,0x2df59aae9b173ab7ull,0x9be8f5c315b02170ull,0x087f2e99b9b23757ull,},
+	},
+	{
+		{0x3509f88d81a57f76ull,0x9b84f980d807a383ull,0x17ddb66b50524802ull,0x1cc0c247b13998f0ull,},
+		{0x4d092bfae7616334ull,0xa5a131d865493040ull,0xc4be159ecd7c1d9dull,0x11ef5e49a7a07d77ull,},
+		{0xab795cb1a878cd14ull,0x7731351506b7932cull,0xe3eedda795ad22e7ull,0x1f05b18ce213c531ull,},
+		{0x36941c0d1f70db86ull,0x085b5ab5be7548a9ull,0x7382a97c98ff0255ull,0x038998585293bf5eull,},
+	},
+	{
+		{0xff0e409e407032c9ull,0xadea38a3e6423668ull,0x5bae52c41e0b5022ull,0x15ed04becdcf54ccull,},
+		{0x0bc4cbbd07f048e4ull,0x136947209f97d202ull,0xbf213a5150d4751dull,0x0497dd90effc1646ull,},
+		{0x07ddd5f44d400378ull,0x8a8b257005de4ed4ull,0x4720cd173676c36dull,0x2372235ec9238beaull,},
+		{0xefe43df1d32a7420ull,0x4532859a77e00e4dull,0x70f66fd3f58c8389ull,0x096f523047f6d4caull,},
+	},
+	{
+		{0xbbba1f64e4993c1dull,0xa8903c20621d4373ull,0x36e5dc7b46e02228ull,0x17b4762f852d64b8ull,},
+		{0x4184f92ec5a8c894ull,0x4f60513a6d14d21aull,0xef9059c87615b07aull,0x0d7aa7a9ba9de9c5ull,},
+		{0xe32027165b228eb8ull,0xdd8e10b398b7214dull,0x1092f8d874506a30ull,0x201ff5ad46b01c61ull,},
+		{0xa02c74ca4e8582d1ull,0x7eb89412e785f24bull,0xf73a16e0ecbf6293ull,0x08a4975a5866a80bull,},
+	},
+	{
+		{0x85d9468474d476c4ull,0x5c6431becc3f0a29ull,0x1d715c7afd32035cull,0x138463a11268c74cull,},
+		{0x7849aba99b0127c5ull,0x770b869e735d2e1bull,0x7650db899b5b1a6full,0x1ecd41aee658227eull,},
+		{0x644cd0ad4406d5f3ull,0xeb82efd3bf91814eull,0x0ecc59fb8785e604ull,0x0aa11e338b8b95d6ull,},
+		{0x090f2be2c5a7dedcull,0x1fa86c3136a8a285ull,0xccf7b611f5123a9cull,0x218e3fe0f38bac33ull,},
+	},
+	{
+		{0xe55a8dbc1565b560ull,0xa4246a8aa873c477ull,0x0419990b04c9000cull,0x05082c999cb15c61ull,},
+		{0x9dc13bbe3fdc93baull,0x5bb7ee8984c0d304ull,0xa99a8c1a11795621ull,0x24ae9a2818910ff5ull,},
+		{0x14cd6b76ba05c6b9ull,0x21e1176321ecf89dull,0xc29912786da9be78ull,0x1804402e9bf63711ull,},
+		{0x640c060ac524337full,0x1de0907d5273202dull,0x59c586a20df67c8dull,0x0a62a1f149d4ed10ull,},
+	},
+	{
+		{0x11961b1a311cae79ull,0x0fd1f0c6dd11e18dull,0xe6178ec647eb7d4cull,0x0c0a992e6546edcaull,},
+		{0xb5899f9760890378ull,0x300b3d3a5600d69cull,0x6605cdfbfaec56d7ull,0x0197991b8ef2d0baull,},
+		{0x541502ddf4fe8d4aull,0x480dd523e263d823ull,0x64a733c96c7e261cull,0x0df5cc9df507d811ull,},
+		{0xe83c0110aae05a64ull,0x50bb1bd9a5a33049ull,0x027152cab613228eull,0x0e64cdcbaf4e0d4eull,},
+	},
+	{
+		{0x3ac201c2e71de0feull,0xf0c1e4b3551a623dull,0x121612645faeba0bull,0x0b407def2bdfed7full,},
+		{0xa8ee4f0f15ba0a59ull,0xa624c216021b53eaull,0x84a8ff74a9db492cull,0x08fc85cd794f5b12ull,},
+		{0xf41579228cbdf225ull,0x5303def5f4c53822ull,0x2382ebbd23afa33cull,0x172c646c4ccb6208ull,},
+		{0x984a7326c4bdaae5ull,0x91613ee06902806dull,0x05e1ae858c61a1c3ull,0x1b1f7b0b5d78bfb5ull,},
+	},
+	{
+		{0x122a03af31b976e9ull,0x95ef8c98aceb4a32ull,0x2848ac175668cbadull,0x24f93d8f4fbd7f5bull,},
+		{0x41f1b92b1256f3b8ull,0x1de2283b2a85410bull,0x32ab80b49b71c8e9ull,0x16938e3a12d9f020ull,},
+		{0xcc9a5cf79cf939b2ull,0x463fcbb8f04e1537ull,0x76ebb1691f4cad9full,0x013f72055ff0c98eull,},
+		{0x3fad1bbf5925bf47ull,0xa3055be0542d79faull,0x3d6bfe608ebe55d4ull,0x18b04718de286dc2ull,},
+	},
+	{
+		{0x72da340931be0b2bull,0x150d8f725af33943ull,0xae0972bf691a5bf6ull,0x15379134980dc2beull,},
+		{0xacfb52527313cb4eull,0xfc4353aad7a5be3dull,0x1719329ced2894d3ull,0x03c5e0185ffd129aull,},
+		{0xd2d1754d35c3d917ull,0x7bdc104ccf920d5dull,0xce59ab13e990d6fcull,0x124a0340701884dfull,},
+		{0x60bc2c3808ed6f5cull,0xde83982dedf7666full,0x85c4748806f66798ull,0x121f61e699eb4d41ull,},
+	},
+	{
+		{0x369eb2734d4a87daull,0xf1a1c73d13c64786ull,0xdf019c5f696f8d2full,0x0f6d81781f208ab7ull,},
+		{0xf85cb800d2ad8a12ull,0x78c3e0ac8b22e0c8ull,0xd9830d9fb00aa399ull,0x1fc1cedf2bb6c474ull,},
+		{0x3f1f246710372737ull,0x5bbf7c48d56af935ull,0x39d6d69d3504721full,0x0dbb7d6d7204946aull,},
+		{0xc92b7acc898fb3d5ull,0x46eab1a85d9822e3ull,0x6420fbc15e0f7912ull,0x0c7c01a292cc1a58ull,},
+	},
+	{
+		{0xc10ea054bec3a77full,0x8906861ec431aef9ull,0x21200bca1d0056e0ull,0x21dce27cd7d92b0bull,},
+		{0xf6c6f48afcc72de1ull,0x1178d8d9ce43a7c4ull,0x55e901c15a12a068ull,0x1c36a8b9da2b5f40ull,},
+		{0xd28448006cb0fd9aull,0x9fca201848a06bf1ull,0x44fb96e0123d60daull,0x16381d8e58ad23aaull,},
+		{0x1e0b708bb50717e1ull,0x5562e0ba986a363dull,0x7fdf391811e7e369ull,0x1ab942f5ecca8a9dull,},
+	},
+	{
+		{0x8da43949331fc911ull,0x79f3291ddf5a6381ull,0xfe2a824cd931513cull,0x090e374bb51dff53ull,},
+		{0x86bdd9b79eb38ad5ull,0xdb67d7807c166a6eull,0x0edf6fb94138ed9dull,0x240ecccecb318004ull,},
+		{0x6805b27800b97298ull,0x64852cce49a33c0aull,0x0701691d553bc3d7ull,0x08a64d14c17a599full,},
+		{0x860acdd26f1e87ccull,0x5a0a8a3618d63adeull,0xd2a1d6aa5d5ce631ull,0x0de8304e837d5678ull,},
+	},
+	{
+		{0xf3d43d35cf038a9aull,0x60f907866085abe0ull,0x119fa7e678da7911ull,0x11dbc8f6b916ec79ull,},
+		{0xd9de814d4d9ef883ull,0x482e823debbb00ceull,0xeadf5914042e6d50ull,0x15a43036cbb6b5feull,},
+		{0xcbbb847657ab72b4ull,0xc75fd46e14db2e94ull,0xfebdcef0857794cbull,0x121e55bd10d15b19ull,},
+		{0x6e53f0df6aee095bull,0x74b915ba9e03565cull,0x288c24446650a768ull,0x1d15a93c8cbfe230ull,},
+	},
+	{
+		{0x54ec851eb1fcb8dfull,0x5f99cde9b0811ef4ull,0x059053060b03735full,0x1e86993fc7d5deb6ull,},
+		{0x36870ea6b8a6c632ull,0xdc82b9a5079ec6a9ull,0x4828705c02205e5full,0x204b0e6ad4cc249eull,},
+		{0x255dadcc2f2a6b3bull,0x5e050079d82190d2ull,0xd5b4687f1c48ab9aull,0x00199b6dca92e024ull,},
+		{0xbb6548a2026bcc97ull,0x11d8380c731466baull,0x941c09b10acb4588ull,0x05055aa30edbdab1ull,},
+	},
+	{
+		{0xc4428f6d1acd7346ull,0x28e63244b3d058d8ull,0x16f1de32aee0b58full,0x05030e9efa2618e2ull,},
+		{0xfce097e66893abadull,0x00edc56b0d993570ull,0x81caf50048c7b245ull,0x0ec753ddf1decbf7ull,},
+		{0x32febd0bed90cc2cull,0xca81b2287121f4a5ull,0x021ecb6b9bf4b18dull,0x07683a761ed4f3bdull,},
+		{0x3dee31f47cb9d6d4ull,0x2a099824c0981e33ull,0x6040a62a6890ad61ull,0x0b7b955e0cbf2e59ull,},
+	},
+	{
+		{0x3c06f331434d0072ull,0x74040b15ce915ddfull,0xe2d6525fc1df4640ull,0x0316be5ee7123578ull,},
+		{0x54d30a2b6de3cb67ull,0xdd1e2ca05ca87b06ull,0x1c8dd669d6d9e3edull,0x0661750361672ecdull,},
+		{0xecab9ef5f2326c18ull,0xff338f5e6890cc5aull,0x5303ba6e55b1c3a8ull,0x07a768ff46aff7d4ull,},
+		{0xf9408ccc646253c8ull,0xa830e551f40c13c9ull,0x149db91691359ef4ull,0x10f3563ed26bae64ull,},
+	},
+	{
+		{0x1110e0a533d90e38ull,0x394c8693f558db81ull,0x086febd2c1143f5cull,0x1510ba89207a93d3ull,},
+		{0x52009d1771b23b12ull,0xd0f57ffe502a7845ull,0x20526d8ee8746350ull,0x186d1204b79f7c91ull,},
+		{0xd2e6440e73b9e8bfull,0xea8af826008f5262ull,0x338c973032d12823ull,0x20f6b812f00041eaull,},
+		{0x86c92865f67c79bbull,0x577f814d4450e8d9ull,0x9e98acb09510bdccull,0x0387595c51610751ull,},
+	},
+	{
+		{0x774fe464157f55bcull,0x13e7585606474796ull,0xe0d61588e2adafccull,0x0f67444d5d01321dull,},
+		{0x2fa53866cda7365bull,0x55230d1676307289ull,0x12e3812c71d4fc9full,0x03464c063bc2101full,},
+		{0x09de18aa58d6aa23ull,0x0d0ae1a135791afeull,0xc6dcfffcdfe15c31ull,0x1d0a6ad1986f2df0ull,},
+		{0x94eaee1a8219ff90ull,0xaeebc3e0c3895c98ull,0xf9e08611ce48eaeaull,0x248da69a4c0f45d8ull,},
+	},
+	{
+		{0xf0630d36487242fdull,0xd3bad5c44b4ef1bdull,0xc1b2ffceaa182b01ull,0x0c706933b0b07994ull,},
+		{0x919fbeef85ee9b62ull,0x68c0b8f9696f9d69ull,0x12773eb562848777ull,0x0734453dbd2cd55aull,},
+		{0x37afa72d3bac441dull,0xa4fa87bd8d2fa9e6ull,0xed04b57a5dbc9ac8ull,0x04413ee4815bfed1ull,},
+		{0x85ccd2283d2dac4cull,0x7303a0d244e50de2ull,0x95683b40401cc9b4ull,0x1728a33bd8cd7b81ull,},
+	},
+	{
+		{0x4b2c36ae797780c0ull,0xcd5713400022dc1cull,0x3467f54ad4e3e911ull,0x0e9d3352677f6705ull,},
+		{0xe69fef8abe927025ull,0x99a75f2eae522255ull,0x3a1db93afc7bfcf9ull,0x04cf421ad76987f8ull,},
+		{0x2786ad520c5de811ull,0x99c48f88fcf69197ull,0x28f493c4cf3c7997ull,0x0f57186ea028f8f1ull,},
+		{0x916389f241ac0abfull,0x7058a035d7b5622eull,0x22d4c46ec6b438deull,0x2474102c0e923b35ull,},
+	},
+	{
+		{0x1e1537676b352b7eull,0x6939d084232d04bfull,0xa644d8032891a7a1ull,0x1597eb6898dfd0caull,},
+		{0x3c944bb4605ca451ull,0x5b13836a55689d7dull,0xd5db9de25756476dull,0x1e4c15e82c6cf427ull,},
+		{0x44e672474a2545d3ull,0x92a533faa0b06c7bull,0xeadc9cf30aefd64bull,0x0bc6090b8c1ae977ull,},
+		{0x0d756a94c7764c0dull,0xfed1d3175d3d0dadull,0x358dc8628abda1a3ull,0x0611d6de14f1a8c5ull,},
+	},
+	{
+		{0x5ca01a3dfd5acdb3ull,0xd497ed087a4d3b33ull,0xa3dc66a625b60397ull,0x23952ad0d081b1a7ull,},
+		{0x0667be84165885f9ull,0x5b624189f9d0dbc4ull,0x9f1d2ae03728c057ull,0x08119e71d69f892dull,},
+		{0x36ed96e6995be905ull,0x34bf140ffa2de916ull,0xbaa9a7dd0ee60be5ull,0x0b8b2633820434afull,},
+		{0x029d50346d929bb2ull,0xe661593c051a04b4ull,0xae001a9a8c143f42ull,0x0771809adbc6bbefull,},
+	},
+	{
+		{0x961efacbceaa987aull,0x86039cc49c7b6335ull,0xcd4ab20e2e21f417ull,0x21d1b21368408c48ull,},
+		{0x7f6bab33486b2043ull,0xa59ab4310210eef7ull,0x02180c3384002204ull,0x0945e19f8b794cadull,},
+		{0x8da660c10d7ae1baull,0xf9d11fe02cb6d57dull,0xae1c82b019fb832full,0x0802263fbaff48a4ull,},
+		{0x8ca3443101a0c51bull,0xb54fe1b43e986084ull,0x4681b6289c669e7full,0x182f4918d4cdef80ull,},
+	},
+	{
+		{0x3b5450205aeaaa6eull,0x3e0c701141157953ull,0x85b1aa62f51baf85ull,0x0d9047b3cf30d7c2ull,},
+		{0x1e2fd73d03e6614cull,0x94912cc7c5183c4aull,0xeccc7811caaefbbdull,0x20cd7ce0526d7d3cull,},
+		{0x751ff2d61f10e9deull,0xa1c61fd61590cc37ull,0x441af52c10500d6cull,0x06268f038a1000d9ull,},
+		{0xe17e87677225cba7ull,0x94e22a815fa2c262ull,0xa8af24616b826d55ull,0x0b4e266e86cf8dc8ull,},
+	},
+	{
+		{0xb517e7b22da48399ull,0x109642d630bfbfccull,0x56c278d53585282dull,0x0c6bd6794c1f793aull,},
+		{0x21f13749a188103aull,0x373f514dce5e64c9ull,0x28320e2cf5622b3bull,0x1e7dc6c52aa73cb8ull,},
+		{0x6a018e543d9ddb6full,0xd8782c0238250469ull,0x8bfdbdb16ae62b98ull,0x1f907613b1923d48ull,},
+		{0x0e95ea1c5836ad4aull,0x00b85840f9aae60dull,0x987b59afb2993362ull,0x146264f5b49add54ull,},
+	},
+	{
+		{0x3881c380c9b9e514ull,0x6df14b3aef1cc4f7ull,0x7bf3c04f3885f3d0ull,0x12cde6e6e487f451ull,},
+		{0xdb1cf729066492a1ull,0x6ee561a5fb86eb84ull,0xa0591973da6b30a9ull,0x1803d4f51e5c92eaull,},
+		{0x34b92016a4606c04ull,0x439db4351bd10878ull,0x5fcae6da94fcd4e6ull,0x0c9d2f9e0b6263ebull,},
+		{0x764c529f002a4993ull,0x53143abf76bc8f0cull,0x58772b5e731dcb01ull,0x0c3d4b6fd87c6d59ull,},
+	},
+	{
+		{0x8abcb11b385910a4ull,0x6be5fdd0fd8efc9eull,0x0a48e3562df20e62ull,0x162b7c1d6ad1fd95ull,},
+		{0xb0f9d719df74def2ull,0x26190fee1bab24eeull,0xf9bff826b87c9c5aull,0x1fcce3b5805113ddull,},
+		{0x4e58899d4295a0c8ull,0x08a8b79bc1236420ull,0x52be26c362552985ull,0x21deab6fc30cce7eull,},
+		{0x86b466625a859057ull,0x028bfb11d84f49cfull,0x99eefa93c9c6766full,0x0369a9d98cf6106aull,},
+	},
+	{
+		{0x18a1475cf8e3b22eull,0x051cd9f9f405790aull,0x43eaa9c110b769b6ull,0x0684c1b954a9331full,},
+		{0xe9c5e55a905b4b66ull,0xb0fedca048a7e683ull,0x37b482ab3efcb845ull,0x0e994f62eabf31a6ull,},
+		{0xe8b9912b5556344bull,0xd234a30bbf2d3018ull,0xa8e935ee9bbcabd5ull,0x02460be3e563df02ull,},
+		{0xf342b951f7754c34ull,0xe5952e2d00f38614ull,0x4a9140b8b33a525aull,0x150b945a37678664ull,},
+	},
+	{
+		{0xc2268ac8704bf0a5ull,0x5f497442b3d2fb31ull,0xe5a7b5615aaed22cull,0x0367514862a74391ull,},
+		{0x0e65eb77ba108d74ull,0xe1f5671117707121ull,0x5a68c1cbb8aa4081ull,0x20d7cc0fa4b99c6bull,},
+		{0xe4971ed979953165ull,0xdcd08a8319f2b268ull,0x5c304fd0b303a36eull,0x12e254f194ee1da4ull,},
+		{0xc30cb439b5f7a512ull,0x54cc8c2c76b668a6ull,0x36ff0cd3e62e5d47ull,0x1b1dc728748e1417ull,},
+	},
+	{
+		{0x695a69fd75bf8ecdull,0xe9356cf266fbaa52ull,0x9e18dc0acefd07a9ull,0x177afb988b072a4cull,},
+		{0x16e9dc0efc0347d8ull,0x333a5dcdd91d5b35ull,0x74e987dd58acb091ull,0x178dfd8b26a1be82ull,},
+		{0xf90a09dbdc909f51ull,0x7397a9ea22522c19ull,0x71f328ea2a3f8887ull,0x0086c5b90162dde3ull,},
+		{0x1a72af7616ce44d8ull,0x79bfcf7a12481197ull,0xd5ecc565bceff514ull,0x22dfb060abc7d9e1ull,},
+	},
+	{
+		{0xf8fcf7349c881fe7ull,0x137d9020781f551cull,0x155c85cf0168841aull,0x17ac4efb086b450aull,},
+		{0xb0ab41d646758c55ull,0x198b9411a5c0d328ull,0x3c8144340e7eaaecull,0x0a3c1b2e9f097a37ull,},
+		{0x56cbe39133ba32e2ull,0xaed630b83123d139ull,0xb3308582d8518d07ull,0x0f459be3e22cb25cull,},
+		{0x5396ce71f01f4b02ull,0x80ad4713fc88ccacull,0xa8597410b1ec60f4ull,0x0dddbcc1a7f45dfdull,},
+	},
+	{
+		{0x8b9d1941ce22cc91ull,0x29bbd6ed5f10af5bull,0xd1dffbc4bcb7ea46ull,0x23061822a7971932ull,},
+		{0x77a651cb01538e18ull,0xa3c0a89cbfd6b68dull,0x5fc148f05743b7eaull,0x03f059cdcfc99382ull,},
+		{0xed81e4f3f608dfc8ull,0x1063b3437446d428ull,0xaa507b4c1d0a738aull,0x218761368a9ade65ull,},
+		{0x218dc2f5ad998641ull,0xaa6d5a1eaffba361ull,0x6d445feb5430e81full,0x073d7a684b3cd3acull,},
+	},
+	{
+		{0x4b41e4f697d02672ull,0x10c2e47f9f428032ull,0x8d797e2fc4b3c265ull,0x1d4cb27b13dade8aull,},
+		{0x5f03770388573b91ull,0xbbc8a6102d7cc10aull,0x5342f6bde8dddbedull,0x078964373fda64ecull,},
+		{0xd22445b760cdcc78ull,0x5c6dea61287e16edull,0x15b85ffe2de3976cull,0x1e807586c9778817ull,},
+		{0x0ef02eed647bf377ull,0x61cf3b15222766dfull,0x1a48ccb28800cf0dull,0x0497b43440ab8b6bull,},
+	},
+	{
+		{0xd806e9ca1cfa0f7bull,0x2759f6683bdffd73ull,0x02608125830cfbc8ull,0x153e04ac3d2402f2ull,},
+		{0x2d2f323e79e56ebfull,0x9d9df530520afdfaull,0x305fd197466efa10ull,0x110f73531383f67dull,},
+		{0xb05f09f017781530ull,0x82c4ca1d8b12d0f5ull,0xf91c771c339ccbdbull,0x1f6516eb5e286d01ull,},
+		{0xb0ea661fca4b02b6ull,0x760d2b7e227b7267ull,0x071f61a43a28fa5full,0x1f985ec7365fefcdull,},
+	},
+	{
+		{0xe6d079aabe42256eull,0xfe7f79cfb3b1861eull,0x49cb0a36c75adea5ull,0x06028a775f11058bull,},
+		{0x56af31874709a816ull,0x1ac1cabe5211a77bull,0x7e1df79086aa4128ull,0x146fffc2549cc353ull,},
+		{0x7925ac56c9fc821bull,0x6766374a5244b5e2ull,0x537f42a7f15cbc90ull,0x1359b1ef782917a5ull,},
+		{0x0ae0e7285f666b20ull,0x59d2886993a73496ull,0x9535df18c2479526ull,0x1cfaebccd7339782ull,},
+	},
+	{
+		{0x03fd564bc544220bull,0x85d9100b499944f0ull,0x71e2e0b4fa209368ull,0x10ac1bba2c5140faull,},
+		{0xdd814dfd9d44486eull,0xc410152492526902ull,0x932bb2f0479419feull,0x01a6b30376a18fb2ull,},
+		{0x8a172f3599d21ffcull,0xf0258116975c01d0ull,0xd30e41f3c168352aull,0x117bfbedd7730909ull,},
+		{0x421fda37e8ee7a11ull,0x12dbedaa7e3ce27eull,0x0b6f089a472e820dull,0x10158952857eb1dbull,},
+	},
+	{
+		{0x88c1ff0b65048661ull,0x04a97743cb256fbcull,0xf179b56cbe1c9b9aull,0x1dbb2c7bc0c063ddull,},
+		{0xb2a28813e7299999ull,0x6c5ee28a82e3cddbull,0x35457ff19e3e93d4ull,0x16d69aa5e385d372ull,},
+		{0xaf56725c5da398c2ull,0x14f3b14b27a84000ull,0xb18df5c92a95803cull,0x1bc472e1bfc74819ull,},
+		{0x128953a744b94b9bull,0x56b0f66d564daf9full,0x80952628e53fa619ull,0x049d926c82feb3c3ull,},
+	},
+	{
+		{0x79a9f722a33ae1eaull,0xbae23b10139dd8a9ull,0x4533aa50e5e49195ull,0x1e5df30907f3a86aull,},
+		{0x9f942b16f013d4b3ull,0xef7904e2d1d3562bull,0xacdb7996d20bf34aull,0x1ca1f7ca2322585eull,},
+		{0x05b3eddc3f7a9260ull,0x6a6cff67cc7df47dull,0x9bbf9c61d5f09317ull,0x15fdbf85ec1aa57dull,},
+		{0x00dfecf6de9e5da0ull,0xa070bc4cd8a1791aull,0xb22bbf03b594cc57ull,0x23750d9f48a5eb82ull,},
+	},
+	{
+		{0xbaca62ecefefd75eull,0x3b16249ce900db2eull,0xc20aba7c78ee86a7ull,0x2429d6c3a566f4ccull,},
+		{0x67640701491bd964ull,0x88c00f1035172f49ull,0xb8fb0fa5f80b2d10ull,0x1b7c52c7462fd99eull,},
+		{0x027b6cabc50c3962ull,0xfe716de01b6aff00ull,0xb224900bc6635960ull,0x243ebfaa36ec21faull,},
+		{0x00d92e5c69b1df2aull,0x238f71c5bb6c0ac0ull,0x1fd741b8baafd613ull,0x0564953a7bb056f1ull,},
+	},
+	{
+		{0xbe3f90a2b9593c86ull,0xa475a0b489b25797ull,0x4331cd0ad6ccaccdull,0x0884fea9a94a2b0aull,},
+		{0x7e6b77b9a4e63b21ull,0x8243ca74de2301fbull,0xf46205257269ba3cull,0x071194d050104c08ull,},
+		{0xd6af66b27e3c9c5cull,0xb5025ccfaf82614bull,0x1c1f47de89048337ull,0x05b0f04e3bf8049dull,},
+		{0x13dc97e6e7a760e1ull,0x0d07cc0c5187741full,0x6f008786b966e521ull,0x134b460d985b9938ull,},
+	},
+	{
+		{0xba69fd33169464a6ull,0xe179a95d8975a89full,0xc6b3d9d24408f71aull,0x02440f05d789399aull,},
+		{0x8585618329b6f7edull,0x8549b569f356d8a3ull,0x99976cf1a717d4bbull,0x0e3e252242faf209ull,},
+		{0x1b052898f8897f4full,0x290b204801afe10bull,0xee5fc23733e51644ull,0x10233f12da6c1832ull,},
+		{0xf1a8996f186b27c4ull,0x8349530fc859113aull,0x8f20ef832c2768b0ull,0x1a5fe4290dcc68ecull,},
+	},
+	{
+		{0x835a8956214d7780ull,0x6633829d343aa73cull,0x97ca662303dc7f86ull,0x0421e89e598b73ddull,},
+		{0x6e30b3d6f8ae3546ull,0x21e1dd0a0f24dbadull,0xc6f5acd902993e7dull,0x103cc41a35b57d57ull,},
+		{0x4f780dfa6378a17eull,0x6eaf5f8a3cc4edbbull,0xea7323b2847a7477ull,0x1260288e5a2205f3ull,},
+		{0x9009c2a15652434cull,0x6b749bc8702c7158ull,0x96b6b207b282620dull,0x24c536dada5d9078ull,},
+	},
+	{
+		{0x24074d8634bc5bd9ull,0x91eb0ef66a174e97ull,0x045f453144f5a276ull,0x07372cbef1761b11ull,},
+		{0x98fdbf8e752cb60cull,0x8868e908c8f5edecull,0x9d59725ea01fe36eull,0x24632c63a3b68c86ull,},
+		{0xc3b521d0ed5afe46ull,0x32425ab3c32cd116ull,0x4fc97ea7076b6fb1ull,0x1cab28086e65568cull,},
+		{0xd2036497af4ca5c3ull,0x9003290ad060e7e1ull,0xb7d49b7a7c9b63edull,0x0949ae0a302c44caull,},
+	},
+	{
+		{0x52a21f678416c291ull,0x718edf6a136c705aull,0x3e4d902c0ebff6daull,0x0e9e91278c969415ull,},
+		{0xe15ec62057ad703dull,0xb4779399b970d4f8ull,0x7aa83bb5ca3ba580ull,0x203790004b65bb0dull,},
+		{0xb28155d0b2ee7979ull,0x2807f4714daac189ull,0x89273a74e33749fcull,0x03d563ab3e684d97ull,},
+		{0x665c06800c4e97c9ull,0xac2cc8df850a6c81ull,0x3a38c0a66ea7de5aull,0x0e49c4ad62881580ull,},
+	},
+	{
+		{0xcea0f8d6e1a583e7ull,0xe760774d6d4f506bull,0x39d92af889bf422dull,0x061b81b0b326274dull,},
+		{0xd515a312d51c0ef9ull,0x6b34684f4192983eull,0x8b63d989e2b1d767ull,0x0fc407c4921cb2fbull,},
+		{0x239f5e4f146e68fbull,0xc61af11420cf4f4cull,0x11fa30fbe0c6d6e7ull,0x0192b97e288fc0c5ull,},
+		{0xb6148c0ad425217cull,0xc25a6e017d9cc83bull,0x3b6dee0a69396b94ull,0x0d33f22647d6d851ull,},
+	},
+	{
+		{0xcf4631f7a9d4cf91ull,0x2858687fbdd81a91ull,0x0dc42c48c44de2bcull,0x20df140224e5f333ull,},
+		{0x83ca4497a4ef4a12ull,0x1beeb8b937c03102ull,0xa6df0b25f712e2bcull,0x240260470ceb15c2ull,},
+		{0xe4443ff9ae322078ull,0x8b265e134698d85cull,0x6ef66870eeccdc0bull,0x0964894fd2d2276cull,},
+		{0xd020fdc906fecd2cull,0xec65a8d34ad1e692ull,0x32d2a08729ae7a3bull,0x1344a5d6d6a24e0eull,},
+	},
+	{
+		{0x754f7df4a00b3e5full,0x2f0a8f7ca72f7e30ull,0x1196d90c99cf4090ull,0x0553dda9d40f11d3ull,},
+		{0x35fb3e1921abc8faull,0xac889f1dcc03e8e7ull,0x1d204d8dd42a0024ull,0x07a6445c0dbd985dull,},
+		{0xcc3f13397c3d7732ull,0xa2bd75edf0aa06baull,0x39d752f1fc4c2f74ull,0x1b687f507d6f410dull,},
+		{0xaff32abaa62af950ull,0x10b60312acb32e5full,0x18f78fbabac09695ull,0x1206abfa11c467a5ull,},
+	},
+	{
+		{0x442e341cf78d05e2ull,0xe838a4ee7ad83e4dull,0x0eafe25b23227956ull,0x1452c5b0a5f8b469ull,},
+		{0x694a87c0b7bc7f09ull,0xbcd6ee37bbdf34f1ull,0x8024b42e02d02ec4ull,0x185bec3644e8e503ull,},
+		{0x618713fe61f368b2ull,0xa79ab873372c0531ull,0x30304a30dd12ef2bull,0x21ee788aec9eefcbull,},
+		{0xfbf2fcb130f7b2b7ull,0x87dae65541837a4eull,0x9322331cc424ecd5ull,0x2467e51933d9fcd6ull,},
+	},
+	{
+		{0x506d6f2edb75d4c5ull,0x5c5cfbb865be6843ull,0xcbfcf838e50c044dull,0x0570853308925a32ull,},
+		{0x34d51744370c204cull,0x475cf517cb1c7ac0ull,0xb2850bcc4f1befc2ull,0x0687ee3d61353a03ull,},
+		{0x200ecf2771f87870ull,0xb9ace77352a2f8eaull,0x0582ea1066e0b446ull,0x1032f780ee832ad8ull,},
+		{0xc7570d123d3c5d98ull,0xb102f1c941b3c2d7ull,0x95d721c8ee5b1e97ull,0x0c92eae6f5e051f4ull,},
+	},
+	{
+		{0xc8edd4e7c1b96187ull,0xd13f7ec5aec08be9ull,0xcbd077ff3245aa96ull,0x04dad944bb6cd4fcull,},
+		{0x3958d05bd98ad2f6ull,0x3163c18dd11eeab7ull,0xb6d63e3fb757a0b5ull,0x0a926386a8d00117ull,},
+		{0x0ea9c7ec85da4074ull,0xa455009a6463c744ull,0x7b251ec1d759b221ull,0x165622be814f0ab8ull,},
+		{0x8ad9282a9c0f2af8ull,0x678feb857bad8709ull,0x6a8f81a264112b13ull,0x21879d4d3e1f6f58ull,},
+	},
+	{
+		{0x90544e7b1a237bf2ull,0x27c66d3bec3fd185ull,0x1df712fc83e4d847ull,0x14bc3c90c2f2b526ull,},
+		{0x4bf44252af1eb054ull,0xca1268c5336c1847ull,0x9b66f70a798eef65ull,0x2081c8dbd66349f9ull,},
+		{0xcf98845411ee8334ull,0x7c6024b561b574d7ull,0xf41891f05081441cull,0x2138ce15b3cec872ull,},
+		{0x993b0efde9c60409ull,0x30fd1cf77a953955ull,0x445130742e066aaaull,0x2051c0030a965344ull,},
+	},
+	{
+		{0xa802f6f8a96b3159ull,0xcf93ed012fd748c2ull,0x22a358789f536162ull,0x15cc84d64cccab78ull,},
+		{0x453a85f400ab107eull,0x7d9a0064596e25fdull,0x4cb5cf2f9928ffb4ull,0x132f58fee3395cceull,},
+		{0x30fb241c44e07692ull,0x08382a14565f3c45ull,0x6165e833d3c84e76ull,0x194cc0406f509e7cull,},
+		{0xb33eed490bb9c6d5ull,0xb6d10f7b7ac3b1fbull,0x529f96827d114778ull,0x0ffb9a326a689e82ull,},
+	},
+	{
+		{0x504880a0cd7589f6ull,0xcc18ff956c3916b9ull,0xa6c0ef1da95b7d3dull,0x1628ef81ecec3139ull,},
+		{0x0eb41bd6bd15ecfbull,0x186ff782486c3fdaull,0x72d69e182bda4e20ull,0x08421346795b3e11ull,},
+		{0xd5a076ef73c48dd2ull,0xcc8ed1da6b34b7e0ull,0x1d8455afc26d479aull,0x22fe99046fafcb65ull,},
+		{0x450ae9063d8af94eull,0x193d36897530f978ull,0xe186bddc038ff8e9ull,0x1933bc13d10da8e0ull,},
+	},
+	{
+		{0x4fc94f52f01d1d3aull,0xb4be94d8500d89bcull,0xd59ad25193d471a8ull,0x164d972e55b65b2full,},
+		{0xb5fe7f06003aa3f6ull,0xadcd45bfba02e474ull,0x7d795bff52a691c0ull,0x246d0140c33070e1ull,},
+		{0xb4234e9f7e0ecc06ull,0xe2711bd2644329baull,0x820a80dec814ed37ull,0x1c8985602ab890eeull,},
+		{0x695abc5d2ac14f84ull,0xf7aaa691c70d39bdull,0x3d059f074e81e635ull,0x049eb5467f84ea28ull,},
+	},
+	{
+		{0x5f7725d1198ffd47ull,0x94006860a85abde0ull,0x25800049b9b3c112ull,0x1d5a93e0805f4750ull,},
+		{0x5c6ee3bd70d089b3ull,0x470ec7e98478b145ull,0xea2e06783fb523faull,0x16adbc541040101cull,},
+		{0x45d9fbfcf0146d76ull,0xe423a33b2d83e2adull,0xff57b12559580348ull,0x232c9171d223ff2aull,},
+		{0xab5fb0b307fbbfdbull,0x68002c2d4dba2dfaull,0xc7b9d9bf9a3146d8ull,0x16d29fd3ea38cc80ull,},
+	},
+	{
+		{0x1ebfae50499019f5ull,0xc2772ed2cf02c2b9ull,0xe27b49e838e3c604ull,0x15d43250d1a45477ull,},
+		{0x4b188478815ad9b5ull,0xb0c978e04e89e3caull,0xecd3cf1a962f5aa9ull,0x00f715d288e21d08ull,},
+		{0x3e0b37056cced170ull,0xc4dd7f8a31a01ffdull,0xcbc34bec7f83d135ull,0x042e1f7bded22c39ull,},
+		{0x010063693a4468c2ull,0x13b46c3794bbbdddull,0xfc5fddc21cc9f7d8ull,0x0254d94e738c42ccull,},
+	},
+	{
+		{0x16f4074d613f47a3ull,0x60c430e30053ddaeull,0xd51bfda651bb268cull,0x2375f827cf019d6cull,},
+		{0x45b861648c5fd03bull,0xa308d25ca9352342ull,0x121a42aa293547f5ull,0x05182980711a7559ull,},
+		{0x4df849461a923070ull,0x8ab8befdc0ae46c8ull,0xdd08323da5082d66ull,0x0fc71e7bebea28c1ull,},
+		{0x0845e0af57cfed71ull,0xb5c65421eee418d5ull,0x788fdabd54385505ull,0x01986fc4cc0abf92ull,},
+	},
+	{
+		{0x43083a0eef1e4b0aull,0x2b08cfa119c41fd6ull,0x32821d3a8e177a08ull,0x244151040f65513bull,},
+		{0x033d1fa58e9b174bull,0x4c67eecbb90db1dbull,0x44882dd2b71d16a9ull,0x2186056657ae620eull,},
+		{0x4ed7a7199c804eefull,0x115ea7f8ea43e456ull,0xded3681ce85385daull,0x1f9a9b0c476a3deaull,},
+		{0x185283697fa41127ull,0x670638ef5c7d0c49ull,0xb9d51e438d8bb628ull,0x137e11fad0410b95ull,},
+	},
+	{
+		{0x389dc55a6ae1c393ull,0xffb594db5ac66ec4ull,0x3f831f10a71ccbccull,0x038a17bbb2c4ca30ull,},
+		{0x89c928c8272d7f73ull,0x1c9b7f7b61aa7191ull,0x91f392c926b4ef74ull,0x002a2cca716c8872ull,},
+		{0xfb667b4d3533bcd7ull,0x7e2c471535fb16cbull,0xe25205f2fb6e5e6cull,0x1be066d7a363ca56ull,},
+		{0x9bb20f7d8bd4129bull,0xab7c116fbea86560ull,0xeff4ad018e7664adull,0x13989ed5b8bbff44ull,},
+	},
+	{
+		{0x94a3fc2d4b678d2eull,0x5f5fe336d140d53eull,0x8276a34677fce12bull,0x185eca9895f08e17ull,},
+		{0x3325d0200b113b38ull,0xdecf617573eb8a4aull,0xc217e940605fed39ull,0x08393dffe96fcbd8ull,},
+		{0x48d26d949d8ae2e0ull,0x402b17579582ab04ull,0x373a283f6de5d397ull,0x1877ae3d053ae9d1ull,},
+		{0x780fafcded7a88a7ull,0x05fa97b540d4a3c9ull,0x41c8ec447a72a7e4ull,0x19bb91f449014422ull,},
+	},
+	{
+		{0x9501a848deadfb18ull,0xa5bed1fa2a7462e8ull,0x545a118cc1ed9eb3ull,0x0ecd2e0985208377ull,},
+		{0x0db28234fb8ca192ull,0xbfccdb6060ababa8ull,0x403bcd35a1891f7aull,0x248005d2359840edull,},
+		{0xc8e97e79fcbb3789ull,0xf39bad15594611f3ull,0x8ea0ddfb1bb7dc92ull,0x218f90756efc4566ull,},
+		{0xe6826f76fb97be8bull,0xb64fa042b8cabc59ull,0x88c586c236ea050bull,0x1a86c497b5a5a104ull,},
+	},
+	{
+		{0x0a2e4f92b40d72b7ull,0xaf75c370a17b499eull,0x1c548e4df46ec8a6ull,0x0d1b59c932b16c25ull,},
+		{0x8a3f20bb9df7c30bull,0x355c06ec88147b14ull,0x89d3003d55143085ull,0x0cef41fc2b9511adull,},
+		{0x8388ae73013e5197ull,0x38b22fa21ed06099ull,0xd2788c45fc1c92aaull,0x095c25408e7eb48full,},
+		{0x975e559b424ab0e3ull,0x5d4ec9f99ba13f97ull,0x89e3fe1f9d61f1d1ull,0x1eda3dd282511346ull,},
+	},
+	{
+		{0x4b1cff03ee0f96d2ull,0xaa642fe60ccf89d4ull,0xdd3a02c22cae4aa2ull,0x149da23efc97d415ull,},
+		{0xb2b4b8d16010996cull,0x5dcba05285029726ull,0xb485ed5458bd0dadull,0x0bd20ad00ecfdfcfull,},
+		{0x940085bcfd25c0fbull,0xba8afa0e754e3b06ull,0x9af78a131adcb0ebull,0x208ac5c480fc916full,},
+		{0xbbc13a02fb00c962ull,0xf505b378f04b04b6ull,0x0b1252e3564dcf92ull,0x05ffc9d3805b3a88ull,},
+	},
+	{
+		{0x5950edeaab187b63ull,0x7460df96a18ba958ull,0x7fc4262cb534814bull,0x0a1e87df2573e541ull,},
+		{0x0b06e297fb5a6888ull,0x03bf34db81f3d181ull,0x62041b7a69396d65ull,0x03eeac25ad823948ull,},
+		{0x93bebe6cde8de553ull,0x6423665a5bc668f2ull,0x843e18b2e5dcd40aull,0x02b5ef99724666b9ull,},
+		{0x31770af269810e8cull,0x167725f7bb6db999ull,0x06b9c4710c76ebe7ull,0x125d0ae1645b2a28ull,},
+	},
+	{
+		{0x656a86430bf50888ull,0xe0f5d36919503d77ull,0xd897e3dcbc659301ull,0x0d8f4948f3020c21ull,},
+		{0xd6600aad86a34723ull,0x894799fd04cfec10ull,0x0bb140585b1ed097ull,0x23ab48c65840db3aull,},
+		{0xc109822346ee3747ull,0xcc7488c5fc250e40ull,0x67858c457498dcb1ull,0x037e9f2cf0038355ull,},
+		{0x1c86fb4cc9c11d46ull,0x6e3d73986bea1444ull,0xa3298992dc3275a2ull,0x0863671eb66e143bull,},
+	},
+	{
+		{0xc39acd4feed373d4ull,0x4694694a8c696f5dull,0xa9c4a911f2839738ull,0x0b76c14685f011bdull,},
+		{0x2f7c4b8992581c5dull,0x27186a53b2f27574ull,0x347c97acee13acfaull,0x0d6cc6214b1dedb2ull,},
+		{0xb0833292df494506ull,0x474e01998c54e566ull,0x146dec2510925e45ull,0x1a5ca0bcd0664288ull,},
+		{0x78ba05c2dc2ffa01ull,0x3c8637644ba4e91cull,0x7744d585a3883fa2ull,0x0d2b863dbd809d56ull,},
+	},
+	{
+		{0x6d6075893eb1e01eull,0x272369f5a76438ecull,0x4644b84ac49fa86bull,0x0eef7e8158771bfdull,},
+		{0xaf33cbf006514c94ull,0xd53e82e1365ce504ull,0x5e8e871fd3345c79ull,0x07fbb368460117b5ull,},
+		{0xd8d2777c7e11577bull,0x4a4ea4b4a81de81bull,0xb02a5b34f5915a54ull,0x02c8187501517db4ull,},
+		{0x8d8b920625d5df3full,0xa1988d6093a2813aull,0xd9fe9caffa89dda9ull,0x20a4f4d4222ac4b8ull,},
+	},
+	{
+		{0xcf6d4a94c4e65d99ull,0xfdf0a43554460197ull,0xea0dcd1cb5e1c73full,0x09df816c4ef8e210ull,},
+		{0xee6d70906221928dull,0x78a3b6658e92963dull,0xca14970101d5e571ull,0x177ba4cbbefff158ull,},
+		{0xa5b04989bb08aaf5ull,0xa637199e6db5d125ull,0x672b100b3222f6d7ull,0x1e57a8a63a37f1edull,},
+		{0x0f72446c068bc1a1ull,0x268b32d7054ee45dull,0x1b13d1653b6a35b3ull,0x11998133f1a1ba3dull,},
+	},
+	{
+		{0x692d040a2924e200ull,0x56b9cc4b8fb824d4ull,0xa8caf8493c2aaec1ull,0x20115fcf6035bbc9ull,},
+		{0x4de8833aad49dbf0ull,0x880a0e76096c3445ull,0x670348fb82c709cfull,0x1d8416a44151efddull,},
+		{0x7c1e32af7e7a5675ull,0x17da3895af999fc7ull,0xfcfc0c1e1e6cf88cull,0x16ad708c5bdf1360ull,},
+		{0x5ad52655bd73d8b8ull,0x124e7568f2e8e872ull,0x10cb60b5b022e641ull,0x24b85a449474f5a2ull,},
+	},
+	{
+		{0xeaad819499e77128ull,0xd138c42d422a7420ull,0x5fa2450cc9bd019dull,0x1fcc21ad73e476b4ull,},
+		{0x295844cb0ea00eaeull,0xd55cb9a3d341f3c4ull,0xe955d47700f74940ull,0x1e2ddcb8c0b6fb60ull,},
+		{0xa7ec53391df2f674ull,0xc8a5870950bd20fdull,0xeecdbeccccc40526ull,0x1bc5f77b491c81b6ull,},
+		{0x31f787fe00fe6bd0ull,0xbf24be7b3c78e531ull,0x7e95055af13cd8b4ull,0x159d0cdc436d9f5eull,},
+	},
+	{
+		{0xa66bd044c8568e24ull,0x3172a7f21d8b7383ull,0x63090be23fc280ceull,0x04203b949c1e11bbull,},
+		{0x974a870025fc6f09ull,0xdf3de741373f2e6bull,0x50c4b7dbca2b7875ull,0x02d7e6eafbb6ecd8ull,},
+		{0x3ae1395a2c55fb00ull,0x7a3d84a33b542a2dull,0xb342aae8efc33fc1ull,0x0fe3bb951c9d9451ull,},
+		{0xb170492617e14996ull,0x8ff9566e58c1b040ull,0xfda3b40f99d9b2ecull,0x1c0b664b3323083bull,},
+	},
+	{
+		{0xb8d6ab9c26215b4bull,0x4fb3dee085a8c78dull,0x394a0b29d5906602ull,0x188e7f11f3eed32full,},
+		{0xe0a0b62ee01b8332ull,0x88f783767d6ba373ull,0xeb1d0c549aeaf7afull,0x20938093460f49ffull,},
+		{0xef95b1340fdcc1b9ull,0x2c47b8d1cc09c9beull,0x93507b5abed16d2aull,0x03644c8e63f6f962ull,},
+		{0x6f27ba4e87b06760ull,0x15f9314dc04f3721ull,0xa00fc81433f5f936ull,0x15a0c6a77f931cddull,},
+	},
+	{
+		{0xb42168e19bab7188ull,0x3864e85b51d20054ull,0xd1ba965243101427ull,0x23b6703e504cfe51ull,},
+		{0xc830d985cc88882full,0xc793a8b6415e6bcdull,0xd61928e626a305c5ull,0x0fc5bdaa73f727c1ull,},
+		{0x312f84ce0383d0baull,0x440a2d623a1c47a2ull,0xaa53b5f14b1c165aull,0x14bce2f786ba38f6ull,},
+		{0x729b5b24f78a832full,0x878b09fa56e0b1c7ull,0x8576f33697dc0d70ull,0x02dc3add6285055cull,},
+	},
+	{
+		{0xee4606e9b9527c00ull,0x53c45b6a3e817ac5ull,0xb1e14ee52b9d8b30ull,0x07c882287389acf5ull,},
+		{0x35964d16bf140facull,0xab541943f8cd9fc5ull,0x28a30e1f3fd9927cull,0x01ffc8517e33db59ull,},
+		{0x45382802fe366e52ull,0xe2406b9e7ab3392bull,0x47e62fa5129b58ebull,0x05eb1672b48236f0ull,},
+		{0x40f88347e5b9cb6eull,0x1591efd174b562d0ull,0xe73fb6fa8c7eb464ull,0x0a75874b7653dfbcull,},
+	},
+	{
+		{0xae8fed3f95acf7fcull,0x4c3c36696e1c7820ull,0xa08e3723902f7b35ull,0x12fe8f0c2eee95caull,},
+		{0x35c28a64cecbfe07ull,0x3fa00adc63d27dd9ull,0xe1a22e198d848d25ull,0x16549b5828c44feaull,},
+		{0x8c0e0a5c01cabf0full,0x6df96f23d7dd97d5ull,0xb320d19824c10f42ull,0x01d3cc70ff705aadull,},
+		{0xa2b829c5510bf50full,0xe60625fef3a1e7ebull,0x6215d148d737bde4ull,0x2344bb3939997da8ull,},
+	},
+	{
+		{0x74091d3d7d862d67ull,0x4b6b528546fe8fc6ull,0x6d50f82540e08821ull,0x0894f40a8e498af8ull,},
+		{0x2aa75fb2cb80ebdeull,0x172218934db21022ull,0x29b8b1cda18991f3ull,0x12062924aa10b211ull,},
+		{0xa8a67a189d22b039ull,0x724bbafae2f81d11ull,0x47685e0e2ed953e9ull,0x0b11932cebecac1full,},
+		{0x632d6669d8c29539ull,0xd8cea0f491f8a7e2ull,0x185b9b05f24bd44eull,0x1b5023a50254aee1ull,},
+	},
+	{
+		{0x9a7f5fc205201875ull,0xbaac1e7aee7f1067ull,0xf9e9a5ac32e96c22ull,0x1ea0a2f128a41993ull,},
+		{0xc47d4b68c4901d8bull,0x11759f392099f758ull,0x3b49a51458a3c26bull,0x16b939723ffdba3full,},
+		{0x7cda82e3bc54bd32ull,0xa0222688a85388feull,0x51144d173f3d3ad3ull,0x1d0e86b2fdff7bf7ull,},
+		{0xb7b7115cd7daa355ull,0x9bb3da9451eeb172ull,0x53112fd5b895a639ull,0x087843f7032feed2ull,},
+	},
+	{
+		{0xcce9d985c78c61c1ull,0x712842d875a32897ull,0x0a524acdc3240c38ull,0x0f25a817b771259dull,},
+		{0xa14f36b0bab81dc8ull,0x4361629c2b0fe9e2ull,0x2afcf9d08a9f76b6ull,0x144073353f47b6deull,},
+		{0x5086708016e68eceull,0x903998f6da468392ull,0x3242e68bfdb4ce4aull,0x1dbffd039b3e4639ull,},
+		{0xe8c1a747d176411full,0x05491d41f207fc65ull,0xd4791a97fd61c8d5ull,0x0897622b45e63382ull,},
+	},
+	{
+		{0x58499498121aa855ull,0xbad35bbffaa26145ull,0x2101bbbc4f54a344ull,0x0851364a022d17bdull,},
+		{0x617b12a0c7ce89caull,0xe88b26bbe27c4732ull,0x448a29ad62f6e240ull,0x0c9cccdb5364eab1ull,},
+		{0xc7c623a9851ab206ull,0xfdf35ce5a60aa692ull,0xa8e5c264f7900ba7ull,0x146de798ca1ab06eull,},
+		{0xdfc47c2a273ca332ull,0xff35a4d5f35239b2ull,0x9f35899dda0a7afaull,0x06ccf7798cfab45dull,},
+	},
+	{
+		{0xab84f5d1f4553ba4ull,0x3722ee2cde1e6960ull,0x26fc871f5d3496e9ull,0x1bdbabe3f8a12ca8ull,},
+		{0x990f0789cfd380fdull,0x755feb164f0547c0ull,0x7425b562bb33cbd9ull,0x0c2c33d7c384282eull,},
+		{0xca74f8b61c376a92ull,0xe2ac4176dfaef195ull,0xcc2ddcba9ef4c9efull,0x24d4ff14e9ed6f4bull,},
+		{0x0cc854a8f879b350ull,0xe9402d29c354a37cull,0x5777ed7fd292cba4ull,0x07f5475b24077c6aull,},
+	},
+	{
+		{0xc6088429b6a05b7eull,0xf2b1288ff3e24696ull,0x3d4863c0bdd42a06ull,0x07895ce38bdde1f4ull,},
+		{0x1a7042376b5af161ull,0x1b3ec6bbfbd0ee1cull,0x16bf28f59fd29cb1ull,0x217ea8cf8e4ca91cull,},
+		{0xef0be7e3d13eca36ull,0x5dc4e1ff3e005b33ull,0xf76df19b5ca44dbfull,0x04033be3ba69d6bcull,},
+		{0x1696daa3e48732b9ull,0x4a147b8dac43066bull,0xe06d92466355feedull,0x1337f651fa82247aull,},
+	},
+	{
+		{0x5a5639cf9295a173ull,0xa9e4358c7209e075ull,0x70b31e6c80db51c2ull,0x0d4d32cde1262e90ull,},
+		{0xec5f05e8f6d22ac8ull,0xc60f373c59917137ull,0x6216fdaa652fa08aull,0x17602ffc90fbfb68ull,},
+		{0xa140f6e6e17818d7ull,0x0825042e85b5ed5aull,0x6bdd30b1e125b745ull,0x0518492b073c466dull,},
+		{0xf22d7da5e644f2c0ull,0x55018779077e8228ull,0x2bd1ea216f7ca83full,0x2246ad1668c973d8ull,},
+	},
+	{
+		{0x6bda936d10f3d3d0ull,0xc3cccb1d1fb9c796ull,0x83e159fc3992cc3aull,0x1a02cd6e296b9b75ull,},
+		{0xb71f15bf7cde4556ull,0xb9ed173336ff83d6ull,0x51109d67a559058aull,0x03639386d2b40e87ull,},
+		{0x9d739324eda87748ull,0x7116572ec6d799eeull,0x47f433779f05c4faull,0x1f027d80077d8560ull,},
+		{0xef956b8b1cc4a2c3ull,0x1735d35bbe2fee5cull,0x16684071077f3402ull,0x09795e5e909e0016ull,},
+	},
+	{
+		{0x1101c0e1a6a31fe2ull,0x0b50177d2c4763d8ull,0x6c2cdc69c915a86aull,0x189f7124eb40f71dull,},
+		{0xf312c8a31f6b227dull,0x86460621b9e6034dull,0x2c80ab6613e0a76dull,0x124288be1905eba4ull,},
+		{0xd4f43bbe9472d607ull,0xaabd43c7290759dbull,0x40ca8e22566e941full,0x17918336944e43eeull,},
+		{0xdd5287908d58d7afull,0x4afeaac499a3b01cull,0x6e532302488fdce9ull,0x2508fe47a4047ea2ull,},
+	},
+	{
+		{0x2a9323b55c6cb17dull,0x5717fd24a556d6f4ull,0x83f9138f88b63fecull,0x0520907677414567ull,},
+		{0x00619d2128c94cf0ull,0xdd4b76b180b59d85ull,0x2b39eed6c27534a5ull,0x1f22e46ffb53818eull,},
+		{0x9724881cb42ffdbfull,0xc1691e9f68e012ffull,0xb0e6ea723650ccfdull,0x07974d94b8660684ull,},
+		{0x37a8b39866dfe8f0ull,0x055593e39d63c565ull,0xf247b2e23e401f72ull,0x03b59fb340f9f2f9ull,},
+	},
+	{
+		{0x94bfd414bbb9dd06ull,0xc40f57a7466fba5full,0x3115b848c517a450ull,0x190aa6d6b28fb802ull,},
+		{0xbb90959368290826ull,0xd133823db3bac2e1ull,0x1bcbc418ce40b486ull,0x0a74e4f98a99a486ull,},
+		{0xe8655e0eea8bafadull,0x1563a92b3ff244e8ull,0x0e8a7701a5a5509bull,0x08175937c0305365ull,},
+		{0xcd2a218736c2d7b1ull,0x308fab00f28c5073ull,0xd34fec15db7af257ull,0x24c2ed40b60748fdull,},
+	},
+	{
+		{0x8c958bf28e81e2e0ull,0x9089c8b509ccb3d3ull,0x5d95ba185d6890edull,0x0c9b47c9040b94beull,},
+		{0xdc859273f90934b3ull,0x950e2d2f465794f4ull,0x980076b88fb036c6ull,0x13e111df7e906a20ull,},
+		{0x3432e06c76a6ef8bull,0x196aa545234caed1ull,0x3c151d4d9ca12f7eull,0x1d1b719b18921fa1ull,},
+		{0x7a1fb14efd563518ull,0x85b7fc7b651b7a89ull,0xba8b69fb197745edull,0x1f0a902f8a7889ecull,},
+	},
+	{
+		{0x6ead1076d3bfc8d0ull,0x00f286b4c9ea72d0ull,0x7f74c66409f42db7ull,0x217dc808dafeec9aull,},
+		{0x621370e963ad6566ull,0x1923e16bd5dfeda1ull,0x44265baa7c325962ull,0x13186ed1cb1c96a3ull,},
+		{0x476f8a5010c792f4ull,0x05f054f0ff40f7f4ull,0xc9944ea36c7675daull,0x02c28f4122ea2d4cull,},
+		{0x300f122a66fcf4a4ull,0xc64dd388620b2415ull,0x3cfdcc2c65bd4788ull,0x05bbd89312b6fc31ull,},
+	},
+	{
+		{0x163787ed28efdb40ull,0x432ed840fe882a54ull,0xca596e3629e404efull,0x23cc5b0ae1341facull,},
+		{0x3bad382c45fca125ull,0xecd019acf44cc537ull,0x7a8b3600f44bd48dull,0x05639e0693831e1aull,},
+		{0x53c4a6977c6daeb4ull,0xc5cebe78a883d250ull,0x6d48aae0d21f4146ull,0x17ffd6ba8e9c8eabull,},
+		{0xe031d98e407c173aull,0xf99c9a2d43039292ull,0x92b66f315ba5cbedull,0x15fef002a2b7a054ull,},
+	},
+	{
+		{0x826c32e94fd7a40bull,0x74dc7ec4bf76e1b0ull,0x6a354f7263f9a752ull,0x24c36d611913e887ull,},
+		{0x639702de60677be0ull,0x0cd8272e12d8d733ull,0xb30743a3dc4f4171ull,0x225e266328cbfb29ull,},
+		{0x099edea58ef73dbdull,0xde680130afd33867ull,0xb6db49ffebb71fb0ull,0x0708b9277fe0c62full,},
+		{0x2591181dc0b1ea01ull,0x854aa3e97403b313ull,0xe8af228b3d58e726ull,0x0207ade27cc0b79dull,},
+	},
+	{
+		{0x406cafbf86262defull,0x8cc085329b0fbd4dull,0xf35264eb3b6d7f7bull,0x12507368b40bf596ull,},
+		{0xab422b3e260409baull,0xad8d98083303c6bbull,0x7ab7bc692b204dedull,0x05dc068633d4c455ull,},
+		{0x98354be60bf601d0ull,0x6e5cc1ec69254c15ull,0xb7b77cbfc35360ebull,0x2133908455dbcd32ull,},
+		{0x0c0aa1c89f2d3b65ull,0xfb0bfe68d8085120ull,0xa82b7ce1aef14077ull,0x1c6b0cd30353063eull,},
+	},
+	{
+		{0xadfcef5725f5b11aull,0x06c9e7a5f797f1ebull,0x462218ac51306237ull,0x173a4b4bc1a9ad36ull,},
+		{0xbb8b2cc779cd2efdull,0x3fc65d1474420f5bull,0x2a676bf79ab40692ull,0x04339aae77186d99ull,},
+		{0x210e76b9a792f211ull,0x1c6fb2062859ae8dull,0xeafc47ce14cd8345ull,0x2072b99aef16bf47ull,},
+		{0xf51333c6b20d3241ull,0x7b9bac381a893495ull,0x705b428f1377b6d6ull,0x01a7b6664e160602ull,},
+	},
+	{
+		{0xbae61cfb987427e0ull,0x0acfb51dfd057d28ull,0x9a9400d1de5f59b6ull,0x0651e1de44e153c5ull,},
+		{0x2c7bc92b1564235cull,0x93f705fb3183ddd4ull,0xd1f00bbf7c144e05ull,0x01fff2ff0ea73d26ull,},
+		{0x5267060ab3062930ull,0xc323d47dd3b30d1aull,0xa609e9635c7bdce3ull,0x1e80c4a1c4c76b93ull,},
+		{0x2cfdf14396dc5250ull,0xaf6cf7f57d352d05ull,0x4c9b9e2602b18f01ull,0x0ef9172118733a66ull,},
+	},
+	{
+		{0xbe24a633973729bbull,0x72416d15d6c0dd45ull,0x541650f7a19b1d3dull,0x18428dfe6a0e1a8bull,},
+		{0x7a22c1b90b2e00ebull,0xc0c4ab3787058293ull,0x6479865be9cab5d3ull,0x116ca266905624c6ull,},
+		{0x42050047e8ca98a2ull,0x3488bcc45bf6e67eull,0x839233a63515d8caull,0x015c6b7aa0c8a455ull,},
+		{0x60cbbbd81fdf2d59ull,0x036e09219e94961eull,0xf504f030340f8c78ull,0x0f8373277396515dull,},
+	},
+	{
+		{0x016c1f262040bf03ull,0x9b7ed136945aeaa8ull,0xfd85562e33fa01b5ull,0x16cdb5eaed0c1392ull,},
+		{0x0764e3c5f09b7821ull,0x2266306256f8ab0dull,0x66ff43bb51e39b90ull,0x219ccb59fdbb7a9cull,},
+		{0xd2343e8a24d1e801ull,0x5b33efb5c15d7174ull,0xa489cb8b339ba5bcull,0x2198f355b4c08342ull,},
+		{0xd08e17dc45a24660ull,0x3e7820ddbce40086ull,0x1e03ced25e571b37ull,0x08935eeb1c2a4b6bull,},
+	},
+	{
+		{0x1dcb5b1cd1057cf9ull,0x4a8e76fb76d87722ull,0xae36e45541507ed1ull,0x235dcad6c2d7a84dull,},
+		{0x3e140ba5532ed0c1ull,0x1eb05b763031e2fbull,0xdfbcd737e7db9c7full,0x2429a7196eed4dcbull,},
+		{0x8ab42b38b5ac0996ull,0x9bcd695a21d62626ull,0x27ad3ffe473e3475ull,0x08facdc5104bd256ull,},
+		{0x7fa220d158cf426aull,0x504552bfeee08f3bull,0xe2ff551dd17b7db1ull,0x1fd704cafc284f68ull,},
+	},
+	{
+		{0x79d88c8cf9d8e1e7ull,0xf7ee6359ac0f291full,0x3e5063575b1becf1ull,0x1c0d4d28e0db854bull,},
+		{0xb4fbe45f7ef6d073ull,0xe046555bc5027336ull,0x30ec26f957efd8cdull,0x04be5acb6202328aull,},
+		{0x8bae5adca548298cull,0x1200ec430fae77a0ull,0xea98efec8a285ff2ull,0x18e9d054f4ab0993ull,},
+		{0xc8ce3788c61a254bull,0x2fdec0ec04beb290ull,0xdadaf415b2e58aa7ull,0x03cc8fb8c97e6806ull,},
+	},
+	{
+		{0x6002afe12ec99cb0ull,0x6395fcf149931c74ull,0xc0c86e6a6c60f804ull,0x1e914b1675919fa5ull,},
+		{0x9b31cc1b9fac59caull,0xf35563a6e947d71aull,0xb79d40d5f26ab103ull,0x044d42b1888a67beull,},
+		{0x3d8df32f1882f84cull,0xaf15b8086af21408ull,0xd3372341d9d4edbdull,0x084dd24aa5bb3578ull,},
+		{0x2fa026d943f796a7ull,0x51a4467801907e58ull,0xdc9b74e7e5be902cull,0x1abf6046788c27cdull,},
+	},
+	{
+		{0xe10783b6572290d6ull,0x0508c0d41270ff2bull,0x2e9659c5b18b92ebull,0x03e0ec449fbb4fc2ull,},
+		{0x7f5f01a5378d6ad9ull,0x004d9cae5ddccd88ull,0x241db0116876e516ull,0x14365b8881fcc3b2ull,},
+		{0x70a4317ee18d9b86ull,0x29414b00e845589cull,0xcf343cab40cdf0f8ull,0x1f36a6e597c443aeull,},
+		{0xd1195f7a8f9b6483ull,0x2b4bfe391a8f8462ull,0x40a9a74ec1088dddull,0x14e2a542a96d9be7ull,},
+	},
+	{
+		{0x8f7d023113e2e1d0ull,0x893e6aea484d7d16ull,0x7feb0efc1b9b78c2ull,0x00e9db0a37f46f62ull,},
+		{0xa3b0b589f89c26eaull,0xa45c31d30ab3049dull,0x0109e45cff0464eeull,0x0b98fb773dd9d63full,},
+		{0xc2d1520c65fb8a81ull,0xee9c454d0d134724ull,0xa354bc7687ede9e0ull,0x16dfb4d297a11126ull,},
+		{0xaca66916354f520full,0xc6615be655a23a69ull,0x5345018fe4532076ull,0x204476a5f0da3c98ull,},
+	},
+	{
+		{0xf7ab2cb4c1716d9aull,0xae143faa45736e16ull,0x64272eb3b6b8b353ull,0x02d43dd34fc01aa2ull,},
+		{0xc604339c2bb91980ull,0xcb3fee5123647316ull,0x80bf45cba90ae58cull,0x00a3ca349b25f74full,},
+		{0xf0397603a2b35afdull,0xc196c4fc51801b9cull,0xd2fd305f0761bc5cull,0x06e6127b6c729645ull,},
+		{0xd690797fb27fa56dull,0x0406841a694429faull,0x083ffdf025b18ed9ull,0x23c758472009ee50ull,},
+	},
+	{
+		{0xf0fd7eec5e187b94ull,0xe66996fd0280322aull,0xb1a84aa715cbea81ull,0x078c298b7e21d571ull,},
+		{0xd11b7429af4faf91ull,0x50865448cf1ea5d4ull,0xeb5638a9a88053bfull,0x1824a60774467fb1ull,},
+		{0x548566bfae083b66ull,0xa3bce35dba10b6b4ull,0x030f0aadb0feff6aull,0x07449c182ec07df9ull,},
+		{0xec58509153ad7a8dull,0xe9b694485597e4a0ull,0xd593d49f5ac46a37ull,0x022afa7d4c3f6932ull,},
+	},
+	{
+		{0xa35d9a32a3c88b72ull,0xba3e26a6132f43e9ull,0x6766c11e643c94f7ull,0x19ea1e0d0a7e75e1ull,},
+		{0x0fbd1728cbc4feb9ull,0x8c97a74d653ef01aull,0xcd51d2c5add824e8ull,0x0d1af18794bce2a9ull,},
+		{0xf22ab6a73bd7f060ull,0x5b5e4a5d91233259ull,0xf3c440d4ac18af4full,0x1b39bd08da3abea1ull,},
+		{0x0685284bea2626b6ull,0xc9ccacf86e760b4aull,0x574d1a6218e6a0beull,0x009de29cfcb0cb78ull,},
+	},
+	{
+		{0x134fe19e84385937ull,0x9c10e63b378cc8fcull,0x22aa6bdd9c8a6373ull,0x1ded1b0e3701ba8eull,},
+		{0xe63f0d947c36450full,0xda885f499be19750ull,0x6bc3e4e272cab1f3ull,0x0cd5a6ebbf1cf8fcull,},
+		{0xbe1ccadcf419d798ull,0x7b240f0156abb9e3ull,0x924b39eed94ccc80ull,0x02648a621379225eull,},
+		{0x396567abb37b1c09ull,0xb6b461bc79a6ef10ull,0xaa79707f480db7d3ull,0x21c590032388a11eull,},
+	},
+	{
+		{0x35e0b631bcd7b9d8ull,0xd3a59567b4317afbull,0x4c98efe7a357bc2full,0x168d4a32cda10c60ull,},
+		{0x3670f4a888d20eb8ull,0x008a81eaf7e91b19ull,0x62db008c4e695cc6ull,0x08426028f809ad83ull,},
+		{0xec2533eda2e97d42ull,0x835f2c4031999814ull,0x50db97e5ec0f2937ull,0x05f2130660b8f054ull,},
+		{0x0991ba64c2377ed3ull,0x8bd27649e831b767ull,0xc9d3dbf612d439b1ull,0x197fdf630ab08d92ull,},
+	},
+	{
+		{0xd94820e1439840d1ull,0x881a2e6a4b57124cull,0x7b463591e694c700ull,0x051f7b95883cc71bull,},
+		{0x31f5cd42df36edcbull,0x9edf9e63c230ebe7ull,0xba5612ece39e2450ull,0x1f0a876dc5df18f5ull,},
+		{0xa5efed24d020d291ull,0x51e8f1d28acd1fe0ull,0xfda850ef2d7a678dull,0x17a278c6f0aec201ull,},
+		{0x3b3dd7c86f446a10ull,0xec75924077436c64ull,0xa1d51c55fa0a4b52ull,0x06b0fe4ae7308fb2ull,},
+	},
+	{
+		{0x86bb75b6132e4147ull,0x36cf9d060dc20340ull,0x4e959a06a645aff5ull,0x1666e8f4c8cd0c8aull,},
+		{0x647b949f6ff3996aull,0xeb97befd1e9b8f0cull,0x85d24ba7ce8e6fa6ull,0x02eaa8818195e7d1ull,},
+		{0x8eb2bb8840545853ull,0x831c8c2ad9a4977cull,0xda6d6ed2a8e2b5aaull,0x22f85fc4f10aa02full,},
+		{0xe765aa3f347019e4ull,0x3bbbd034a8c55205ull,0x57e33b09c1f17177ull,0x071e3a1ec47104afull,},
+	},
+	{
+		{0x585fb98ab5197907ull,0xbee43f952a5c2b73ull,0x0a3b02f2ea9752e1ull,0x1e1dcc31c4fc1b9dull,},
+		{0xcca6806bb87c40d1ull,0xd7fd9e2099a6d262ull,0xe0ff50d2254f7c93ull,0x0811b983258cff19ull,},
+		{0x3cab6ecb96068acaull,0x3b68bd48cd3650d9ull,0x3b14a56b67c2f950ull,0x0174c2250da468ebull,},
+		{0xd7f33a81ea6a5a70ull,0x5230ad2173dc4760ull,0xa68fc104b6920e3eull,0x184c1eb15b21da40ull,},
+	},
+	{
+		{0x69d6eb0797451865ull,0x759c3a9f58af84d5ull,0xdf3d9abc092257a1ull,0x1f973c076f4342eeull,},
+		{0x04b4cc2fbfb3b4c5ull,0xd75a5da0afa1b3b5ull,0xb0ef1ed5b8855f17ull,0x0df07bbb8bc40704ull,},
+		{0x0bb158198a2728ddull,0x41961b929b09241full,0x6350c53d48bb2361ull,0x07a9bf2cd360df86ull,},
+		{0x3d225b55c7b29af1ull,0x97b53dca4f62ff96ull,0x46721fc7999d8d1dull,0x053e44f4658099f2ull,},
+	},
+	{
+		{0x1dcdb065987f2169ull,0x5cceea93e5ebc2b9ull,0xa14c421c5b6af4caull,0x19797b7088ee283bull,},
+		{0x09fdfa8aaa7888d8ull,0x3aed694d22767432ull,0x64c9f75613231062ull,0x191fa412e74ebe33ull,},
+		{0x7e1853d61ba0eb81ull,0xd3884ba240e637ebull,0x03186c20a5ce1739ull,0x01aff70e7b835778ull,},
+		{0x9b9d768267f78499ull,0xe4b838db65eea034ull,0x4502c1c96c9aff78ull,0x043307e260e892fbull,},
+	},
+	{
+		{0x5bec95a6254995c3ull,0x334ceefbef967d66ull,0xf855c4a61f5672e2ull,0x0381b5dff0ba215full,},
+		{0xfa6270d9178f55e8ull,0x0a05ad22934633a5ull,0x6bf6243495cbe8bbull,0x1d0b0b7c24a4fa0dull,},
+		{0xfefc49ea853dbe0aull,0x837a7274665bf8f8ull,0x88f9ad134672c99bull,0x02913d91da6f067dull,},
+		{0xb95a36050b92278cull,0x37aa6db4ec7f69f5ull,0xe9250267fc71a28full,0x073a01d7db46664full,},
+	},
+	{
+		{0x4542d76e1dee21c9ull,0x8f87faae3a54c209ull,0x27d5a487dfdfbda3ull,0x0d4b9e76abf9a57bull,},
+		{0x546401fb29fed781ull,0xd5345d2ded6007e4ull,0xe7d5bf74ff48953eull,0x19fc87b9378fca17ull,},
+		{0x09c2b6e9db1b82e5ull,0x2c637b79bd194f93ull,0x9f92ff92ee5fe7caull,0x1852ce323fb43177ull,},
+		{0xd919398767caea43ull,0x2d13262e325ef57eull,0x3ebf659fba23441full,0x125164ff0fa36f25ull,},
+	},
+	{
+		{0xd531f9034e629b64ull,0xe3796d429a5edc6full,0x37e4309d3fdbb709ull,0x1cdbd5dcc9b32bfdull,},
+		{0x5aeaa25356dcd90cull,0x3bb717f91c7a7bbaull,0x9cb1a39cbe3921a7ull,0x028eb4549302cb6aull,},
+		{0xf869d30686428e89ull,0x6cd2ab12363e1d37ull,0xbd4ad3d6dddf4d6aull,0x0a0b5b91156c7125ull,},
+		{0x895dc3d61735588eull,0x61a1b6a90ac6732bull,0x3f9c866f914706d7ull,0x152288196146cc8cull,},
+	},
+	{
+		{0xa65c9755796fd18bull,0x5983bf59532d8716ull,0x205aae0ca7a13930ull,0x0f72aaf7e513d980ull,},
+		{0x5ab20102ad607ae4ull,0x7076cc81efaf21daull,0xc5c9936f9c1722a6ull,0x17f3b43d70c9a900ull,},
+		{0x025fcdccd4853c36ull,0x856158096767e377ull,0xdbbfe6efcfea875bull,0x06a220798a0cef41ull,},
+		{0xad5906ed8a37ff97ull,0x425386a5a1a59676ull,0x4ef0f2fb2108ff17ull,0x032e9cf65a0a5c94ull,},
+	},
+	{
+		{0x3d76f24204c4681bull,0x9f59d31009332732ull,0x39d15554fcae43f4ull,0x05181be8265e5ed4ull,},
+		{0x6021b3bae9eb6fe9ull,0x0230cd8b6736a27eull,0xf555ac1633ad27e5ull,0x02e25e7cae01c496ull,},
+		{0x32102325c8f72564ull,0x42678c8271472d93ull,0xa3dee42d9375b34aull,0x23f5bb5ac41c4465ull,},
+		{0xdfe378f735a99578ull,0x1ecb58cc290c471bull,0xec733e53026e8571ull,0x14eddd4c91cc14c2ull,},
+	},
+	{
+		{0x419bb3c403228831ull,0xbe85686b34935509ull,0xec27d41464caf9c3ull,0x02d6c48ba3d8f7d4ull,},
+		{0xbe5253a265f6b8f0ull,0x5a57b25dd86754ceull,0x2f0926817d78e557ull,0x19b087a23e4eca60ull,},
+		{0x8a2a082f71060df0ull,0xdcf6b39b64b4c2c2ull,0xca075387df90f616ull,0x21730554bc0591c6ull,},
+		{0x12288836efc4a22cull,0x31cab9ae7dcfcff6ull,0xc5e4b5d6ef5f1979ull,0x136a633e4ab68c81ull,},
+	},
+	{
+		{0x30f3a2ca3ff9d2daull,0x0f8dd4c833c986ecull,0x83162f099f98c34eull,0x12fcaeab68cd0a98ull,},
+		{0x249ea9150be5b254ull,0xdfa8e5d91345c816ull,0x291467b3ccbe4bacull,0x15d98747605857b3ull,},
+		{0x4238992f27b36a80ull,0x1e45e4e3ee7f6835ull,0xdd4a0eb09e417567ull,0x1ad0bf419677b764ull,},
+		{0xc567cae625ae95f3ull,0xf4d3d31f5b8b63fbull,0x935464b9104ca7bcull,0x16c5150cbad70273ull,},
+	},
+	{
+		{0x9201bcd71460f52cull,0xa354db5b8e58065eull,0x12d2b37e88e46e48ull,0x0ab408358313e647ull,},
+		{0x9b469eb0350f8ce1ull,0x669e50adbc254a8dull,0x2826e68587d5bd78ull,0x07e190a4f332e8fcull,},
+		{0xe3c5d09adb94d2e5ull,0x8e468076ab31c5b3ull,0xd56fff5cb67c2f94ull,0x098753ac816e6266ull,},
+		{0xf113cef503de58deull,0xfaad81a2a61a6accull,0x9a45be5188549550ull,0x070dece5957695abull,},
+	},
+	{
+		{0x988b738de43c9c5bull,0xcbba6d4ae7273dc8ull,0x58eb681b1d1d33abull,0x15a31bdae3ba7a47ull,},
+		{0xf8a912fdd3c124e0ull,0x078d97bbe30d2512ull,0xa14b048e697f684dull,0x11b5f02e13aa290aull,},
+		{0x7a4e2dd2d3a4fff2ull,0xf32f61519b6f24a7ull,0xc123bd9ddb5071bcull,0x154659fd7e97b840ull,},
+		{0xe6923257770a0fe3ull,0xa3252406565b8e81ull,0xdf7b5e23a876a2b8ull,0x161d009e6b2694ffull,},
+	},
+	{
+		{0xa96a95ec39813ff1ull,0x7b7014ec453d2ddaull,0xab68d867223b4386ull,0x08d8c8a79bc0661cull,},
+		{0x7d2926f09fbb832dull,0x246bb170dd78b1e0ull,0x6aaf517104448249ull,0x214e51e9c397cd8bull,},
+		{0xb8a8c7495ad305e6ull,0x5ddb2a4890650cb7ull,0xc876fd1671288ff4ull,0x234903d183b275a2ull,},
+		{0x4b654ddc6a067c6bull,0xff4f9c229fa339c2ull,0x3309a7fc8947760dull,0x0807d90bd33d81ceull,},
+	},
+	{
+		{0x34241cadf6d66d35ull,0xbfe142fa381fe8ddull,0x23977c3a98fad6f1ull,0x1d51a512230411fbull,},
+		{0xff5f2202ed684b51ull,0x2eb8855d6b53989bull,0x291d0b7514ed91b8ull,0x01e0bffa0a6fb00cull,},
+		{0x86689fde00f9b1ceull,0x4c79e782c9af7335ull,0xed75c78b4f011928ull,0x04108a02e4d42cb0ull,},
+		{0x2e87c07b194f7b4dull,0x52051862c826283full,0x89ae74bef4b0c2a1ull,0x0aa29c61c85c0364ull,},
+	},
+	{
+		{0x4221ca0aeb7d6695ull,0xfe17738fd6bcc068ull,0xbc0200b378e99453ull,0x083dd397091f847bull,},
+		{0x6a0b01a0ca99821cull,0x9689e34e199836d9ull,0xde981d27a1bc3f67ull,0x06fab964b14db33aull,},
+		{0x0a0ec66de891a89full,0xbea78ec72a74d72full,0xbac13e46a85f2427ull,0x1b8be7aabeb6d472ull,},
+		{0xa5430beccc5b2dd8ull,0xa7ad6b0943025f91ull,0xad2cbf4774c775e3ull,0x0b7184b720e8e16full,},
+	},
+	{
+		{0xd71d755615f1a1cbull,0x9ad522476e722661ull,0xd016292c47fb500eull,0x04b4a18af7fbe7ebull,},
+		{0x4b3b4a7f21b99a0eull,0x45535723b89b290dull,0x5fbf544d3c26daa6ull,0x108c562cb103cceeull,},
+		{0xb6c0dfa3fd7defdfull,0xeb00c74b5444715eull,0xa7dc87b4f66147d5ull,0x20350e85937e0426ull,},
+		{0x925356620b5c0b6aull,0xc173ad6a6b07673dull,0xa8fd28366deba81dull,0x229ef4f6e7914fc2ull,},
+	},
+	{
+		{0x0cfb39af221e4f4aull,0xbc560833cd3e5af1ull,0x2adc3b608015a3f0ull,0x0b3365ad929951f5ull,},
+		{0x5a244156da2522ccull,0xdfada9c87c0a0c20ull,0x7568f329ff24020eull,0x00722aad3dfb25f7ull,},
+		{0xd37525fb539aa705ull,0x9135edda63264f52ull,0xd3545228843cc1b8ull,0x07ca52ed8751f10eull,},
+		{0xfeef1ae1a32708deull,0x80cec1dce32e6aacull,0x1795495a51ecfbd9ull,0x23b504db62f81f6dull,},
+	},
+	{
+		{0x4afef766623714ccull,0x3d72a088e91ae60eull,0x8e2e59907cce1be4ull,0x24214901312406e1ull,},
+		{0x0bbbb02656e35c90ull,0xad12180da2cbf0d4ull,0x81692c47d9ea64f2ull,0x0e32d14cb05815f0ull,},
+		{0xae61a0190cedbaa8ull,0xa55cb9f76eee363dull,0x8fd49e696814436aull,0x20142d994035f755ull,},
+		{0x766ad3e5d551c31eull,0x5519252f090513fcull,0xceb32b2c093d665bull,0x188efc21842c8342ull,},
+	},
+	{
+		{0xbb82295ef6211c0dull,0x5b976cf91edfad85ull,0xdb339f21a31eb9bbull,0x011fcc4e15da4b8dull,},
+		{0x7d213bb1bfa36ebaull,0x6a7dec38d888977cull,0x0c076dfba7db72b9ull,0x06f2527a12f4681bull,},
+		{0x8566fb4568e662aeull,0x386cc2409059e0cdull,0xfeb9a8dbefa05968ull,0x24f7459f5bef7b1full,},
+		{0xcec1453070276c14ull,0xefb6e04ee1829cc4ull,0x9f7d0dab6f262841ull,0x1bb3c0194906d8d1ull,},
+	},
+	{
+		{0xa36b1905701bb4a3ull,0xed24921d4346c4a9ull,0x3568687036291938ull,0x1b0a9671057660d4ull,},
+		{0x730e4594135c50a5ull,0x1acbeeceb4e844a4ull,0x38da4fc36e232423ull,0x0910c7a943679040ull,},
+		{0xa4e1acce84ee8a91ull,0x8f9e8e0509825fbbull,0xbbdb992c4a952361ull,0x0011fc0c77f9ec70ull,},
+		{0x6fd75df2e9d319baull,0x5aba97766663c5daull,0x41040e6baf218b74ull,0x13d5d707d46c33c2ull,},
+	},
+	{
+		{0xfd1bd54e520e6545ull,0x23b5dd81cce723b6ull,0x6d0f4fbc65fea818ull,0x173effb8f9f78992ull,},
+		{0x352cc4c82bfaee27ull,0x992ab90ba911362bull,0x6d0377dc3ba65082ull,0x1929ba05e11c2a3full,},
+		{0x1894c529315d6d78ull,0xac6877fee496e32dull,0xd8cb2203d54fa184ull,0x0b436b5a81a49df7ull,},
+		{0x67d9eab264fe565aull,0xa2837f27d6947b94ull,0x88cf3f8058403227ull,0x18456d71e8c4e7edull,},
+	},
+	{
+		{0xe292ab89b6eb145full,0xb0ff71f2e9325c38ull,0xaabe32da96ed457cull,0x204b10b908e7278full,},
+		{0x0af18634f47dc221ull,0x1e81236cce339fa9ull,0x9c4c25adb56454deull,0x0462f5361f375bbeull,},
+		{0x3b100b41d8ebec9aull,0xc4a94bba79dc9e62ull,0xa94c7e1c570675a8ull,0x0c5710feb9befe37ull,},
+		{0xbc3016fce61e10eeull,0xf790dc996c68d344ull,0x6f20f2729c719d96ull,0x099890d679de150full,},
+	},
+	{
+		{0x669f88624ed47e11ull,0x699f7c0662bf116dull,0x913c0d26de83b602ull,0x0c512744c3cd0179ull,},
+		{0x8beb334cb422096full,0xb822f8817842b6c7ull,0xd1c86429eb51223aull,0x0e72965f0d005e62ull,},
+		{0x6339351abcd4d23aull,0x7448716fdd1bd8bdull,0x476f750706d433eeull,0x1bf8e73153c5394bull,},
+		{0x62b721c64116b1b3ull,0x88b5573197b06f44ull,0x15befebda2a08f1aull,0x1b39fdda8fa5d169ull,},
+	},
+	{
+		{0x3dcb8b9c00e534cfull,0x12e0d226d1004920ull,0x71ddd16144102c68ull,0x019ae9fdca4481ecull,},
+		{0x0e5a90ceb8db90c3ull,0x5b0951d8c7b5b0d4ull,0x9033d4eeffa7248bull,0x04b9e3a8a7069addull,},
+		{0x264000e95bc58c71ull,0x25ed3509e2603075ull,0xe65fb894895c3419ull,0x062dac944cfbc7a3ull,},
+		{0x4b1469b98472858bull,0x4b359ce6a1b76a08ull,0x6d46d6649b6f99acull,0x14fd7a6543710dc3ull,},
+	},
+	{
+		{0xb0f7020cdf6f1e3aull,0x5e412a6bb76d3618ull,0x3aef453aef3df84full,0x1914b203897d7d8eull,},
+		{0x5cdb28e7c800afc9ull,0x5d27f807d5743ef6ull,0x11abe29b0abeada3ull,0x167bcff026c68d19ull,},
+		{0x9fa9e3d4e6940c9aull,0x958f4e19a405f31bull,0xeb5f443510b043eaull,0x17fd3ddf9751fd20ull,},
+		{0x578b2a15986e0420ull,0xd864a54aba991a69ull,0xa2e0a77c963897c5ull,0x025fbcc54a35007dull,},
+	},
+	{
+		{0xf84988e24cfa73cfull,0xc1e8fe489cdb31ebull,0x0c7d0468aafb6473ull,0x2397f74331fe8700ull,},
+		{0x9be7d393825ac9b5ull,0x02f9cc5287fbb7f5ull,0xf3426c8cddfd9008ull,0x1041aa5fde45dcf5ull,},
+		{0xa62e86f18296a761ull,0x1761074f3f5bca81ull,0x7f960d0acbc173f6ull,0x164ca3ef82422775ull,},
+		{0xe7efcaefc96c5fa1ull,0x29aa24bcf8ac5a54ull,0x0de496dcbc1de42aull,0x2110e359c34ecf05ull,},
+	},
+	{
+		{0xc91b51806efc2c8aull,0x28b890690b3cdd3cull,0xbec8d2de110799cbull,0x1b9e112436d92f81ull,},
+		{0x0e7b7595c63249fbull,0xfcec18fb156e30b7ull,0x02b44a6cb4c2ec7dull,0x1be926a1e4d9b40bull,},
+		{0x8cf48f0f1e9e7918ull,0xb8293b3ae4846d68ull,0xc7df915b499874ffull,0x03ca8742c4e40fbcull,},
+		{0xc139ff0b4b370fccull,0xa08f86cf9dc391c3ull,0xab9841031d1da9c4ull,0x204fdf7d76d9643full,},
+	},
+	{
+		{0x810dc5dbe0a575b6ull,0x4ada14f16cf143a9ull,0x2dc1baf73f689156ull,0x1cc0adce9ac97662ull,},
+		{0x39177ffc8efb64bbull,0xd7da2b7e139862b7ull,0x6391124abc4457e9ull,0x0b0f083331d5ca01ull,},
+		{0xd180da2d79e70671ull,0x9164bff8ab345582ull,0x5bfb52b7386d3978ull,0x0bf1b50ad37cfa36ull,},
+		{0xa47d18a8d230326bull,0x24124a13e3e08dc7ull,0x619a30d4ce9e6050ull,0x04520a7fbfe466d4ull,},
+	},
+	{
+		{0x1b4b185e86e9a85dull,0xb29ae7c75e5588e6ull,0x94e72589fc9ea8f0ull,0x1cb87b6cfc10fbc9ull,},
+		{0x4c13af22f42b9f6cull,0x4a3349038ada25c0ull,0x4a5898d412aa35aeull,0x0779d2db7592b491ull,},
+		{0x11b27d92b52b5dd5ull,0x9dcb24352fc4b762ull,0x0e5da9425803c2a6ull,0x0796e0a85c7e3659ull,},
+		{0x2b441bea28779a3eull,0x703fe72620451b8aull,0xde63baa269c76e07ull,0x046bab260c1e3c5bull,},
+	},
+	{
+		{0x318cf3523aece819ull,0x2e9417df5328a50aull,0xfe9abcac081216d5ull,0x0c91349677ca3289ull,},
+		{0x331dc4fce3576e5bull,0x649ec3d639d70710ull,0x48ffbac1f8e63d84ull,0x0dc5c62e10c1d47full,},
+		{0xc79de0216e9821d2ull,0x7aee9feb9b23c382ull,0x211ce466adc2718bull,0x1f0a08626769262aull,},
+		{0x79d709d6673ffbf1ull,0xc0df7b570d15ec48ull,0x83e9cc9878f99e95ull,0x0b3bbc682f9ff6cfull,},
+	},
+	{
+		{0xb779b4f57e5e1a39ull,0x2aec94fb0ed8cadcull,0x4cef77acfc452ae5ull,0x16397398aeb410b4ull,},
+		{0xc30898416a53aad6ull,0xe3ac1493098b363aull,0x2e4c157e8d302c87ull,0x07de4a4bb7fc2672ull,},
+		{0xc8cb67cf723ee745ull,0x46f84e196a610a68ull,0xabd01e0df76ba901ull,0x082477b5fcc94203ull,},
+		{0xe5f967c9e61bd630ull,0xc5061ac20319c8d6ull,0x411bfaf3b338a78full,0x01d509d6aeee7e21ull,},
+	},
+	{
+		{0x0484fb1a2ba5df58ull,0x5cc9bdb118eecba2ull,0xde5cfdf2203ab2e8ull,0x217d569e8b19270aull,},
+		{0xb30f88bd2c853633ull,0xf82a2cc5a739823bull,0x59ef88596880cc4cull,0x09b99faaf088e65cull,},
+		{0xdc93f0f815e41874ull,0x876b09c9067477e1ull,0x76abc5c492aa740eull,0x12862bb01b86697bull,},
+		{0x1f37b70195b3c17eull,0xf89c5686e50c12daull,0x952cfefb4545d203ull,0x1432270bfb8dbc09ull,},
+	},
+	{
+		{0xc10b6439b7a9dd5dull,0x2b671188b10d9f96ull,0x856c8896d59c347aull,0x2463609f8d471081ull,},
+		{0x53a955218b025f1cull,0x36eb740b0ad4a653ull,0xcfeaa5e9babcbe49ull,0x1714cc2af9d209a3ull,},
+		{0x13a7194c8776ef5dull,0x61fc58b2758623a1ull,0xa239f4347809f1cbull,0x08bcaa1527117463ull,},
+		{0xd5bbfebd89e78b22ull,0xc2f254c450e2227full,0x2df860b43e83b658ull,0x1402d5028bc25fa3ull,},
+	},
+	{
+		{0x33422c2734b4e1baull,0x220253078adfee19ull,0x67bdb0154a86b369ull,0x098863f2928f2630ull,},
+		{0xd4c79fc9859b3399ull,0x55249ae58f405531ull,0x3546e39fd8b763aeull,0x02c06517b3759a42ull,},
+		{0x7cd87c504affe700ull,0x8a8d5665e69cef9dull,0xd4be01c613083fb5ull,0x151fb63fb187b741ull,},
+		{0x7090abcea48dd778ull,0x652a54079cf4582cull,0x521296032352d2ecull,0x0c36ea80990e646cull,},
+	},
+	{
+		{0x63e9647885bd30a8ull,0x375e76962dcad43full,0x03a0ff0153caeb71ull,0x14d3082f80b18188ull,},
+		{0xe0af0024b0089bceull,0xacccf4715424b2afull,0x8458bde4b1134329ull,0x06f9163f371cb54bull,},
+		{0x5e8d8edc0d7a9105ull,0x53fff3c13fc6ca41ull,0x6b1e5f3b28af263cull,0x1561698aa186ccfaull,},
+		{0xad78c56f7e8c2b92ull,0x97472a853c62f1daull,0xc604ffa2d8daa973ull,0x17c361c3e2451048ull,},
+	},
+	{
+		{0xf75a6dd85402469bull,0x1014ca50556dd1aaull,0xdc1ef856eb10fb5dull,0x16784a980ad5237aull,},
+		{0xc6828177fa4c65aaull,0x595f4bfbe68a86d2ull,0x02b27039534d8285ull,0x10a3bd7772f17a45ull,},
+		{0xbc157814afdf74beull,0x9b9de24b262f95c3ull,0x91fc05e939b7a048ull,0x051f1c771d5d2921ull,},
+		{0xc2cafd2c68c5a10full,0xe6279e8b3e5ef0a5ull,0x90ed3891596c0093ull,0x14c93c785b881f04ull,},
+	},
+	{
+		{0xdc24b0224e41e9ddull,0x3051c5038c87b38aull,0x41a2a8f3456a8b51ull,0x09dd3e52ce3c04c3ull,},
+		{0x4f1ff4e421621fdcull,0xf4a28b85617a07b7ull,0x38111e3e52c07f20ull,0x23390742b93ab9faull,},
+		{0xd8cfaca063962b3dull,0x237b6b394d425efbull,0x2073aa9a4d4e868cull,0x1dc67bfc80deeca4ull,},
+		{0x4115adc5e406888full,0x5d5956a1272785e9ull,0xbb97e331d19a3e0aull,0x01dcb1a7567dc6b6ull,},
+	},
+	{
+		{0xfa2aa3ba24cecac5ull,0xd2da7bc4c8dc26deull,0xa9e1f272d4091c14ull,0x0b456e92743c9ac5ull,},
+		{0x5b5120570585c2b5ull,0x1f62c7a449274cadull,0x9a976f18463e52d3ull,0x1ae6287ebad9eeeeull,},
+		{0xd4ad641f93d96cfaull,0xb755cb0df8cdd81aull,0xfeacfeb2255551acull,0x22c250a8083a1075ull,},
+		{0xa1ad72738fc4e022ull,0x1e2b9febcfd8e030ull,0xa6d3194954d0594full,0x0ce21b74736bd141ull,},
+	},
+	{
+		{0xbaf0d3a1a5ea7810ull,0xbeeb02a3cb875d56ull,0x2fa0f09e4626f933ull,0x18f9563ba41a43a9ull,},
+		{0xaf5dfc7f3f59e537ull,0xeda8436481a69057ull,0x6057ba2d3305f0eaull,0x0c8d06a1deb0df36ull,},
+		{0x9c965f09e25d8de2ull,0xd0ea054b2f17ab12ull,0xf2b3217bc0c68430ull,0x05fd41f01564cbf5ull,},
+		{0x70075fbde2440b81ull,0xe89be5b915d6d6edull,0x1e94ae91b2ed6906ull,0x128e98844e1b9a43ull,},
+	},
+	{
+		{0x85a41dbce898a1cdull,0x2dba05f5c5b87f80ull,0x04bb6e8956dfb31dull,0x09c3782b13f7e4cfull,},
+		{0x129fad5ef7463565ull,0x007252ccf993b8caull,0xf83be699584d96e3ull,0x084b7363087de74eull,},
+		{0x56310a217ee9caf1ull,0x7221cd3e0ca4ac15ull,0x554ed242e762f568ull,0x1ce9696786b2ae09ull,},
+		{0xf7891328a98584bfull,0x70703f5252aa5e18ull,0xf18617b6f1351636ull,0x05d778477f2c59e9ull,},
+	},
+	{
+		{0x10b248890a9074e6ull,0xc68fc357cb21da4cull,0x3d0af769fa185facull,0x0fb48eacec10af58ull,},
+		{0xeb16770609d7629full,0x335715da68c16570ull,0xf58ef23406111decull,0x014d891f33aa86cbull,},
+		{0x5a00bfbea0888669ull,0x92db90e30746b1fcull,0xdffb98dd1b390b0eull,0x11b9bf2886df38bcull,},
+		{0xe3a158303d355a5full,0xb3dcc0adb2206883ull,0xb87af9ecf1ca01b3ull,0x1ff89f904747d312ull,},
+	},
+	{
+		{0x45da28387857111cull,0x7349d65fb728691dull,0xfd6ff959db643575ull,0x1822bde2646806fbull,},
+		{0xcf3ab62bf8c164f3ull,0x0cc09157381b74e3ull,0x3f7fb54423d6e41bull,0x1542be4c31bf0b73ull,},
+		{0xd2d5d515f42a933eull,0xc2011b5141b68d3bull,0xc6854f515f6508a2ull,0x1030109c2f2b4134ull,},
+		{0xff903c5aa63cd215ull,0xa4a8ee94c39e6310ull,0x673107c3df216942ull,0x12cf77f826ea1c5aull,},
+	},
+	{
+		{0x4fa398b137fbd42dull,0xf73ae07d371bbbbaull,0xbf99ff60f70dbc8dull,0x00b18325dfdc8a4dull,},
+		{0xd8d5fe367f248941ull,0xcc312f32e0b2a11full,0x85d876e3ed2ef254ull,0x2114bfbc15325a6full,},
+		{0xfc42229dbe973aedull,0x3442af16531eeb9dull,0x7b25a824e73c2021ull,0x0bf2e8f063ea163full,},
+		{0xd740b064632cdd98ull,0x62823f7a5633b0eeull,0x914e882ade12ea5dull,0x07f47794d9ced033ull,},
+	},
+	{
+		{0x9b1843954965699aull,0x7527c7309b8db3f8ull,0xe5590f7eccb9968aull,0x1bbaedbb790caaa7ull,},
+		{0x3755fc44f72d1426ull,0x1376e1a322149d58ull,0xc876ea0597bf53cdull,0x0789c33649afa29cull,},
+		{0x08d6d677c505343dull,0x4181a9aaa2561e8dull,0x7e7d224f4f2423cdull,0x03a89e8fc0240ff4ull,},
+		{0x77f451b6fd8cc026ull,0x61cbc30e03ab4bebull,0xd4ea153e751f5d42ull,0x060a19e3b80f2d18ull,},
+	},
+	{
+		{0x902089b655576b93ull,0xb59137978b8842f2ull,0xb9848d47723f0ac6ull,0x224de9fc00863d87ull,},
+		{0x814b8abe8103a486ull,0xa6ebdced0a78b6edull,0x7b7fe471bb4be407ull,0x128c69c512b7f5e1ull,},
+		{0x5a74b6b73d914cb1ull,0xace0ad9ed2c14cd3ull,0xf970cccebb8c4dc4ull,0x09b875d99ff4436aull,},
+		{0xbb10594e1a58793aull,0xed27509aefbc066full,0xa15ac85fdc97e8e7ull,0x133fe27314a9e3d6ull,},
+	},
+	{
+		{0x1ba2a091a5867d41ull,0x2e0de0d7ccd3b414ull,0xa3b85647a8689405ull,0x1bdf2bcaf1ed5e48ull,},
+		{0xd899498869409ca8ull,0xeb8acaf1b1e17c76ull,0x2ab82e214933aee3ull,0x0fdf571678ccff43ull,},
+		{0x951dd1081aa79509ull,0xd749fbbfd7f36621ull,0x7a24300a68631210ull,0x225cee888442ecb4ull,},
+		{0x1264acbb579c3c2aull,0x1b52d35a5ebbe37aull,0xb455f2f289345a43ull,0x0cf630e767552ca9ull,},
+	},
+	{
+		{0x6d059d7e0fe1c852ull,0x785deb4f8a48064bull,0x901e7d39e4d554dfull,0x11a64987ae8e870dull,},
+		{0xd365067ee85e1be2ull,0xb2bb852c6129c504ull,0xe8f396a3b831be53ull,0x12ce86ca1e98ba8dull,},
+		{0xc69f3fc71b5cb521ull,0xeada541bd3318b23ull,0x8e940fc86b7c81c4ull,0x10995f57cd011f5bull,},
+		{0x5f415cfa97993d5dull,0x9cca50e170d2503dull,0x1e50c158d8766dcaull,0x0702fc411df8c0dcull,},
+	},
+	{
+		{0x22e95236ac1dcb8eull,0x19c8a021a5defb9dull,0xa486d29e3c66e60eull,0x0c84752a5ee15dbbull,},
+		{0x3b3101e25c0f4acaull,0x3683ce0f6aadf740ull,0x1384dcb64b3b685dull,0x14fbe3629b161f69ull,},
+		{0xc121605361714aeaull,0x1e40e88c025c7bcaull,0xd2c27fff4960311cull,0x0be1e75e21788752ull,},
+		{0x4ebb8f2c8956f2c2ull,0x86ba0d27c9d70daaull,0x3b79d241737e5895ull,0x223e418cc9ec03a6ull,},
+	},
+	{
+		{0xefb0d6a9636a86bcull,0x24dae506c8773309ull,0xe7f76a2db4b1bc35ull,0x0d5623f077f20cb8ull,},
+		{0x96e56467314b9c5eull,0xd44797450a2e9606ull,0x8846aabbf2ed9738ull,0x0490e7f8da7967bbull,},
+		{0x2a34a439e488cc05ull,0xb5d220d49fbbfb03ull,0x029ebc8f1a758e8bull,0x08bcf97ca0b97815ull,},
+		{0x024cc495d7e12dc7ull,0xd22c9f7b8cc64902ull,0x833f600720c24280ull,0x0f8e1d924b655ee5ull,},
+	},
+	{
+		{0xfd161321529e6bc8ull,0xfe002c748e93d531ull,0x927b9df2d3181dbfull,0x0e0b4a2737098b69ull,},
+		{0xc170bc54359cc1b2ull,0x38584778c44d99ebull,0x9556a1cb2706c091ull,0x195b2411b8179ce8ull,},
+		{0x79d6bbc818001fc2ull,0x9c9ac0497597981dull,0x429dfffc6f9cf74full,0x0706578742087d69ull,},
+		{0xb33d34a5eae9cf4full,0x93cbf74ae66f461dull,0x86a883b6f16dc75bull,0x1b2b719df7eabeeeull,},
+	},
+	{
+		{0x09374573f30421eeull,0x9f966af6074c7b8full,0xb1d379115942dadbull,0x1e8405882ff7afa4ull,},
+		{0x01818c55fe03f807ull,0xe3e5e019a7d3162bull,0xf6f2e2dfb94965fdull,0x055840226d2fc5f2ull,},
+		{0xe584766ffa7d15f2ull,0xf7d71cd61e3048aaull,0x347d45876d092cd6ull,0x2400b441b3e664f7ull,},
+		{0x40b34d9937aaeb0dull,0x90a7d7208cf9ec7aull,0x1e3032fad6ed0fe8ull,0x154928da5485cd3bull,},
+	},
+	{
+		{0xad0b3a8853f60980ull,0x175693cb0cc36604ull,0x0d2cd1bfc0463259ull,0x02d568bd5c086c18ull,},
+		{0xec2cc8cecdbd7d12ull,0x359bf93cff0e4dacull,0x30d72c71a56e59f3ull,0x19eccd1b15e5dc3aull,},
+		{0xb8e0716bc00a1cebull,0xcd6f5e7af2e097a9ull,0x6aefd4df02205842ull,0x08526c21ccc138d5ull,},
+		{0x0f21b3762ca49706ull,0x53cea8c9127d8a99ull,0x43f5bddeb1fb9bddull,0x0a052c2cfc1613acull,},
+	},
+	{
+		{0xf61b78babf182f42ull,0xfea1f01ae8b1f2eaull,0x5bd7f6e1732a0727ull,0x0920d4868b2335d5ull,},
+		{0x260a73040f4092a4ull,0x698279655a3de910ull,0xabc67ab36af9ef89ull,0x10df7463609d9fa2ull,},
+		{0xe79731e8619dfa98ull,0x93d526e714f9b270ull,0x062cd313327bea28ull,0x224be04ba72cca99ull,},
+		{0xeff16c0721fae469ull,0xebb28d20709d0507ull,0x602846aa179fdc8aull,0x0c836afabb98374cull,},
+	},
+	{
+		{0x7e667b5bcf6ee5daull,0x937fa9cd496d0e41ull,0xa2c7fb0736a432d6ull,0x11a297f8bc5c43bdull,},
+		{0x1812294bdd95c1eeull,0x69d228398802c0f8ull,0x7b89a08c6628a062ull,0x01092c31fef602f2ull,},
+		{0x078c85f62dc6ff0eull,0x11b9449029b0d2b3ull,0xee617f2590857ec3ull,0x023f55b54e6838eaull,},
+		{0x0aaf619b53a57001ull,0xf336b3773d1f7e89ull,0x670521b57b42b09dull,0x06a7a0af085d18d4ull,},
+	},
+	{
+		{0x013db1ef576aa90full,0xd70b78e2d8d37409ull,0x9cd53f4888e71fe3ull,0x0d1de5c30075d41aull,},
+		{0xa43341e5fe330e17ull,0xa89f2f8cce05b5c0ull,0x6233cae1204acda7ull,0x0988ad317e123cfeull,},
+		{0x927c6953a6ac7771ull,0xcbeea124033662bcull,0x6862909383cb5162ull,0x20d5fc7598aaa2e1ull,},
+		{0xdd217458bf662903ull,0x0a79046b504f257dull,0x2550237821c29e02ull,0x16af9571240a4a3dull,},
+	},
+	{
+		{0x70f8c15a218b196aull,0xe4af06b609416b42ull,0xe38a41facdcc9953ull,0x1c01db2c5218545full,},
+		{0xa8277cf70e34a06eull,0xd8c9f6e5a9fb903cull,0x6ee24b4ed177548dull,0x1613df6638588777ull,},
+		{0x76ca0cd0b2316c68ull,0xa46d6eacc3a8056cull,0x57a8449295299b96ull,0x24fb915b3b83694eull,},
+		{0x0fd0b9521fb5eeffull,0x1a69a88ce025345aull,0xc81f4b46b909c80aull,0x12d744a848284665ull,},
+	},
+	{
+		{0xe327432a34e7f34full,0xf6b9707f55b73affull,0x5a53129f8680c9adull,0x1b4c1ea7d25b2c12ull,},
+		{0x19c6d3958fcb431full,0x26d6066e2c15e462ull,0x008e3e44256f7b40ull,0x048047f6aa7c1db4ull,},
+		{0x9b023c30f83eb1fbull,0x22fd791eeb06e37full,0x48eedfa0255b66b7ull,0x0de970510eb03530ull,},
+		{0xb523e0db181d5e4dull,0x50c45aab5efb1b69ull,0x1db8bdfa464301aeull,0x20290a53c50d6845ull,},
+	},
+	{
+		{0xbb0d16ecfedddf9eull,0x615edb74c051eb8eull,0x14638fec066b127full,0x24fc1a07994689f2ull,},
+		{0xfcc6ea035a077fc3ull,0xc93aebdc5f5eb39aull,0x9d8d224b0bd6eb73ull,0x057eb937e9cb08c3ull,},
+		{0xb304172aaf9551e4ull,0xbfb51a9cd7a46bcbull,0x001a1a60f14436cdull,0x0a091176e5ef5432ull,},
+		{0xa195babaae78348eull,0x684aa301c23472a6ull,0x4d0d9f9b370c8315ull,0x0d4319e706babb81ull,},
+	},
+	{
+		{0x65387bde84055048ull,0x375ea6e7ac70f874ull,0x4826d299b889617aull,0x186537679c098478ull,},
+		{0x2658df8cdbd62e18ull,0x9d4056ff6e94100aull,0xaab00d0ce190ea1full,0x166783b707edacebull,},
+		{0xc77a01ec6684a8f5ull,0xa8d8cf8bd1e10828ull,0xd37d5eb9229e045dull,0x13080b66e5ebf2f5ull,},
+		{0x2e1e8781f65c97b1ull,0xa6386e93c1c5ac9cull,0xc948b0e08e10e5c0ull,0x171d19b17cd9055full,},
+	},
+	{
+		{0xe1bca9a02bd25b6eull,0x9731f45cfe587bbdull,0x137ba43ac2e7a743ull,0x232e236033eff1a3ull,},
+		{0xd2a0072a19601028ull,0x14f6003507e96965ull,0x667a4ecbc74d8dd7ull,0x0caea6d0d4d7f3e6ull,},
+		{0xf496ddacb1ce8bdcull,0x613fb31cff8cd5e5ull,0x93d0b7abc3977828ull,0x217d899be10ea82bull,},
+		{0x0873dda1337235edull,0x349acbf7620bb043ull,0x126fab78876b3850ull,0x15ff7929a3aa7d8dull,},
+	},
+	{
+		{0xd37188a91b88472aull,0x3816712732d28f73ull,0x1be66d84b9762dd5ull,0x060fc826d0298a2full,},
+		{0x2a6a036613205314ull,0xaaee63d418a892afull,0xcb4b7c86e983ed97ull,0x0a3c5e79713d4cc9ull,},
+		{0xa1471ed22102af27ull,0xaec39d0485ee732aull,0x02bc62512b1b393bull,0x0ec081ec9a999a4eull,},
+		{0xbc5a5b2445524c01ull,0x1b8f048d5e849b60ull,0x2da09356b82d9003ull,0x147c790657789d29ull,},
+	},
+	{
+		{0x8661972d3ebecc0aull,0x5131549b9ec2719dull,0x98778aae8031c11eull,0x07c618ba7849ca09ull,},
+		{0xe71aca7407e209b9ull,0x9c5718534722f1c9ull,0x32897fd67910c3dcull,0x0cb9e7e9a330c4ddull,},
+		{0x0aa0373bf68f8f6aull,0x0a19db66f5cbb4c7ull,0xecffb952b2b8ddfeull,0x0a0f17e232375ba0ull,},
+		{0x3b8113e06559664bull,0xf703830568656b7bull,0xe6a58aeec499e8f9ull,0x1c96e9e25d7830d9ull,},
+	},
+	{
+		{0xe4e566c6cda11704ull,0x2aff3a88d5183a07ull,0xfdf99c2ce5468fa6ull,0x153e9a1bad7de581ull,},
+		{0x3ea1695025d26160ull,0x3b1609b54d398f22ull,0x0b56fe9beb52dbd6ull,0x059aed1fec4631c1ull,},
+		{0x5af080af90727f79ull,0x93abeb4323af6a53ull,0x127c5714370cd5f8ull,0x2445e466e2040306ull,},
+		{0x64b7805c64370ac8ull,0xa67355fe116f0f48ull,0x6af64b6303bbd82bull,0x132f8f4a892c5422ull,},
+	},
+	{
+		{0x88a9588fffa6f629ull,0xf430cdd4ded24e20ull,0xbdc42d0a84b8acfeull,0x1a45aebf23a985f3ull,},
+		{0x3b0ad568673551aeull,0x302c92788ee789cdull,0x23a2f452d195b030ull,0x21a30b0edae17b30ull,},
+		{0xc5b79f1cd2826feaull,0xb188811e65f9ca41ull,0xc6ecc79db1da39f5ull,0x1fcb5ea3f0af61a0ull,},
+		{0x08b48b787e1d9a2full,0xde56b1580619d155ull,0xc6f7460a6ea23a7full,0x05c15d0bed4bda58ull,},
+	},
+	{
+		{0x7801e11d3127d088ull,0x07c68944b9ed9dcdull,0xb3234d5a0bbed82eull,0x072a0bdc4b785218ull,},
+		{0xa352a8257b228bb4ull,0x1becb46d319d9054ull,0xdf0d3de3d0a10e49ull,0x12c472eb41e8510eull,},
+		{0xe0e1741c47c33dbeull,0x1274a999f19c58a1ull,0xae35b45a08240205ull,0x06e1c572673d0de6ull,},
+		{0x755f1d07b7585637ull,0xde5741492e66b865ull,0x4a32798975346fdaull,0x1e9c1f3bdf3255d5ull,},
+	},
+};
+static const uint64_t QTblHashBN254 = 0x5c26a5698c071882ull;
@@ -2,6 +2,7 @@
 #include <cybozu/inttype.hpp>
 #include <bls/bls.h>
 #include <string.h>
+#include <vector>
 #include <cybozu/benchmark.hpp>
 
 void bls_use_stackTest()
@@ -222,6 +223,206 @@ void blsSerializeTest()
 	CYBOZU_TEST_EQUAL(n, expectSize);
 }
 
+void blsSerializeUncompressedTest()
+{
+	const size_t FpSize = blsGetG1ByteSize();
+	blsSecretKey sec;
+	blsPublicKey pub1, pub2, pub3;
+	blsSignature sig1, sig2;
+	char buf1[1024], buf2[1024];
+	size_t n;
+	const char *msg = "abc";
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub1, &sec);
+	blsSign(&sig1, &sec, msg, strlen(msg));
+
+	n = blsPublicKeySerializeUncompressed(buf1, sizeof(buf1), &pub1);
+	CYBOZU_TEST_EQUAL(n, FpSize * 4);
+	CYBOZU_TEST_EQUAL(blsPublicKeySerializeUncompressed(buf1, n - 1, &pub1), 0);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeUncompressed(&pub2, buf1, n, 0), n);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub1, &pub2));
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeUncompressed(&pub2, buf1, n, 1), n);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub1, &pub2));
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeUncompressed(&pub2, buf1, n - 1, 1), 0);
+	const size_t compN = blsPublicKeySerialize(buf2, sizeof(buf2), &pub1);
+	CYBOZU_BENCH_C("pubDeserialize", 1000, blsPublicKeyDeserialize, &pub2, buf2, compN);
+	CYBOZU_BENCH_C("pubDeserializeUnc", 1000, blsPublicKeyDeserializeUncompressed, &pub2, buf1, n, 0);
+	CYBOZU_BENCH_C("pubDeserializeUncT", 1000, blsPublicKeyDeserializeUncompressed, &pub2, buf1, n, 1);
+
+	// x of pub1 and y of pub3 is not on the curve
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub3, &sec);
+	CYBOZU_TEST_EQUAL(blsPublicKeySerializeUncompressed(buf2, sizeof(buf2), &pub3), n);
+	memcpy(buf1 + n / 2, buf2 + n / 2, n / 2);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeUncompressed(&pub2, buf1, n, 0), 0);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeUncompressed(&pub2, buf1, n, 1), n);
+
+	n = blsSignatureSerializeUncompressed(buf1, sizeof(buf1), &sig1);
+	CYBOZU_TEST_EQUAL(n, FpSize * 2);
+	CYBOZU_TEST_EQUAL(blsSignatureDeserializeUncompressed(&sig2, buf1, n, 0), n);
+	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig1, &sig2));
+	CYBOZU_TEST_EQUAL(blsSignatureDeserializeUncompressed(&sig2, buf1, n, 1), n);
+	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig1, &sig2));
+
+	// the point at infinity
+	blsSignatureSub(&sig2, &sig1);
+	n = blsSignatureSerializeUncompressed(buf1, sizeof(buf1), &sig2);
+	CYBOZU_TEST_EQUAL(n, FpSize * 2);
+	memset(&sig1, 1, sizeof(sig1));
+	CYBOZU_TEST_EQUAL(blsSignatureDeserializeUncompressed(&sig1, buf1, n, 0), n);
+	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig1, &sig2));
+}
+
+void blsPublicKeyRegistryTest()
+{
+	const char *path = "bls_c_registry_test.bin";
+	const size_t n = 10;
+	blsPublicKey pubVec[n];
+	blsSignature sigVec[n];
+	const char *msg = "abc";
+	for (size_t i = 0; i < n; i++) {
+		blsSecretKey sec;
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		blsSign(&sigVec[i], &sec, msg, strlen(msg));
+	}
+	const int flagTbl[] = { 0, BLS_REGISTRY_PRECOMPUTED };
+	for (size_t t = 0; t < CYBOZU_NUM_OF_ARRAY(flagTbl); t++) {
+		CYBOZU_TEST_EQUAL(blsPublicKeyRegistryWrite(path, pubVec, n, flagTbl[t]), 0);
+		blsPublicKeyRegistry *reg = blsPublicKeyRegistryOpen(path, BLS_REGISTRY_VERIFY_CHECKSUM | BLS_REGISTRY_HUGE_PAGE);
+		CYBOZU_TEST_ASSERT(reg);
+		if (reg == 0) continue;
+		CYBOZU_TEST_EQUAL(blsPublicKeyRegistryGetSize(reg), n);
+		const blsPublicKey *regPubVec = blsPublicKeyRegistryGetPublicKeys(reg);
+		for (size_t i = 0; i < n; i++) {
+			CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&regPubVec[i], &pubVec[i]));
+			CYBOZU_TEST_ASSERT(blsVerify(&sigVec[i], &regPubVec[i], msg, strlen(msg)));
+			const blsPublicKeyPrecomputed *ppub = blsPublicKeyRegistryGetPrecomputed(reg, i);
+			if (flagTbl[t] & BLS_REGISTRY_PRECOMPUTED) {
+				CYBOZU_TEST_ASSERT(ppub);
+				CYBOZU_TEST_ASSERT(blsVerifyPrecomputed(&sigVec[i], ppub, msg, strlen(msg)));
+			} else {
+				CYBOZU_TEST_ASSERT(ppub == 0);
+			}
+		}
+		CYBOZU_TEST_ASSERT(blsPublicKeyRegistryGetPrecomputed(reg, n) == 0);
+		blsPublicKeyRegistryClose(reg);
+	}
+	// break the last byte of the records
+	FILE *fp = fopen(path, "r+b");
+	CYBOZU_TEST_ASSERT(fp);
+	if (fp) {
+		fseek(fp, -1, SEEK_END);
+		int c = fgetc(fp);
+		fseek(fp, -1, SEEK_END);
+		fputc(c ^ 1, fp);
+		fclose(fp);
+	}
+	blsPublicKeyRegistry *reg = blsPublicKeyRegistryOpen(path, 0);
+	CYBOZU_TEST_ASSERT(reg);
+	blsPublicKeyRegistryClose(reg);
+	CYBOZU_TEST_ASSERT(blsPublicKeyRegistryOpen(path, BLS_REGISTRY_VERIFY_CHECKSUM) == 0);
+	// no public key
+	for (size_t t = 0; t < CYBOZU_NUM_OF_ARRAY(flagTbl); t++) {
+		CYBOZU_TEST_EQUAL(blsPublicKeyRegistryWrite(path, pubVec, 0, flagTbl[t]), 0);
+		reg = blsPublicKeyRegistryOpen(path, BLS_REGISTRY_VERIFY_CHECKSUM);
+		CYBOZU_TEST_ASSERT(reg);
+		if (reg == 0) continue;
+		CYBOZU_TEST_EQUAL(blsPublicKeyRegistryGetSize(reg), 0u);
+		CYBOZU_TEST_ASSERT(blsPublicKeyRegistryGetPrecomputed(reg, 0) == 0);
+		blsPublicKeyRegistryClose(reg);
+	}
+	remove(path);
+	CYBOZU_TEST_ASSERT(blsPublicKeyRegistryOpen(path, 0) == 0);
+}
+
+void blsDeserializeBatchTest()
+{
+	const size_t n = 100;
+	const size_t pubSize = blsGetG1ByteSize() * 2;
+	const size_t sigSize = blsGetG1ByteSize();
+	std::vector<blsPublicKey> pubVec(n), pubVec2(n);
+	std::vector<blsSignature> sigVec(n), sigVec2(n);
+	std::vector<char> pubBuf(n * pubSize), sigBuf(n * sigSize);
+	std::vector<int> okVec(n);
+	const char *msg = "abc";
+	for (size_t i = 0; i < n; i++) {
+		blsSecretKey sec;
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		blsSign(&sigVec[i], &sec, msg, strlen(msg));
+		CYBOZU_TEST_EQUAL(blsPublicKeySerialize(&pubBuf[i * pubSize], pubSize, &pubVec[i]), pubSize);
+		CYBOZU_TEST_EQUAL(blsSignatureSerialize(&sigBuf[i * sigSize], sigSize, &sigVec[i]), sigSize);
+	}
+	// break the x coordinate of the 3rd and the 50th element
+	const size_t badIdx[] = { 3, 50 };
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(badIdx); i++) {
+		memset(&pubBuf[badIdx[i] * pubSize], 0xff, pubSize);
+		memset(&sigBuf[badIdx[i] * sigSize], 0xff, sigSize);
+	}
+	const size_t threadTbl[] = { 1, 3, 0 };
+	for (size_t t = 0; t < CYBOZU_NUM_OF_ARRAY(threadTbl); t++) {
+		CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeBatchMT(pubVec2.data(), okVec.data(), pubBuf.data(), pubSize, n, threadTbl[t]), n - 2);
+		for (size_t i = 0; i < n; i++) {
+			const bool bad = i == badIdx[0] || i == badIdx[1];
+			CYBOZU_TEST_EQUAL(okVec[i], bad ? 0 : 1);
+			if (!bad) CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pubVec[i], &pubVec2[i]));
+		}
+		CYBOZU_TEST_EQUAL(blsSignatureDeserializeBatchMT(sigVec2.data(), okVec.data(), sigBuf.data(), sigSize, n, threadTbl[t]), n - 2);
+		for (size_t i = 0; i < n; i++) {
+			const bool bad = i == badIdx[0] || i == badIdx[1];
+			CYBOZU_TEST_EQUAL(okVec[i], bad ? 0 : 1);
+			if (!bad) CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sigVec[i], &sigVec2[i]));
+		}
+	}
+	// elemSize larger than the serialized size fails
+	CYBOZU_TEST_EQUAL(blsSignatureDeserializeBatch(sigVec2.data(), okVec.data(), pubBuf.data(), pubSize, n), 0);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeBatch(pubVec2.data(), okVec.data(), pubBuf.data(), pubSize, 0), 0);
+	CYBOZU_BENCH_C("pubDeserialize", 10, blsPublicKeyDeserializeBatch, pubVec2.data(), okVec.data(), pubBuf.data(), pubSize, n);
+	CYBOZU_BENCH_C("pubDeserializeMT", 10, blsPublicKeyDeserializeBatchMT, pubVec2.data(), okVec.data(), pubBuf.data(), pubSize, n, 0);
+}
+
+/*
+	badPub and badSig have a wrong order if they are not NULL
+	and they are put at some positions of the vectors
+*/
+void blsAreValidOrderBatchTest(const blsPublicKey *badPub, const blsSignature *badSig)
+{
+	const size_t n = 300;
+	std::vector<blsPublicKey> pubVec(n);
+	std::vector<blsSignature> sigVec(n);
+	std::vector<int> okVec(n);
+	const char *msg = "abc";
+	for (size_t i = 0; i < n; i++) {
+		blsSecretKey sec;
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		blsSign(&sigVec[i], &sec, msg, strlen(msg));
+	}
+	CYBOZU_TEST_EQUAL(blsPublicKeyAreValidOrderBatch(okVec.data(), pubVec.data(), n, 0), 1);
+	for (size_t i = 0; i < n; i++) CYBOZU_TEST_EQUAL(okVec[i], 1);
+	CYBOZU_TEST_EQUAL(blsSignatureAreValidOrderBatch(okVec.data(), sigVec.data(), n, 0), 1);
+	for (size_t i = 0; i < n; i++) CYBOZU_TEST_EQUAL(okVec[i], 1);
+	CYBOZU_TEST_EQUAL(blsPublicKeyAreValidOrderBatch(0, pubVec.data(), n, 0), 1);
+	CYBOZU_TEST_EQUAL(blsPublicKeyAreValidOrderBatch(0, pubVec.data(), 0, 0), 1);
+	CYBOZU_BENCH_C("pubIsValidOrder", 10, blsPublicKeyIsValidOrder, &pubVec[0]);
+	CYBOZU_BENCH_C("pubAreValidOrder", 10, blsPublicKeyAreValidOrderBatch, 0, pubVec.data(), n, 0);
+	if (badPub == 0) return;
+	const size_t badIdx[] = { 0, 7, 8, 200 };
+	std::vector<int> expectVec(n, 1);
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(badIdx); i++) {
+		pubVec[badIdx[i]] = *badPub;
+		sigVec[badIdx[i]] = *badSig;
+		expectVec[badIdx[i]] = 0;
+	}
+	CYBOZU_TEST_EQUAL(blsPublicKeyAreValidOrderBatch(0, pubVec.data(), n, 64), 0);
+	CYBOZU_TEST_EQUAL(blsPublicKeyAreValidOrderBatch(okVec.data(), pubVec.data(), n, 64), 0);
+	CYBOZU_TEST_ASSERT(okVec == expectVec);
+	CYBOZU_TEST_EQUAL(blsSignatureAreValidOrderBatch(0, sigVec.data(), n, 64), 0);
+	CYBOZU_TEST_EQUAL(blsSignatureAreValidOrderBatch(okVec.data(), sigVec.data(), n, 64), 0);
+	CYBOZU_TEST_ASSERT(okVec == expectVec);
+}
+
 void blsVerifyOrderTest()
 {
 	puts("blsVerifyOrderTest");
@@ -249,6 +450,27 @@ void blsVerifyOrderTest()
 	CYBOZU_TEST_ASSERT(n > 0);
 	CYBOZU_TEST_ASSERT(!blsSignatureIsValidOrder(&sig));
 	blsSignatureVerifyOrder(1);
+	blsAreValidOrderBatchTest(&pub, &sig);
+#ifndef MCL_DONT_USE_CSPRNG
+	// blsVerifyBatch checks the order if deserialization does not
+	{
+		const size_t n = 3;
+		blsPublicKey pubVec[n];
+		blsSignature sigVec[n];
+		const char msgVec[n] = { 'a', 'b', 'c' };
+		for (size_t i = 0; i < n; i++) {
+			blsSecretKey sec;
+			blsSecretKeySetByCSPRNG(&sec);
+			blsGetPublicKey(&pubVec[i], &sec);
+			blsSign(&sigVec[i], &sec, &msgVec[i], 1);
+		}
+		blsSignatureVerifyOrder(0);
+		CYBOZU_TEST_ASSERT(blsVerifyBatch(sigVec, pubVec, msgVec, 1, n));
+		blsSignatureAdd(&sigVec[1], &sig);
+		CYBOZU_TEST_ASSERT(!blsVerifyBatch(sigVec, pubVec, msgVec, 1, n));
+		blsSignatureVerifyOrder(1);
+	}
+#endif
 }
 
 void blsAddSubTest()
@@ -289,6 +511,411 @@ void blsAddSubTest()
 	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig[2], &sig[0]));
 }
 
+void blsPublicKeyPrecomputedTest()
+{
+	blsSecretKey sec;
+	blsPublicKey pub;
+	blsSignature sig;
+	const char *msg = "this is a pen";
+	const size_t msgSize = strlen(msg);
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub, &sec);
+	blsSign(&sig, &sec, msg, msgSize);
+	blsPublicKeyPrecomputed *ppub = blsPublicKeyPrecomputedCreate(&pub);
+	CYBOZU_TEST_ASSERT(ppub);
+	CYBOZU_TEST_ASSERT(blsVerifyPrecomputed(&sig, ppub, msg, msgSize));
+	CYBOZU_TEST_ASSERT(!blsVerifyPrecomputed(&sig, ppub, msg, msgSize - 1));
+	CYBOZU_BENCH_C("verifyPrecomputed", 1000, blsVerifyPrecomputed, &sig, ppub, msg, msgSize);
+	blsPublicKeyPrecomputedDestroy(ppub);
+	// zero public key
+	memset(&pub, 0, sizeof(pub));
+	ppub = blsPublicKeyPrecomputedCreate(&pub);
+	CYBOZU_TEST_ASSERT(ppub);
+	CYBOZU_TEST_ASSERT(!blsVerifyPrecomputed(&sig, ppub, msg, msgSize));
+	blsPublicKeyPrecomputedDestroy(ppub);
+	blsPublicKeyPrecomputedDestroy(0);
+}
+
+void blsMessageTest()
+{
+	blsSecretKey sec;
+	blsPublicKey pub;
+	blsSignature sig1, sig2;
+	const char *msg = "this is a pen";
+	const size_t msgSize = strlen(msg);
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub, &sec);
+	blsMessage m1, m2;
+	blsMessagePrepare(&m1, msg, msgSize);
+	blsMessagePrepare(&m2, msg, msgSize - 1);
+	blsSign(&sig1, &sec, msg, msgSize);
+	blsSignPrepared(&sig2, &sec, &m1);
+	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig1, &sig2));
+	CYBOZU_TEST_ASSERT(blsVerifyPrepared(&sig1, &pub, &m1));
+	CYBOZU_TEST_ASSERT(!blsVerifyPrepared(&sig1, &pub, &m2));
+	blsPublicKeyPrecomputed *ppub = blsPublicKeyPrecomputedCreate(&pub);
+	CYBOZU_TEST_ASSERT(ppub);
+	CYBOZU_TEST_ASSERT(blsVerifyPreparedPrecomputed(&sig1, ppub, &m1));
+	CYBOZU_TEST_ASSERT(!blsVerifyPreparedPrecomputed(&sig1, ppub, &m2));
+	CYBOZU_BENCH_C("verifyPrepared", 1000, blsVerifyPrepared, &sig1, &pub, &m1);
+	CYBOZU_BENCH_C("verifyPreparedPrecomputed", 1000, blsVerifyPreparedPrecomputed, &sig1, ppub, &m1);
+	blsPublicKeyPrecomputedDestroy(ppub);
+}
+
+void blsAggregateVerifierTest()
+{
+	const size_t n = 20;
+	blsSecretKey sec;
+	blsPublicKey pubVec[n];
+	blsSignature sigVec[n], sig;
+	char msg[n][8];
+	blsAggregateVerifier *v = blsAggregateVerifierCreate();
+	CYBOZU_TEST_ASSERT(v);
+	blsAggregateVerifier *v2 = blsAggregateVerifierCreate();
+	CYBOZU_TEST_ASSERT(v2);
+	for (size_t i = 0; i < n; i++) {
+		memset(msg[i], int(i + 1), sizeof(msg[i]));
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		CYBOZU_TEST_EQUAL(blsSignHash(&sigVec[i], &sec, msg[i], sizeof(msg[i])), 0);
+		CYBOZU_TEST_EQUAL(blsAggregateVerifierAddHash(i & 1 ? v : v2, &pubVec[i], msg[i], sizeof(msg[i])), 0);
+	}
+	blsSignatureAggregate(&sig, sigVec, n);
+	CYBOZU_TEST_ASSERT(blsVerifyAggregatedHashes(&sig, pubVec, msg, sizeof(msg[0]), n));
+	CYBOZU_TEST_ASSERT(!blsAggregateVerifierFinalize(v, &sig));
+	blsAggregateVerifierMerge(v, v2);
+	CYBOZU_TEST_EQUAL(blsAggregateVerifierGetSize(v), n);
+	CYBOZU_TEST_ASSERT(blsAggregateVerifierFinalize(v, &sig));
+	CYBOZU_TEST_ASSERT(!blsAggregateVerifierFinalize(v, &sigVec[0]));
+	blsAggregateVerifierClear(v);
+	CYBOZU_TEST_ASSERT(!blsAggregateVerifierFinalize(v, &sig));
+	blsAggregateVerifierDestroy(v2);
+	blsAggregateVerifierDestroy(v);
+	blsAggregateVerifierDestroy(0);
+}
+
+static void verifyQueueCallback(void *self, int ret)
+{
+	*(int*)self = ret;
+}
+
+void blsVerifyQueueTest()
+{
+	const size_t n = 50;
+	blsSecretKey sec;
+	blsPublicKey pubVec[n];
+	blsSignature sigVec[n];
+	char msg[n][8];
+	int retVec[n];
+	for (size_t i = 0; i < n; i++) {
+		memset(msg[i], int(i + 1), sizeof(msg[i]));
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		blsSign(&sigVec[i], &sec, msg[i], sizeof(msg[i]));
+	}
+	// long delay ; only full batches or blsVerifyQueueFlush start a batch
+	blsVerifyQueue *vq = blsVerifyQueueCreate(2, 16, 1000000);
+	if (vq == 0) return; // no thread support
+	for (size_t i = 0; i < n; i++) {
+		retVec[i] = -1;
+		// break 7th and 33rd
+		const size_t size = (i == 7 || i == 33) ? sizeof(msg[i]) - 1 : sizeof(msg[i]);
+		CYBOZU_TEST_EQUAL(blsVerifyQueueSubmit(vq, &sigVec[i], &pubVec[i], msg[i], size, verifyQueueCallback, &retVec[i]), 0);
+	}
+	blsVerifyQueueFlush(vq);
+	for (size_t i = 0; i < n; i++) {
+		CYBOZU_TEST_EQUAL(retVec[i], (i == 7 || i == 33) ? 0 : 1);
+	}
+	blsVerifyQueueStat stat;
+	blsVerifyQueueGetStat(vq, &stat);
+	CYBOZU_TEST_EQUAL(stat.submitN, n);
+	CYBOZU_TEST_EQUAL(stat.doneN, n);
+	CYBOZU_TEST_EQUAL(stat.pending, 0u);
+	CYBOZU_TEST_ASSERT(stat.fallbackN >= 1);
+	uint64_t batchN = 0, depthN = 0;
+	for (size_t i = 0; i < BLS_VERIFY_QUEUE_HIST_N; i++) {
+		batchN += stat.batchSizeHist[i];
+		depthN += stat.depthHist[i];
+	}
+	CYBOZU_TEST_EQUAL(batchN, stat.batchN);
+	CYBOZU_TEST_EQUAL(depthN, stat.batchN);
+	CYBOZU_TEST_EQUAL(stat.batchSizeHist[5], 0u); // no batch has more than 16 jobs
+	// the pending jobs are verified by blsVerifyQueueDestroy
+	retVec[0] = -1;
+	CYBOZU_TEST_EQUAL(blsVerifyQueueSubmit(vq, &sigVec[0], &pubVec[0], msg[0], sizeof(msg[0]), verifyQueueCallback, &retVec[0]), 0);
+	blsVerifyQueueDestroy(vq);
+	CYBOZU_TEST_EQUAL(retVec[0], 1);
+	blsVerifyQueueDestroy(0);
+}
+
+void blsContextTest()
+{
+	blsSecretKey sec, t;
+	blsPublicKey pub, pub2, gen;
+	blsSignature sig, sig2;
+	const char *msg = "this is a pen";
+	const size_t msgSize = strlen(msg);
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub, &sec);
+	blsSign(&sig, &sec, msg, msgSize);
+
+	// the default generator
+	blsContext *ctx = blsContextCreate(0);
+	CYBOZU_TEST_ASSERT(ctx);
+	blsContextGetGeneratorOfG2(ctx, &gen);
+	blsGetGeneratorOfG2(&pub2);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&gen, &pub2));
+	blsContextGetPublicKey(ctx, &pub2, &sec);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub, &pub2));
+	blsContextSign(ctx, &sig2, &sec, msg, msgSize);
+	CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig, &sig2));
+	CYBOZU_TEST_ASSERT(blsContextVerify(ctx, &sig, &pub, msg, msgSize));
+	CYBOZU_TEST_ASSERT(!blsContextVerify(ctx, &sig, &pub, msg, msgSize - 1));
+	CYBOZU_TEST_ASSERT(blsContextFastAggregateVerify(ctx, &sig, &pub, 1, msg, msgSize));
+	blsContextDestroy(ctx);
+
+	// another generator t Q
+	blsSecretKeySetByCSPRNG(&t);
+	blsGetPublicKey(&gen, &t);
+	ctx = blsContextCreate(&gen);
+	CYBOZU_TEST_ASSERT(ctx);
+	blsContextGetPublicKey(ctx, &pub2, &sec);
+	blsDHKeyExchange(&pub, &sec, &gen);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub, &pub2));
+	CYBOZU_TEST_ASSERT(blsContextVerify(ctx, &sig, &pub2, msg, msgSize));
+	CYBOZU_TEST_ASSERT(!blsVerify(&sig, &pub2, msg, msgSize));
+	blsContextDestroy(ctx);
+	blsContextDestroy(0);
+
+	// zero generator
+	memset(&gen, 0, sizeof(gen));
+	CYBOZU_TEST_ASSERT(blsContextCreate(&gen) == 0);
+}
+
+void blsVerifyCacheTest(int curve)
+{
+	blsVerifyCacheStat stat;
+	blsSecretKey secVec[3];
+	blsPublicKey pubVec[3];
+	blsSignature sigVec[3], sig;
+	const char *msg = "this is a pen";
+	const size_t msgSize = strlen(msg);
+	for (size_t i = 0; i < 3; i++) {
+		blsSecretKeySetByCSPRNG(&secVec[i]);
+		blsGetPublicKey(&pubVec[i], &secVec[i]);
+	}
+	blsSign(&sig, &secVec[0], msg, msgSize);
+	// disabled by default ; hit and miss are cumulative
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.byteSize, 0u);
+	const uint64_t hit = stat.hit, miss = stat.miss;
+	CYBOZU_TEST_ASSERT(blsVerify(&sig, &pubVec[0], msg, msgSize));
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.hit, hit);
+	CYBOZU_TEST_EQUAL(stat.miss, miss);
+
+	blsVerifyCacheSetMaxByteSize(1 << 20);
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_ASSERT(stat.byteSize > 0 && stat.byteSize <= (1 << 20));
+	CYBOZU_TEST_EQUAL(stat.n, 0u);
+	for (int i = 0; i < 2; i++) {
+		CYBOZU_TEST_ASSERT(blsVerify(&sig, &pubVec[0], msg, msgSize));
+	}
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.hit, hit + 1);
+	CYBOZU_TEST_EQUAL(stat.miss, miss + 1);
+	CYBOZU_TEST_EQUAL(stat.n, 1u);
+	// invalid inputs are not recorded
+	for (int i = 0; i < 2; i++) {
+		CYBOZU_TEST_ASSERT(!blsVerify(&sig, &pubVec[0], msg, msgSize - 1));
+		CYBOZU_TEST_ASSERT(!blsVerify(&sig, &pubVec[1], msg, msgSize));
+	}
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.hit, hit + 1);
+	CYBOZU_TEST_EQUAL(stat.n, 1u);
+	// blsVerifyHash does not hit the result of blsVerify
+	CYBOZU_TEST_ASSERT(!blsVerifyHash(&sig, &pubVec[0], msg, msgSize));
+
+	// aggregated hashes
+	const size_t sizeofHash = 32;
+	char hVec[3][sizeofHash];
+	for (size_t i = 0; i < 3; i++) {
+		memset(hVec[i], int(i + 1), sizeofHash);
+		CYBOZU_TEST_EQUAL(blsSignHash(&sigVec[i], &secVec[i], hVec[i], sizeofHash), 0);
+	}
+	for (int i = 0; i < 2; i++) {
+		CYBOZU_TEST_ASSERT(blsVerifyHash(&sigVec[0], &pubVec[0], hVec[0], sizeofHash));
+	}
+	blsSignatureAggregate(&sig, sigVec, 3);
+	for (int i = 0; i < 2; i++) {
+		CYBOZU_TEST_ASSERT(blsVerifyAggregatedHashes(&sig, pubVec, hVec, sizeofHash, 3));
+	}
+	CYBOZU_TEST_ASSERT(!blsVerifyAggregatedHashes(&sig, pubVec, hVec, sizeofHash, 2));
+	hVec[2][0]++;
+	CYBOZU_TEST_ASSERT(!blsVerifyAggregatedHashes(&sig, pubVec, hVec, sizeofHash, 3));
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.hit, hit + 3);
+	CYBOZU_TEST_EQUAL(stat.n, 3u);
+
+	blsVerifyCacheClear();
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.n, 0u);
+	CYBOZU_TEST_ASSERT(stat.byteSize > 0);
+
+	// an input verified with another map-to mode does not hit
+	if (curve == MCL_BN254) {
+		blsSign(&sig, &secVec[0], msg, msgSize);
+		CYBOZU_TEST_ASSERT(blsVerify(&sig, &pubVec[0], msg, msgSize));
+		CYBOZU_TEST_EQUAL(blsSetMapToMode(MCL_MAP_TO_MODE_TRY_AND_INC), 0);
+		CYBOZU_TEST_ASSERT(!blsVerify(&sig, &pubVec[0], msg, msgSize));
+		CYBOZU_TEST_EQUAL(blsSetMapToMode(MCL_MAP_TO_MODE_ORIGINAL), 0);
+		blsVerifyCacheGetStat(&stat);
+		const uint64_t hit2 = stat.hit;
+		CYBOZU_TEST_ASSERT(blsVerify(&sig, &pubVec[0], msg, msgSize));
+		blsVerifyCacheGetStat(&stat);
+		CYBOZU_TEST_EQUAL(stat.hit, hit2 + 1);
+		blsVerifyCacheClear();
+	}
+
+	// one bucket ; old inputs are evicted but the results are still correct
+	blsVerifyCacheSetMaxByteSize(64);
+	for (int j = 0; j < 2; j++) {
+		for (int i = 0; i < 8; i++) {
+			blsSign(&sig, &secVec[0], msg, i + 1);
+			CYBOZU_TEST_ASSERT(blsVerify(&sig, &pubVec[0], msg, i + 1));
+			CYBOZU_TEST_ASSERT(!blsVerify(&sig, &pubVec[0], msg, i + 2));
+		}
+	}
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_ASSERT(stat.n <= 4);
+	CYBOZU_TEST_EQUAL(stat.byteSize, 64u);
+	blsVerifyCacheSetMaxByteSize(0);
+	blsVerifyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.byteSize, 0u);
+}
+
+void blsPublicKeyCacheTest()
+{
+	blsSecretKey sec;
+	blsPublicKey pub, pub2;
+	blsSignature sig;
+	const char *msg = "this is a pen";
+	const size_t msgSize = strlen(msg);
+	blsSecretKeySetByCSPRNG(&sec);
+	blsGetPublicKey(&pub, &sec);
+	blsSign(&sig, &sec, msg, msgSize);
+	char buf[1024];
+	mclSize n = blsPublicKeySerialize(buf, sizeof(buf), &pub);
+	CYBOZU_TEST_ASSERT(n > 0);
+
+	blsPublicKeyCacheClear();
+	blsPublicKeyCacheStat stat0, stat;
+	blsPublicKeyCacheGetStat(&stat0);
+	CYBOZU_TEST_EQUAL(stat0.n, 0u);
+	for (int i = 0; i < 3; i++) {
+		CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub2, buf, n), n);
+		CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub, &pub2));
+	}
+	blsPublicKeyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.n, 1u);
+	CYBOZU_TEST_EQUAL(stat.miss - stat0.miss, 1u);
+	CYBOZU_TEST_EQUAL(stat.hit - stat0.hit, 2u);
+	CYBOZU_TEST_ASSERT(blsVerifyCached(&sig, buf, n, msg, msgSize));
+	CYBOZU_TEST_ASSERT(!blsVerifyCached(&sig, buf, n, msg, msgSize - 1));
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub2, buf, n - 1), 0u);
+	blsPublicKeyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.n, 1u);
+
+	// the same bytes are looked up again after the serialization mode is switched
+	mclBn_setETHserialization(1);
+	{
+		blsPublicKey pub3;
+		const mclSize n3 = blsPublicKeyDeserialize(&pub3, buf, n);
+		const mclSize n2 = blsPublicKeyDeserializeCached(&pub2, buf, n);
+		CYBOZU_TEST_EQUAL(n2, n3 > 0 && blsPublicKeyIsValidOrder(&pub3) ? n3 : 0u);
+		if (n2 > 0) CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub2, &pub3));
+		char buf2[1024];
+		const mclSize m = blsPublicKeySerialize(buf2, sizeof(buf2), &pub);
+		CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub2, buf2, m), m);
+		CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub, &pub2));
+	}
+	mclBn_setETHserialization(0);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub2, buf, n), n);
+	CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub, &pub2));
+
+	// a small budget evicts the old keys
+	blsPublicKeyCacheSetMaxByteSize(64 * 1024);
+	for (int i = 0; i < 100; i++) {
+		blsSecretKey s;
+		blsSecretKeySetByCSPRNG(&s);
+		blsGetPublicKey(&pub2, &s);
+		mclSize n2 = blsPublicKeySerialize(buf, sizeof(buf), &pub2);
+		CYBOZU_TEST_ASSERT(n2 > 0);
+		CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub, buf, n2), n2);
+	}
+	blsPublicKeyCacheGetStat(&stat);
+	CYBOZU_TEST_ASSERT(stat.eviction > stat0.eviction);
+	CYBOZU_TEST_ASSERT(stat.byteSize <= 64 * 1024);
+	blsPublicKeyCacheSetMaxByteSize(0);
+	blsPublicKeyCacheGetStat(&stat);
+	CYBOZU_TEST_EQUAL(stat.n, 0u);
+	CYBOZU_TEST_EQUAL(blsPublicKeyDeserializeCached(&pub, buf, n), n);
+	blsPublicKeyCacheSetMaxByteSize(32 * 1024 * 1024);
+	blsPublicKeyCacheClear();
+}
+
+void blsRecoverTest()
+{
+	const size_t maxN = 100;
+	blsSignature sigVec[maxN];
+	blsPublicKey pubVec[maxN];
+	blsId idVec[maxN];
+	for (size_t i = 0; i < maxN; i++) {
+		blsSecretKey sec;
+		blsSecretKeySetByCSPRNG(&sec);
+		blsGetPublicKey(&pubVec[i], &sec);
+		blsSign(&sigVec[i], &sec, "abc", 3);
+		blsIdSetInt(&idVec[i], int(i * 7 + 3));
+	}
+	const size_t tbl[] = { 1, 2, 3, 31, 32, 33, 100 };
+	for (size_t i = 0; i < sizeof(tbl) / sizeof(tbl[0]); i++) {
+		const size_t n = tbl[i];
+		blsSignature sig1, sig2;
+		blsPublicKey pub1, pub2;
+		CYBOZU_TEST_EQUAL(blsSignatureRecover(&sig1, sigVec, idVec, n), 0);
+		CYBOZU_TEST_EQUAL(mclBn_G1LagrangeInterpolation(&sig2.v, &idVec[0].v, &sigVec[0].v, n), 0);
+		CYBOZU_TEST_ASSERT(blsSignatureIsEqual(&sig1, &sig2));
+		CYBOZU_TEST_EQUAL(blsPublicKeyRecoverMT(&pub1, pubVec, idVec, n, 2), 0);
+		CYBOZU_TEST_EQUAL(mclBn_G2LagrangeInterpolation(&pub2.v, &idVec[0].v, &pubVec[0].v, n), 0);
+		CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub1, &pub2));
+	}
+	blsSignature sig;
+	CYBOZU_TEST_EQUAL(blsSignatureRecover(&sig, sigVec, idVec, 0), -1);
+	idVec[2] = idVec[1];
+	CYBOZU_TEST_EQUAL(blsSignatureRecover(&sig, sigVec, idVec, 3), -1);
+	blsIdSetInt(&idVec[2], 0);
+	CYBOZU_TEST_EQUAL(blsSignatureRecover(&sig, sigVec, idVec, 3), -1);
+}
+
+void blsGetPublicKeyTest()
+{
+	blsPublicKey Q;
+	blsGetGeneratorOfG2(&Q);
+	const char *tbl[] = { "0", "1", "2", "3", "15", "16", "17", "-1", "-2" };
+	for (size_t i = 0; i < sizeof(tbl) / sizeof(tbl[0]) + 100; i++) {
+		blsSecretKey sec;
+		if (i < sizeof(tbl) / sizeof(tbl[0])) {
+			CYBOZU_TEST_EQUAL(blsSecretKeySetDecStr(&sec, tbl[i], strlen(tbl[i])), 0);
+		} else {
+			blsSecretKeySetByCSPRNG(&sec);
+		}
+		blsPublicKey pub1, pub2;
+		blsGetPublicKey(&pub1, &sec);
+		mclBnG2_mul(&pub2.v, &Q.v, &sec.v);
+		CYBOZU_TEST_ASSERT(blsPublicKeyIsEqual(&pub1, &pub2));
+	}
+}
+
 void blsBench()
 {
 	blsSecretKey sec;
@@ -301,6 +928,10 @@ void blsBench()
 
 	blsGetPublicKey(&pub, &sec);
 
+	blsPublicKey Q;
+	blsGetGeneratorOfG2(&Q);
+	CYBOZU_BENCH_C("G2::mul(Q)", 1000, mclBnG2_mul, &pub.v, &Q.v, &sec.v);
+	CYBOZU_BENCH_C("getPublicKey", 1000, blsGetPublicKey, &pub, &sec);
 	CYBOZU_BENCH_C("sign", 10000, blsSign, &sig, &sec, msg, msgSize);
 	CYBOZU_BENCH_C("verify", 1000, blsVerify, &sig, &pub, msg, msgSize);
 }
@@ -344,8 +975,21 @@ CYBOZU_TEST_AUTO(all)
 		blsDataTest();
 		blsOrderTest(tbl[i].p, tbl[i].r);
 		blsSerializeTest();
+		blsSerializeUncompressedTest();
+		blsDeserializeBatchTest();
 		if (tbl[i].curveType == MCL_BLS12_381) blsVerifyOrderTest();
+		blsAreValidOrderBatchTest(0, 0);
 		blsAddSubTest();
+		blsPublicKeyPrecomputedTest();
+		blsMessageTest();
+		blsAggregateVerifierTest();
+		blsVerifyQueueTest();
+		blsContextTest();
+		blsPublicKeyCacheTest();
+		blsVerifyCacheTest(tbl[i].curveType);
+		blsPublicKeyRegistryTest();
+		blsRecoverTest();
+		blsGetPublicKeyTest();
 		blsBench();
 	}
 }
@@ -4,11 +4,16 @@
 #include <iostream>
 #include <sstream>
 #include <cybozu/benchmark.hpp>
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+#include <thread>
+#include <atomic>
+#endif
 #ifdef MCL_DONT_USE_OPENSSL
 #include <cybozu/sha2.hpp>
 #else
 #include <cybozu/crypto.hpp>
 #endif
+#include "../src/bls_poly.hpp"
 
 template<class T>
 void streamTest(const T& t)
@@ -190,6 +195,26 @@ void k_of_nTest()
 		sec.recover(allPrvVec, allIdVec);
 		CYBOZU_TEST_EQUAL(sec, sec0);
 	}
+	{
+		bls::LagrangeBasis basis(allIdVec);
+		bls::SecretKey sec;
+		sec.recoverWithBasis(allPrvVec, basis);
+		CYBOZU_TEST_EQUAL(sec, sec0);
+		bls::Signature sig;
+		sig.recoverWithBasis(allSigVec, basis);
+		CYBOZU_TEST_ASSERT(sig.verify(pub0, m));
+		CYBOZU_TEST_EXCEPTION(sec.recoverWithBasis(secVec, basis), std::exception);
+		// an empty vector throws before it is indexed
+		CYBOZU_TEST_EXCEPTION(sec.recoverWithBasis(bls::SecretKeyVec(), basis), std::exception);
+		CYBOZU_TEST_EXCEPTION(sig.recoverWithBasis(bls::SignatureVec(), basis), std::exception);
+		bls::PublicKey pub;
+		CYBOZU_TEST_EXCEPTION(pub.recoverWithBasis(bls::PublicKeyVec(), basis), std::exception);
+		bls::IdVec oneId(1, allIdVec[2]);
+		basis.set(oneId);
+		bls::SecretKeyVec oneSec(1, allPrvVec[2]);
+		sec.recoverWithBasis(oneSec, basis);
+		CYBOZU_TEST_EQUAL(sec, allPrvVec[2]);
+	}
 	/*
 		2-out-of-n
 		can't recover
@@ -279,6 +304,342 @@ void k_of_nTest()
 	}
 }
 
+void recoverLargeTest()
+{
+	const size_t k = 1000;
+	const std::string m = "recover";
+	bls::SecretKey sec0;
+	sec0.init();
+	bls::PublicKey pub0;
+	sec0.getPublicKey(pub0);
+	bls::Signature sig0;
+	sec0.sign(sig0, m);
+	bls::SecretKeyVec msk;
+	sec0.getMasterSecretKey(msk, k);
+	bls::PublicKeyVec mpk;
+	bls::getMasterPublicKey(mpk, msk);
+	bls::SignatureVec sigVec(k);
+	bls::PublicKeyVec pubVec(k);
+	bls::IdVec idVec(k);
+	for (size_t i = 0; i < k; i++) {
+		idVec[i] = int(i * 3 + 1);
+		bls::SecretKey sec;
+		sec.set(msk, idVec[i]);
+		sec.sign(sigVec[i], m);
+		pubVec[i].set(mpk, idVec[i]);
+	}
+	bls::Signature sig;
+	sig.recover(sigVec, idVec);
+	CYBOZU_TEST_EQUAL(sig, sig0);
+	for (size_t threadN = 0; threadN < 4; threadN++) {
+		bls::Signature sig2;
+		sig2.recoverMT(sigVec, idVec, threadN);
+		CYBOZU_TEST_EQUAL(sig2, sig0);
+	}
+	bls::PublicKey pub;
+	pub.recoverMT(pubVec, idVec);
+	CYBOZU_TEST_EQUAL(pub, pub0);
+	CYBOZU_BENCH_C("sig.recover k=1000", 3, sig.recover, sigVec, idVec);
+	CYBOZU_BENCH_C("sig.recoverMT k=1000", 3, sig.recoverMT, sigVec, idVec, 0);
+	CYBOZU_BENCH_C("pub.recover k=1000", 3, pub.recover, pubVec, idVec);
+	CYBOZU_BENCH_C("pub.recoverMT k=1000", 3, pub.recoverMT, pubVec, idVec, 0);
+	{
+		bls::LagrangeBasis basis(idVec);
+		CYBOZU_TEST_EQUAL(basis.size(), k);
+		bls::Signature sig2;
+		sig2.recoverWithBasis(sigVec, basis);
+		CYBOZU_TEST_EQUAL(sig2, sig0);
+		bls::PublicKey pub2;
+		pub2.recoverWithBasis(pubVec, basis);
+		CYBOZU_TEST_EQUAL(pub2, pub0);
+		CYBOZU_BENCH_C("sig.recoverWithBasis k=1000", 3, sig.recoverWithBasis, sigVec, basis);
+	}
+	// the same id
+	idVec[k - 1] = idVec[0];
+	CYBOZU_TEST_EXCEPTION(sig.recover(sigVec, idVec), std::exception);
+	CYBOZU_TEST_EXCEPTION(bls::LagrangeBasis basis(idVec), std::exception);
+}
+
+/*
+	k is large enough to compute the Lagrange coefficients by the subproduct tree
+*/
+void recoverSecretKeyLargeTest()
+{
+	const size_t k = 4096;
+	bls::SecretKey sec0;
+	sec0.init();
+	bls::SecretKeyVec msk;
+	sec0.getMasterSecretKey(msk, k);
+	bls::SecretKeyVec secVec(k);
+	bls::IdVec idVec(k);
+	for (size_t i = 0; i < k; i++) {
+		idVec[i] = int(i * 7 + 5);
+		secVec[i].set(msk, idVec[i]);
+	}
+	bls::SecretKey sec;
+	sec.recover(secVec, idVec);
+	CYBOZU_TEST_EQUAL(sec, sec0);
+	CYBOZU_BENCH_C("sec.recover k=4096", 3, sec.recover, secVec, idVec);
+	idVec[k / 2] = idVec[k - 1];
+	CYBOZU_TEST_EXCEPTION(sec.recover(secVec, idVec), std::exception);
+}
+
+// Fr for bls::local::Poly through the C api
+struct BenchFr {
+	mclBnFr v;
+	BenchFr() {}
+	BenchFr(int x) { mclBnFr_setInt(&v, x); }
+	static void mul(BenchFr& z, const BenchFr& x, const BenchFr& y) { mclBnFr_mul(&z.v, &x.v, &y.v); }
+	static void sub(BenchFr& z, const BenchFr& x, const BenchFr& y) { mclBnFr_sub(&z.v, &x.v, &y.v); }
+	static void neg(BenchFr& y, const BenchFr& x) { mclBnFr_neg(&y.v, &x.v); }
+	static void inv(BenchFr& y, const BenchFr& x) { mclBnFr_inv(&y.v, &x.v); }
+	BenchFr& operator+=(const BenchFr& x) { mclBnFr_add(&v, &v, &x.v); return *this; }
+	BenchFr& operator-=(const BenchFr& x) { mclBnFr_sub(&v, &v, &x.v); return *this; }
+	bool operator==(const BenchFr& x) const { return mclBnFr_isEqual(&v, &x.v) == 1; }
+};
+
+// same as getLagrangeDenomNaive in bls_c_impl.hpp
+void lagrangeDenomNaive(BenchFr *d, const BenchFr *x, size_t k)
+{
+	for (size_t i = 0; i < k; i++) {
+		BenchFr b = x[i], t;
+		for (size_t j = 0; j < k; j++) {
+			if (j == i) continue;
+			BenchFr::sub(t, x[j], x[i]);
+			BenchFr::mul(b, b, t);
+		}
+		d[i] = b;
+	}
+}
+
+// same as getLagrangeDenomTree in bls_c_impl.hpp
+void lagrangeDenomTree(BenchFr *d, const BenchFr *x, size_t k)
+{
+	typedef bls::local::SubproductTree<BenchFr> Tree;
+	const Tree tree(x, k);
+	const std::vector<BenchFr>& P = tree.getRoot();
+	std::vector<BenchFr> dP(k);
+	for (size_t i = 0; i < k; i++) {
+		BenchFr::mul(dP[i], P[i + 1], BenchFr(int(i + 1)));
+	}
+	tree.eval(d, dP);
+	const bool neg = (k - 1) & 1;
+	for (size_t i = 0; i < k; i++) {
+		BenchFr::mul(d[i], d[i], x[i]);
+		if (neg) BenchFr::neg(d[i], d[i]);
+	}
+}
+
+/*
+	compare the naive loop and the subproduct tree for the denominators of the Lagrange coefficients
+	lagrangeTreeMinN in bls_c_impl.hpp is chosen by this benchmark
+*/
+void lagrangeTreeBenchTest()
+{
+	const size_t tbl[] = { 256, 512, 1024, 2048, 4096, 8192 };
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		const size_t k = tbl[i];
+		std::vector<BenchFr> x(k), d1(k), d2(k);
+		for (size_t j = 0; j < k; j++) {
+			x[j] = BenchFr(int(j * 7 + 5));
+		}
+		lagrangeDenomNaive(d1.data(), x.data(), k);
+		lagrangeDenomTree(d2.data(), x.data(), k);
+		CYBOZU_TEST_ASSERT(d1 == d2);
+		char name[64];
+		CYBOZU_SNPRINTF(name, sizeof(name), "lagrange naive k=%d", (int)k);
+		CYBOZU_BENCH_C(name, 1, lagrangeDenomNaive, d1.data(), x.data(), k);
+		CYBOZU_SNPRINTF(name, sizeof(name), "lagrange tree k=%d", (int)k);
+		CYBOZU_BENCH_C(name, 1, lagrangeDenomTree, d2.data(), x.data(), k);
+	}
+}
+
+void shareBatchTest()
+{
+	const size_t k = 10;
+	const size_t n = 103;
+	bls::SecretKey sec0;
+	sec0.init();
+	bls::SecretKeyVec msk;
+	sec0.getMasterSecretKey(msk, k);
+	bls::IdVec idVec(n);
+	for (size_t i = 0; i < n; i++) {
+		if (i & 1) {
+			idVec[i] = int(i);
+		} else {
+			// a full size id
+			bls::SecretKey r;
+			r.init();
+			std::string str;
+			r.getStr(str);
+			idVec[i].setStr(str);
+		}
+	}
+	bls::SecretKeyVec secVec0(n);
+	for (size_t i = 0; i < n; i++) {
+		secVec0[i].set(msk, idVec[i]);
+	}
+	bls::SecretKeyVec secVec;
+	bls::SecretKey::shareBatch(secVec, msk, idVec);
+	CYBOZU_TEST_ASSERT(secVec == secVec0);
+	for (size_t threadN = 0; threadN < 4; threadN++) {
+		bls::SecretKeyVec secVec2;
+		bls::SecretKey::shareBatchMT(secVec2, msk, idVec, threadN);
+		CYBOZU_TEST_ASSERT(secVec2 == secVec0);
+	}
+	// k = 1
+	bls::SecretKey::shareBatch(secVec, bls::SecretKeyVec(1, sec0), idVec);
+	for (size_t i = 0; i < n; i++) {
+		CYBOZU_TEST_EQUAL(secVec[i], sec0);
+	}
+	CYBOZU_TEST_EXCEPTION(bls::SecretKey::shareBatch(secVec, bls::SecretKeyVec(), idVec), std::exception);
+	{
+		const size_t benchK = 100;
+		const size_t benchN = 1000;
+		sec0.getMasterSecretKey(msk, benchK);
+		bls::IdVec ids(benchN);
+		for (size_t i = 0; i < benchN; i++) {
+			ids[i] = int(i + 1);
+		}
+		bls::SecretKey sec;
+		CYBOZU_BENCH_C("sec.set k=100", 1000, sec.set, msk, ids[0]);
+		CYBOZU_BENCH_C("shareBatch k=100 n=1000", 3, bls::SecretKey::shareBatch, secVec, msk, ids);
+		CYBOZU_BENCH_C("shareBatchMT k=100 n=1000", 3, bls::SecretKey::shareBatchMT, secVec, msk, ids, 0);
+	}
+}
+
+void pubShareBatchTest()
+{
+	const size_t k = 10;
+	const size_t n = 50;
+	bls::SecretKey sec0;
+	sec0.init();
+	bls::SecretKeyVec msk;
+	sec0.getMasterSecretKey(msk, k);
+	bls::PublicKeyVec mpk;
+	bls::getMasterPublicKey(mpk, msk);
+	bls::IdVec idVec(n);
+	for (size_t i = 0; i < n; i++) {
+		if (i % 3 == 0) {
+			idVec[i] = int(i);
+		} else {
+			// a full size id
+			bls::SecretKey r;
+			r.init();
+			std::string str;
+			r.getStr(str);
+			idVec[i].setStr(str);
+		}
+	}
+	bls::PublicKeyVec pubVec0(n);
+	for (size_t i = 0; i < n; i++) {
+		pubVec0[i].set(mpk, idVec[i]);
+	}
+	bls::PublicKeyVec pubVec;
+	bls::PublicKey::shareBatch(pubVec, mpk, idVec);
+	CYBOZU_TEST_ASSERT(pubVec == pubVec0);
+	for (size_t threadN = 0; threadN < 4; threadN++) {
+		bls::PublicKeyVec pubVec2;
+		bls::PublicKey::shareBatchMT(pubVec2, mpk, idVec, threadN);
+		CYBOZU_TEST_ASSERT(pubVec2 == pubVec0);
+	}
+	// the public keys of the secret shares
+	bls::SecretKeyVec secVec;
+	bls::SecretKey::shareBatch(secVec, msk, idVec);
+	for (size_t i = 0; i < n; i++) {
+		bls::PublicKey pub;
+		secVec[i].getPublicKey(pub);
+		CYBOZU_TEST_EQUAL(pub, pubVec[i]);
+	}
+	// only one large id uses Horner's method
+	idVec.resize(2);
+	idVec[0] = 5;
+	bls::PublicKey::shareBatch(pubVec, mpk, idVec);
+	for (size_t i = 0; i < 2; i++) {
+		bls::PublicKey pub;
+		pub.set(mpk, idVec[i]);
+		CYBOZU_TEST_EQUAL(pubVec[i], pub);
+	}
+	CYBOZU_TEST_EXCEPTION(bls::PublicKey::shareBatch(pubVec, bls::PublicKeyVec(), idVec), std::exception);
+	{
+		const size_t benchK = 100;
+		const size_t benchN = 100;
+		sec0.getMasterSecretKey(msk, benchK);
+		bls::getMasterPublicKey(mpk, msk);
+		bls::IdVec ids(benchN);
+		for (size_t i = 0; i < benchN; i++) {
+			bls::SecretKey r;
+			r.init();
+			std::string str;
+			r.getStr(str);
+			ids[i].setStr(str);
+		}
+		bls::PublicKey pub;
+		CYBOZU_BENCH_C("pub.set k=100", 10, pub.set, mpk, ids[0]);
+		CYBOZU_BENCH_C("pub shareBatch k=100 n=100", 3, bls::PublicKey::shareBatch, pubVec, mpk, ids);
+		CYBOZU_BENCH_C("pub shareBatchMT k=100 n=100", 3, bls::PublicKey::shareBatchMT, pubVec, mpk, ids, 0);
+	}
+}
+
+void signEach(bls::SignatureVec& sigVec, const bls::SecretKeyVec& secVec, const std::string& m)
+{
+	sigVec.resize(secVec.size());
+	for (size_t i = 0; i < secVec.size(); i++) {
+		secVec[i].sign(sigVec[i], m);
+	}
+}
+
+void signAllMT(bls::SignatureVec& sigVec, const bls::SecretKeyVec& secVec, const std::string& m, size_t threadN)
+{
+	bls::signAll(sigVec, secVec, m, threadN);
+}
+
+void signAllTest()
+{
+	const std::string m = "sign all";
+	const size_t tbl[] = { 0, 1, 3, 4, 5, 100 };
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		const size_t n = tbl[i];
+		bls::SecretKeyVec secVec(n);
+		bls::SignatureVec sigVec0(n);
+		for (size_t j = 0; j < n; j++) {
+			secVec[j].init();
+			secVec[j].sign(sigVec0[j], m);
+		}
+		bls::SignatureVec sigVec;
+		bls::signAll(sigVec, secVec, m);
+		CYBOZU_TEST_ASSERT(sigVec == sigVec0);
+		for (size_t threadN = 0; threadN < 4; threadN++) {
+			bls::SignatureVec sigVec2;
+			bls::signAll(sigVec2, secVec, m, threadN);
+			CYBOZU_TEST_ASSERT(sigVec2 == sigVec0);
+		}
+	}
+	// edge case keys
+	const char *strTbl[] = { "0", "1", "2", "15", "16", "17", "-1", "-2" };
+	bls::SecretKeyVec secVec(CYBOZU_NUM_OF_ARRAY(strTbl));
+	for (size_t i = 0; i < secVec.size(); i++) {
+		secVec[i].setStr(strTbl[i], 10);
+	}
+	bls::SignatureVec sigVec;
+	bls::signAll(sigVec, secVec, m);
+	for (size_t i = 0; i < secVec.size(); i++) {
+		bls::Signature sig;
+		secVec[i].sign(sig, m);
+		CYBOZU_TEST_EQUAL(sigVec[i], sig);
+	}
+	{
+		const size_t n = 64;
+		bls::SecretKeyVec secVec(n);
+		for (size_t i = 0; i < n; i++) {
+			secVec[i].init();
+		}
+		CYBOZU_BENCH_C("sign x 64", 10, signEach, sigVec, secVec, m);
+		CYBOZU_BENCH_C("signAll 64", 10, signAllMT, sigVec, secVec, m, 1);
+		CYBOZU_BENCH_C("signAll 64 MT", 10, signAllMT, sigVec, secVec, m, 0);
+	}
+}
+
 void popTest()
 {
 	const size_t k = 3;
@@ -414,6 +775,27 @@ void dataTest()
 		sign2.setStr(str, bls::IoFixedByteSeq);
 		CYBOZU_TEST_EQUAL(sign, sign2);
 	}
+	pub.getStr(str, bls::IoSerializeUncompressed);
+	{
+		CYBOZU_TEST_EQUAL(str.size(), FpSize * 4);
+		bls::PublicKey pub2;
+		pub2.setStr(str, bls::IoSerializeUncompressed);
+		CYBOZU_TEST_EQUAL(pub, pub2);
+		bls::PublicKey pub3;
+		pub3.setStr(str, bls::IoSerializeUncompressedTrusted);
+		CYBOZU_TEST_EQUAL(pub, pub3);
+		CYBOZU_TEST_EXCEPTION(pub3.setStr(str.substr(1), bls::IoSerializeUncompressed), std::exception);
+	}
+	sign.getStr(str, bls::IoSerializeUncompressed);
+	{
+		CYBOZU_TEST_EQUAL(str.size(), FpSize * 2);
+		bls::Signature sign2;
+		sign2.setStr(str, bls::IoSerializeUncompressed);
+		CYBOZU_TEST_EQUAL(sign, sign2);
+		bls::Signature sign3;
+		sign3.setStr(str, bls::IoSerializeUncompressedTrusted);
+		CYBOZU_TEST_EQUAL(sign, sign3);
+	}
 	bls::Id id;
 	const uint64_t v[] = { 1, 2, 3, 4, 5, 6, };
 	id.set(v);
@@ -426,6 +808,280 @@ void dataTest()
 	}
 }
 
+void preparedPublicKeyTest()
+{
+	bls::SecretKey sec;
+	sec.init();
+	bls::PublicKey pub;
+	sec.getPublicKey(pub);
+	bls::PreparedPublicKey ppub(pub);
+	CYBOZU_TEST_ASSERT(ppub.isPrepared());
+	const std::string m = "prepared";
+	bls::Signature sig;
+	sec.sign(sig, m);
+	CYBOZU_TEST_ASSERT(sig.verify(ppub, m));
+	CYBOZU_TEST_ASSERT(!sig.verify(ppub, m + "a"));
+	const std::string h = "\x01\x02\x03";
+	sec.signHash(sig, h);
+	CYBOZU_TEST_ASSERT(sig.verifyHash(ppub, h));
+	CYBOZU_TEST_ASSERT(!sig.verifyHash(ppub, "\x01\x02\x04"));
+	// another public key
+	bls::SecretKey sec2;
+	sec2.init();
+	sec2.getPublicKey(pub);
+	ppub.set(pub);
+	CYBOZU_TEST_ASSERT(!sig.verifyHash(ppub, h));
+	sec2.sign(sig, m);
+	CYBOZU_TEST_ASSERT(sig.verify(ppub, m));
+	bls::PreparedPublicKey empty;
+	CYBOZU_TEST_ASSERT(!empty.isPrepared());
+	CYBOZU_TEST_EXCEPTION(sig.verify(empty, m), std::exception);
+	CYBOZU_BENCH_C("verify", 1000, sig.verify, pub, m);
+	CYBOZU_BENCH_C("verify(prepared)", 1000, sig.verify, ppub, m);
+}
+
+void preparedMessageTest()
+{
+	bls::SecretKey sec;
+	sec.init();
+	bls::PublicKey pub;
+	sec.getPublicKey(pub);
+	const std::string m = "prepared message";
+	const bls::PreparedMessage msg(m);
+	bls::Signature sig, sig2;
+	sec.sign(sig, m);
+	sec.sign(sig2, msg);
+	CYBOZU_TEST_EQUAL(sig, sig2);
+	CYBOZU_TEST_ASSERT(sig.verify(pub, msg));
+	const bls::PreparedMessage msg2(m + "a");
+	CYBOZU_TEST_ASSERT(!sig.verify(pub, msg2));
+	bls::PreparedPublicKey ppub(pub);
+	CYBOZU_TEST_ASSERT(sig.verify(ppub, msg));
+	CYBOZU_TEST_ASSERT(!sig.verify(ppub, msg2));
+	bls::PreparedPublicKey empty;
+	CYBOZU_TEST_EXCEPTION(sig.verify(empty, msg), std::exception);
+	bls::PreparedMessage msg0;
+	msg0.set(std::string());
+	sec.sign(sig, "");
+	CYBOZU_TEST_ASSERT(sig.verify(pub, msg0));
+	bls::PreparedMessage msg3;
+	msg3.set(m.c_str(), m.size());
+	sec.sign(sig, msg3);
+	CYBOZU_TEST_ASSERT(sig.verify(pub, m));
+	CYBOZU_BENCH_C("verify", 1000, sig.verify, pub, m);
+	CYBOZU_BENCH_C("verify(prepared msg)", 1000, sig.verify, pub, msg);
+	CYBOZU_BENCH_C("verify(prepared pub, msg)", 1000, sig.verify, ppub, msg);
+}
+
+void contextTest()
+{
+	bls::SecretKey sec, t;
+	sec.init();
+	t.init();
+	bls::PublicKey gen;
+	t.getPublicKey(gen);
+	const bls::Context ctx(gen);
+	bls::PublicKey pub, pub2;
+	ctx.getPublicKey(pub, sec);
+	sec.getPublicKey(pub2);
+	CYBOZU_TEST_ASSERT(pub != pub2);
+	const std::string m = "context";
+	bls::Signature sig, sig2;
+	ctx.sign(sig, sec, m);
+	sec.sign(sig2, m);
+	CYBOZU_TEST_EQUAL(sig, sig2);
+	CYBOZU_TEST_ASSERT(ctx.verify(sig, pub, m));
+	CYBOZU_TEST_ASSERT(!ctx.verify(sig, pub2, m));
+	CYBOZU_TEST_ASSERT(sig.verify(pub2, m));
+	CYBOZU_TEST_ASSERT(ctx.fastAggregateVerify(sig, bls::PublicKeyVec(1, pub), m));
+	// the default generator
+	const bls::Context ctx2;
+	bls::PublicKey pub3;
+	ctx2.getPublicKey(pub3, sec);
+	CYBOZU_TEST_EQUAL(pub3, pub2);
+	bls::PublicKey Q;
+	ctx2.getGeneratorOfG2(Q);
+	const bls::Context ctx3(Q);
+	ctx3.getPublicKey(pub3, sec);
+	CYBOZU_TEST_EQUAL(pub3, pub2);
+	bls::PublicKey zero;
+	zero.setStr("0");
+	CYBOZU_TEST_EXCEPTION(bls::Context ctx4(zero), std::exception);
+}
+
+void publicKeyRegistryTest()
+{
+	const char *path = "bls_registry_test.bin";
+	const size_t n = 20;
+	bls::PublicKeyVec pubVec(n);
+	for (size_t i = 0; i < n; i++) {
+		bls::SecretKey sec;
+		sec.init();
+		sec.getPublicKey(pubVec[i]);
+	}
+	bls::PublicKeyRegistry::write(path, pubVec);
+	{
+		const bls::PublicKeyRegistry reg(path, BLS_REGISTRY_VERIFY_CHECKSUM);
+		CYBOZU_TEST_EQUAL(reg.size(), n);
+		for (size_t i = 0; i < n; i++) {
+			CYBOZU_TEST_EQUAL(reg[i], pubVec[i]);
+		}
+	}
+	remove(path);
+	CYBOZU_TEST_EXCEPTION(bls::PublicKeyRegistry reg(path), std::exception);
+}
+
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+struct PublicKeyCacheReader {
+	const std::vector<std::string> *bufVec;
+	const bls::PublicKeyVec *pubVec;
+	int *ok;
+	void operator()() const
+	{
+		for (int j = 0; j < 100; j++) {
+			const size_t i = (j * 7) % bufVec->size();
+			bls::PublicKey pub;
+			pub.deserializeCached((*bufVec)[i]);
+			if (pub != (*pubVec)[i]) *ok = 0;
+		}
+	}
+};
+
+void publicKeyCacheThreadTest()
+{
+	const size_t n = 8;
+	const size_t threadN = 4;
+	bls::PublicKeyVec pubVec(n);
+	std::vector<std::string> bufVec(n);
+	for (size_t i = 0; i < n; i++) {
+		bls::SecretKey sec;
+		sec.init();
+		sec.getPublicKey(pubVec[i]);
+		pubVec[i].getStr(bufVec[i], bls::IoSerialize);
+	}
+	bls::clearPublicKeyCache();
+	blsPublicKeyCacheStat stat0, stat;
+	bls::getPublicKeyCacheStat(stat0);
+	int ok[threadN];
+	std::vector<std::thread> tv;
+	for (size_t i = 0; i < threadN; i++) {
+		ok[i] = 1;
+		PublicKeyCacheReader r = { &bufVec, &pubVec, &ok[i] };
+		tv.push_back(std::thread(r));
+	}
+	for (size_t i = 0; i < threadN; i++) {
+		tv[i].join();
+		CYBOZU_TEST_ASSERT(ok[i]);
+	}
+	bls::getPublicKeyCacheStat(stat);
+	CYBOZU_TEST_EQUAL(stat.n, n);
+	CYBOZU_TEST_EQUAL((stat.hit + stat.miss) - (stat0.hit + stat0.miss), threadN * 100);
+	bls::Signature sig;
+	bls::SecretKey sec;
+	sec.init();
+	bls::PublicKey pub;
+	sec.getPublicKey(pub);
+	std::string buf;
+	pub.getStr(buf, bls::IoSerialize);
+	sec.sign(sig, "abc");
+	CYBOZU_TEST_ASSERT(sig.verifyCached(buf, "abc"));
+	CYBOZU_TEST_ASSERT(!sig.verifyCached(buf, "abd"));
+	CYBOZU_BENCH_C("verifyCached", 1000, sig.verifyCached, buf, "abc");
+}
+#endif
+
+void addSignatures(bls::Signature& sig, const bls::SignatureVec& sigVec)
+{
+	sig = sigVec[0];
+	for (size_t i = 1; i < sigVec.size(); i++) {
+		sig.add(sigVec[i]);
+	}
+}
+
+void aggregateVecTest()
+{
+	const size_t tbl[] = { 0, 1, 2, 3, 255, 256, 257, 1000, 4000 };
+	const size_t maxN = tbl[CYBOZU_NUM_OF_ARRAY(tbl) - 1];
+	bls::SecretKeyVec secVec(maxN);
+	bls::PublicKeyVec pubVec(maxN);
+	bls::SignatureVec sigVec(maxN);
+	const std::string m = "aggregate";
+	for (size_t i = 0; i < maxN; i++) {
+		secVec[i].init();
+		secVec[i].getPublicKey(pubVec[i]);
+		secVec[i].sign(sigVec[i], m);
+	}
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		const size_t n = tbl[i];
+		bls::Signature sig1, sig2;
+		bls::PublicKey pub1, pub2;
+		for (size_t j = 0; j < n; j++) {
+			if (j == 0) {
+				sig1 = sigVec[0];
+				pub1 = pubVec[0];
+			} else {
+				sig1.add(sigVec[j]);
+				pub1.add(pubVec[j]);
+			}
+		}
+		sig2.aggregate(sigVec.data(), n);
+		pub2.aggregate(pubVec.data(), n);
+		if (n == 0) {
+			std::string str;
+			sig2.getStr(str);
+			CYBOZU_TEST_EQUAL(str, "0");
+			pub2.getStr(str);
+			CYBOZU_TEST_EQUAL(str, "0");
+			continue;
+		}
+		CYBOZU_TEST_EQUAL(sig1, sig2);
+		CYBOZU_TEST_EQUAL(pub1, pub2);
+		CYBOZU_TEST_ASSERT(sig2.verify(pub2, m));
+	}
+	bls::Signature sig;
+	bls::PublicKey pub;
+	bls::aggregate(sig, sigVec);
+	bls::aggregate(pub, pubVec);
+	CYBOZU_TEST_ASSERT(sig.verify(pub, m));
+	CYBOZU_BENCH_C("add*n", 3, addSignatures, sig, sigVec);
+	CYBOZU_BENCH_C("aggregate", 3, sig.aggregate, sigVec.data(), sigVec.size());
+}
+
+void fastAggregateVerifyTest()
+{
+	const size_t maxN = 2048;
+	const std::string m = "same message";
+	bls::PublicKeyVec pubVec(maxN);
+	bls::SignatureVec sigVec(maxN);
+	for (size_t i = 0; i < maxN; i++) {
+		bls::SecretKey sec;
+		sec.init();
+		sec.getPublicKey(pubVec[i]);
+		sec.sign(sigVec[i], m);
+	}
+	const size_t tbl[] = { 1, 2, 128, 512, 2048 };
+	bls::Signature sig = sigVec[0];
+	size_t n = 1;
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		for (; n < tbl[i]; n++) {
+			sig.add(sigVec[n]);
+		}
+		CYBOZU_TEST_ASSERT(sig.fastAggregateVerify(pubVec.data(), n, m.c_str(), m.size()));
+		CYBOZU_TEST_ASSERT(!sig.fastAggregateVerify(pubVec.data(), n, "other", 5));
+		if (n > 1) {
+			CYBOZU_TEST_ASSERT(!sig.fastAggregateVerify(pubVec.data(), n - 1, m.c_str(), m.size()));
+		}
+		if (n >= 128) {
+			char name[64];
+			CYBOZU_SNPRINTF(name, sizeof(name), "fastAggregateVerify n=%d", (int)n);
+			CYBOZU_BENCH_C(name, 10, sig.fastAggregateVerify, pubVec.data(), n, m.c_str(), m.size());
+		}
+	}
+	CYBOZU_TEST_ASSERT(!sig.fastAggregateVerify(pubVec.data(), 0, m.c_str(), m.size()));
+	pubVec.resize(n);
+	CYBOZU_TEST_ASSERT(sig.fastAggregateVerify(pubVec, m));
+}
+
 void verifyAggregateTest()
 {
 	const size_t n = 10;
@@ -455,19 +1111,350 @@ void verifyAggregateTest()
 	CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashes(pubs, h.data(), sizeofHash, n));
 	bls::Signature invalidSig = sigs[0] + sigs[1];
 	CYBOZU_TEST_ASSERT(!invalidSig.verifyAggregatedHashes(pubs, h.data(), sizeofHash, n));
+	for (size_t threadN = 0; threadN < 5; threadN++) {
+		CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashesMT(pubs, h.data(), sizeofHash, n, threadN));
+		CYBOZU_TEST_ASSERT(!invalidSig.verifyAggregatedHashesMT(pubs, h.data(), sizeofHash, n, threadN));
+	}
 	h[0].data[0]++;
 	CYBOZU_TEST_ASSERT(!sig.verifyAggregatedHashes(pubs, h.data(), sizeofHash, n));
+	CYBOZU_TEST_ASSERT(!sig.verifyAggregatedHashesMT(pubs, h.data(), sizeofHash, n));
 }
 
+void aggregateVerifierTest()
+{
+	const size_t n = 40;
+	bls::SecretKey sec;
+	bls::PublicKeyVec pubVec(n);
+	bls::SignatureVec sigVec(n);
+	std::vector<std::string> msgVec(n);
+	for (size_t i = 0; i < n; i++) {
+		char msg[128];
+		CYBOZU_SNPRINTF(msg, sizeof(msg), "abc-%d", (int)i);
+		msgVec[i] = msg;
+		sec.init();
+		sec.getPublicKey(pubVec[i]);
+		if (i % 3 == 0) {
+			sec.signHash(sigVec[i], msgVec[i]);
+		} else {
+			sec.sign(sigVec[i], msgVec[i]);
+		}
+	}
+	bls::Signature sig;
+	bls::aggregate(sig, sigVec);
+	bls::AggregateVerifier v;
+	CYBOZU_TEST_ASSERT(!v.finalize(sig));
+	// two partial verifiers merged into v
+	bls::AggregateVerifier v1, v2;
+	for (size_t i = 0; i < n; i++) {
+		bls::AggregateVerifier& w = i < n / 2 ? v1 : v2;
+		if (i % 3 == 0) {
+			w.addHash(pubVec[i], msgVec[i]);
+		} else if (i % 3 == 1) {
+			w.add(pubVec[i], msgVec[i]);
+		} else {
+			w.add(pubVec[i], bls::PreparedMessage(msgVec[i]));
+		}
+	}
+	CYBOZU_TEST_ASSERT(!v1.finalize(sig));
+	v.merge(v1);
+	v.merge(v2);
+	CYBOZU_TEST_EQUAL(v.size(), n);
+	CYBOZU_TEST_ASSERT(v.finalize(sig));
+	CYBOZU_TEST_ASSERT(v.finalize(sig));
+	CYBOZU_TEST_ASSERT(!v.finalize(sigVec[0]));
+	// one more pair
+	sec.init();
+	bls::PublicKey pub;
+	sec.getPublicKey(pub);
+	bls::Signature sig2;
+	sec.sign(sig2, "more");
+	v.add(pub, "more");
+	CYBOZU_TEST_ASSERT(!v.finalize(sig));
+	CYBOZU_TEST_ASSERT(v.finalize(sig + sig2));
+	v.clear();
+	CYBOZU_TEST_EQUAL(v.size(), 0u);
+	v.add(pub, "more");
+	CYBOZU_TEST_ASSERT(v.finalize(sig2));
+}
+
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+struct VerifyQueueResult {
+	std::atomic<int> okN;
+	std::atomic<int> ngN;
+	static void callback(void *self, int ret)
+	{
+		VerifyQueueResult *p = (VerifyQueueResult*)self;
+		if (ret == 1) {
+			p->okN++;
+		} else {
+			p->ngN++;
+		}
+	}
+};
+
+void verifyQueueTest()
+{
+	const size_t n = 100;
+	bls::SecretKey sec;
+	bls::PublicKeyVec pubVec(n);
+	bls::SignatureVec sigVec(n);
+	std::vector<std::string> msgVec(n);
+	for (size_t i = 0; i < n; i++) {
+		char msg[128];
+		CYBOZU_SNPRINTF(msg, sizeof(msg), "queue-%d", (int)i);
+		msgVec[i] = msg;
+		sec.init();
+		sec.getPublicKey(pubVec[i]);
+		sec.sign(sigVec[i], msgVec[i]);
+	}
+	VerifyQueueResult result;
+	result.okN = 0;
+	result.ngN = 0;
+	{
+		// short delay ; batches are started by the size and the deadline
+		bls::VerifyQueue q(4, 8, 100);
+		// submit from two threads
+		std::thread th([&] {
+			for (size_t i = 0; i < n; i += 2) {
+				q.submit(sigVec[i], pubVec[i], msgVec[i], VerifyQueueResult::callback, &result);
+			}
+		});
+		for (size_t i = 1; i < n; i += 2) {
+			// a signature of another message
+			const size_t j = i % 10 == 1 ? i - 1 : i;
+			q.submit(sigVec[j], pubVec[i], msgVec[i], VerifyQueueResult::callback, &result);
+		}
+		th.join();
+		q.flush();
+		CYBOZU_TEST_EQUAL(result.okN, int(n - n / 10));
+		CYBOZU_TEST_EQUAL(result.ngN, int(n / 10));
+		blsVerifyQueueStat stat;
+		q.getStat(stat);
+		CYBOZU_TEST_EQUAL(stat.submitN, n);
+		CYBOZU_TEST_EQUAL(stat.doneN, n);
+		CYBOZU_TEST_ASSERT(stat.fallbackN >= 1);
+		CYBOZU_TEST_ASSERT(stat.maxPending >= 1);
+		for (size_t i = 4; i < BLS_VERIFY_QUEUE_HIST_N; i++) {
+			CYBOZU_TEST_EQUAL(stat.batchSizeHist[i], 0u);
+		}
+		q.submit(sigVec[0], pubVec[0], msgVec[0], VerifyQueueResult::callback, &result);
+	}
+	CYBOZU_TEST_EQUAL(result.okN, int(n - n / 10 + 1));
+}
+#endif
+
+/*
+	the pairs are evaluated every 16 pairs in the library
+	so check the sizes around the boundary
+*/
+void verifyAggregateSizeTest()
+{
+	const size_t maxN = 33;
+	const size_t sizeofHash = 32;
+	bls::PublicKeyVec pubs(maxN);
+	std::vector<char> h(maxN * sizeofHash);
+	bls::SignatureVec sigs(maxN);
+	for (size_t i = 0; i < maxN; i++) {
+		char *hi = &h[i * sizeofHash];
+		CYBOZU_SNPRINTF(hi, sizeofHash, "size-%d", (int)i);
+		bls::SecretKey sec;
+		sec.init();
+		sec.getPublicKey(pubs[i]);
+		sec.signHash(sigs[i], hi, sizeofHash);
+	}
+	const size_t tbl[] = { 1, 2, 15, 16, 17, 32, 33 };
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(tbl); i++) {
+		const size_t n = tbl[i];
+		bls::Signature sig = sigs[0];
+		for (size_t j = 1; j < n; j++) {
+			sig.add(sigs[j]);
+		}
+		CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashes(pubs.data(), h.data(), sizeofHash, n));
+		CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashesMT(pubs.data(), h.data(), sizeofHash, n, 2));
+		// the last pair is wrong
+		sig.add(sigs[n - 1]);
+		CYBOZU_TEST_ASSERT(!sig.verifyAggregatedHashes(pubs.data(), h.data(), sizeofHash, n));
+	}
+}
+
+void verifyAggregateBenchTest()
+{
+	const size_t n = 256;
+	const size_t sizeofHash = 32;
+	bls::PublicKeyVec pubs(n);
+	std::vector<char> h(n * sizeofHash);
+	bls::Signature sig, s;
+	for (size_t i = 0; i < n; i++) {
+		char *hi = &h[i * sizeofHash];
+		CYBOZU_SNPRINTF(hi, sizeofHash, "hash-%d", (int)i);
+		bls::SecretKey sec;
+		sec.init();
+		sec.getPublicKey(pubs[i]);
+		sec.signHash(s, hi, sizeofHash);
+		if (i == 0) {
+			sig = s;
+		} else {
+			sig.add(s);
+		}
+	}
+	CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashes(pubs.data(), h.data(), sizeofHash, n));
+	CYBOZU_TEST_ASSERT(sig.verifyAggregatedHashesMT(pubs.data(), h.data(), sizeofHash, n));
+	CYBOZU_BENCH_C("verifyAggregatedHashes", 3, sig.verifyAggregatedHashes, pubs.data(), h.data(), sizeofHash, n);
+	CYBOZU_BENCH_C("verifyAggregatedHashesMT", 3, sig.verifyAggregatedHashesMT, pubs.data(), h.data(), sizeofHash, n, 0);
+}
+
+bool verifyEach(const bls::SignatureVec& sigVec, const bls::PublicKeyVec& pubVec, const char *msgVec, size_t msgSize)
+{
+	for (size_t i = 0; i < sigVec.size(); i++) {
+		if (!sigVec[i].verify(pubVec[i], &msgVec[i * msgSize], msgSize)) return false;
+	}
+	return true;
+}
+
+#ifndef MCL_DONT_USE_CSPRNG
+void verifyBatchTest()
+{
+	const size_t n = 16;
+	const size_t msgSize = 32;
+	bls::SecretKeyVec secVec(n);
+	bls::PublicKeyVec pubVec(n);
+	bls::SignatureVec sigVec(n);
+	std::vector<char> msgVec(n * msgSize);
+	for (size_t i = 0; i < n; i++) {
+		char *msg = &msgVec[i * msgSize];
+		CYBOZU_SNPRINTF(msg, msgSize, "batch-%d", (int)i);
+		secVec[i].init();
+		secVec[i].getPublicKey(pubVec[i]);
+		secVec[i].sign(sigVec[i], msg, msgSize);
+	}
+	CYBOZU_TEST_ASSERT(bls::verifyBatch(sigVec, pubVec, msgVec.data(), msgSize));
+	CYBOZU_TEST_ASSERT(bls::Signature::verifyBatch(sigVec.data(), pubVec.data(), msgVec.data(), msgSize, 1));
+	std::swap(sigVec[1], sigVec[2]);
+	CYBOZU_TEST_ASSERT(!bls::verifyBatch(sigVec, pubVec, msgVec.data(), msgSize));
+	std::swap(sigVec[1], sigVec[2]);
+	msgVec[n * msgSize - 1]++;
+	CYBOZU_TEST_ASSERT(!bls::verifyBatch(sigVec, pubVec, msgVec.data(), msgSize));
+	msgVec[n * msgSize - 1]--;
+	CYBOZU_BENCH_C("verifyBatch", 10, bls::verifyBatch, sigVec, pubVec, msgVec.data(), msgSize);
+	CYBOZU_BENCH_C("verify*n", 10, verifyEach, sigVec, pubVec, msgVec.data(), msgSize);
+}
+#endif
+
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+// run each task on a new thread
+struct ThreadExecutor {
+	std::vector<std::thread> tv;
+	size_t taskN;
+	static void exec(void *self, blsTaskFunc task, void *arg)
+	{
+		ThreadExecutor *p = (ThreadExecutor*)self;
+		p->tv.push_back(std::thread(task, arg));
+		p->taskN++;
+	}
+	void join()
+	{
+		for (size_t i = 0; i < tv.size(); i++) tv[i].join();
+		tv.clear();
+	}
+};
+
+void threadPoolTest()
+{
+	const size_t k = 5;
+	const size_t n = 1000; // >= shareMinTaskN * 9 to use 9 ranges
+	bls::SecretKey sec0;
+	sec0.init();
+	bls::SecretKeyVec msk;
+	sec0.getMasterSecretKey(msk, k);
+	bls::IdVec idVec(n);
+	for (size_t i = 0; i < n; i++) {
+		idVec[i] = int(i + 1);
+	}
+	bls::SecretKeyVec secVec0, secVec;
+	bls::SecretKey::shareBatch(secVec0, msk, idVec);
+	// threadN = 0 is single-threaded until setThreadNum or setExecutor is called
+	CYBOZU_TEST_EQUAL(bls::getThreadNum(), 1u);
+	bls::SecretKey::shareBatchMT(secVec, msk, idVec, 0);
+	CYBOZU_TEST_ASSERT(secVec == secVec0);
+	// more ranges than the threads are stolen by the idle threads
+	const size_t poolTbl[] = { 1, 3, 4 };
+	for (size_t i = 0; i < CYBOZU_NUM_OF_ARRAY(poolTbl); i++) {
+		bls::setThreadNum(poolTbl[i]);
+		CYBOZU_TEST_EQUAL(bls::getThreadNum(), poolTbl[i]);
+		for (size_t threadN = 0; threadN < 10; threadN++) {
+			bls::SecretKey::shareBatchMT(secVec, msk, idVec, threadN);
+			CYBOZU_TEST_ASSERT(secVec == secVec0);
+		}
+	}
+	// MT functions called by several threads share the pool
+	{
+		std::vector<std::thread> tv;
+		std::atomic<int> okN(0);
+		for (int i = 0; i < 4; i++) {
+			tv.push_back(std::thread([&] {
+				bls::SecretKeyVec v;
+				bls::SecretKey::shareBatchMT(v, msk, idVec, 8);
+				if (v == secVec0) okN++;
+			}));
+		}
+		for (size_t i = 0; i < tv.size(); i++) tv[i].join();
+		CYBOZU_TEST_EQUAL(okN, 4);
+	}
+	ThreadExecutor ex;
+	ex.taskN = 0;
+	bls::setExecutor(ThreadExecutor::exec, &ex, 3);
+	CYBOZU_TEST_EQUAL(bls::getThreadNum(), 3u);
+	bls::SecretKey::shareBatchMT(secVec, msk, idVec, 0);
+	ex.join();
+	CYBOZU_TEST_ASSERT(secVec == secVec0);
+	CYBOZU_TEST_EQUAL(ex.taskN, 2u);
+	bls::SecretKey::shareBatchMT(secVec, msk, idVec, 1);
+	ex.join();
+	CYBOZU_TEST_ASSERT(secVec == secVec0);
+	CYBOZU_TEST_EQUAL(ex.taskN, 2u);
+	bls::setExecutor(0, 0, 0);
+	CYBOZU_TEST_EQUAL(bls::getThreadNum(), 4u);
+	// back to single-threaded for the next curve
+	bls::setThreadNum(1);
+	CYBOZU_TEST_EQUAL(bls::getThreadNum(), 1u);
+}
+#endif
+
 void testAll()
 {
 	blsTest();
 	k_of_nTest();
+	recoverLargeTest();
+	recoverSecretKeyLargeTest();
+	lagrangeTreeBenchTest();
+	shareBatchTest();
+	pubShareBatchTest();
+	signAllTest();
 	popTest();
 	addTest();
 	dataTest();
 	aggregateTest();
+	preparedPublicKeyTest();
+	preparedMessageTest();
+	publicKeyRegistryTest();
+	aggregateVecTest();
+	fastAggregateVerifyTest();
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+	publicKeyCacheThreadTest();
+#endif
 	verifyAggregateTest();
+	aggregateVerifierTest();
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+	verifyQueueTest();
+#endif
+	verifyAggregateSizeTest();
+	verifyAggregateBenchTest();
+#ifndef MCL_DONT_USE_CSPRNG
+	verifyBatchTest();
+#endif
+#if defined(CYBOZU_CPP_VERSION) && CYBOZU_CPP_VERSION >= CYBOZU_CPP_VERSION_CPP11
+	threadPoolTest();
+#endif
 }
 CYBOZU_TEST_AUTO(all)
 {
@@ -492,5 +1479,6 @@ CYBOZU_TEST_AUTO(all)
 		}
 		testAll();
 		hashTest(type);
+		contextTest();
 	}
 }